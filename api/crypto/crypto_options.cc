@@ -67,6 +67,9 @@ bool CryptoOptions::operator==(const CryptoOptions& other) const {
     struct SFrame {
       bool require_frame_encryption;
     } sframe;
+    struct Dtls {
+      bool enable_session_resumption;
+    } dtls;
     EphemeralKeyExchangeCipherGroups ephemeral_key_exchange_cipher_groups;
   };
   static_assert(sizeof(data_being_tested_for_equality) == sizeof(*this),
@@ -82,6 +85,8 @@ bool CryptoOptions::operator==(const CryptoOptions& other) const {
              other.srtp.enable_encrypted_rtp_header_extensions &&
          sframe.require_frame_encryption ==
              other.sframe.require_frame_encryption &&
+         dtls.enable_session_resumption ==
+             other.dtls.enable_session_resumption &&
          ephemeral_key_exchange_cipher_groups ==
              other.ephemeral_key_exchange_cipher_groups;
 }
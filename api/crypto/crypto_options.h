@@ -70,6 +70,15 @@ struct RTC_EXPORT CryptoOptions {
     bool require_frame_encryption = false;
   } sframe;
 
+  // DTLS Related Peer Connection options.
+  struct Dtls {
+    // If set to true, DTLS sessions are resumed with session tickets when a
+    // new transport connects to a peer with the same certificates, which
+    // skips the key exchange and certificate signatures of a full handshake.
+    // Resumption is only used if both sides enable it.
+    bool enable_session_resumption = false;
+  } dtls;
+
   // Cipher groups used by DTLS when establishing an ephemeral key during
   // handshake.
   class RTC_EXPORT EphemeralKeyExchangeCipherGroups {
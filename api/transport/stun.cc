@@ -113,6 +113,16 @@ const char EMPTY_TRANSACTION_ID[] = "0000000000000000";
 const uint32_t STUN_FINGERPRINT_XOR_VALUE = 0x5354554E;
 const int SERVER_NOT_REACHABLE_ERROR = 701;
 
+// StunMessageIntegrityKey
+
+StunMessageIntegrityKey::StunMessageIntegrityKey(absl::string_view password)
+    : password_(password),
+      hmac_(HmacFactory::Create(DIGEST_SHA_1, password)) {
+  RTC_DCHECK(hmac_);
+}
+
+StunMessageIntegrityKey::~StunMessageIntegrityKey() = default;
+
 // StunMessage
 
 StunMessage::StunMessage()
@@ -250,13 +260,19 @@ const StunUInt16ListAttribute* StunMessage::GetUnknownAttributes() const {
 
 StunMessage::IntegrityStatus StunMessage::ValidateMessageIntegrity(
     const std::string& password) {
+  StunMessageIntegrityKey key(password);
+  return ValidateMessageIntegrity(key);
+}
+
+StunMessage::IntegrityStatus StunMessage::ValidateMessageIntegrity(
+    StunMessageIntegrityKey& key) {
   RTC_DCHECK(integrity_ == IntegrityStatus::kNotSet)
       << "Usage error: Verification should only be done once";
-  password_ = password;
+  password_ = key.password();
   if (GetByteString(STUN_ATTR_MESSAGE_INTEGRITY)) {
     if (ValidateMessageIntegrityOfType(
             STUN_ATTR_MESSAGE_INTEGRITY, kStunMessageIntegritySize,
-            buffer_.c_str(), buffer_.size(), password)) {
+            buffer_.c_str(), buffer_.size(), *key.hmac_)) {
       integrity_ = IntegrityStatus::kIntegrityOk;
     } else {
       integrity_ = IntegrityStatus::kIntegrityBad;
@@ -264,7 +280,7 @@ StunMessage::IntegrityStatus StunMessage::ValidateMessageIntegrity(
   } else if (GetByteString(STUN_ATTR_GOOG_MESSAGE_INTEGRITY_32)) {
     if (ValidateMessageIntegrityOfType(
             STUN_ATTR_GOOG_MESSAGE_INTEGRITY_32, kStunMessageIntegrity32Size,
-            buffer_.c_str(), buffer_.size(), password)) {
+            buffer_.c_str(), buffer_.size(), *key.hmac_)) {
       integrity_ = IntegrityStatus::kIntegrityOk;
     } else {
       integrity_ = IntegrityStatus::kIntegrityBad;
@@ -352,18 +368,20 @@ bool StunMessage::ValidateMessageIntegrityForTesting(
     const char* data,
     size_t size,
     const std::string& password) {
+  StunMessageIntegrityKey key(password);
   return ValidateMessageIntegrityOfType(STUN_ATTR_MESSAGE_INTEGRITY,
                                         kStunMessageIntegritySize, data, size,
-                                        password);
+                                        *key.hmac_);
 }
 
 bool StunMessage::ValidateMessageIntegrity32ForTesting(
     const char* data,
     size_t size,
     const std::string& password) {
+  StunMessageIntegrityKey key(password);
   return ValidateMessageIntegrityOfType(STUN_ATTR_GOOG_MESSAGE_INTEGRITY_32,
                                         kStunMessageIntegrity32Size, data, size,
-                                        password);
+                                        *key.hmac_);
 }
 
 // Verifies a STUN message has a valid MESSAGE-INTEGRITY attribute, using the
@@ -372,7 +390,7 @@ bool StunMessage::ValidateMessageIntegrityOfType(int mi_attr_type,
                                                  size_t mi_attr_size,
                                                  const char* data,
                                                  size_t size,
-                                                 const std::string& password) {
+                                                 Hmac& hmac) {
   RTC_DCHECK(mi_attr_size <= kStunMessageIntegritySize);
 
   // Verifying the size of the message.
@@ -417,10 +435,11 @@ bool StunMessage::ValidateMessageIntegrityOfType(int mi_attr_type,
     return false;
   }
 
-  // Getting length of the message to calculate Message Integrity.
+  // The HMAC is computed in place over the message up to the Message Integrity
+  // attribute, with only the header copied to adjust its length.
   size_t mi_pos = current_pos;
-  std::unique_ptr<char[]> temp_data(new char[current_pos]);
-  memcpy(temp_data.get(), data, current_pos);
+  char header[kStunHeaderSize];
+  memcpy(header, data, kStunHeaderSize);
   if (size > mi_pos + kStunAttributeHeaderSize + mi_attr_size) {
     // Stun message has other attributes after message integrity.
     // Adjust the length parameter in stun message to calculate HMAC.
@@ -428,25 +447,26 @@ bool StunMessage::ValidateMessageIntegrityOfType(int mi_attr_type,
         size - (mi_pos + kStunAttributeHeaderSize + mi_attr_size);
     size_t new_adjusted_len = size - extra_offset - kStunHeaderSize;
 
-    // Writing new length of the STUN message @ Message Length in temp buffer.
+    // Writing new length of the STUN message @ Message Length in header.
     //      0                   1                   2                   3
     //      0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
     //     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
     //     |0 0|     STUN Message Type     |         Message Length        |
     //     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
-    SetBE16(temp_data.get() + 2, static_cast<uint16_t>(new_adjusted_len));
+    SetBE16(header + 2, static_cast<uint16_t>(new_adjusted_len));
   }
 
-  char hmac[kStunMessageIntegritySize];
-  size_t ret = ComputeHmac(DIGEST_SHA_1, password.c_str(), password.size(),
-                           temp_data.get(), mi_pos, hmac, sizeof(hmac));
-  RTC_DCHECK(ret == sizeof(hmac));
-  if (ret != sizeof(hmac)) {
+  char computed_hmac[kStunMessageIntegritySize];
+  hmac.Update(header, kStunHeaderSize);
+  hmac.Update(data + kStunHeaderSize, mi_pos - kStunHeaderSize);
+  size_t ret = hmac.Finish(computed_hmac, sizeof(computed_hmac));
+  RTC_DCHECK(ret == sizeof(computed_hmac));
+  if (ret != sizeof(computed_hmac)) {
     return false;
   }
 
   // Comparing the calculated HMAC with the one present in the message.
-  return memcmp(data + current_pos + kStunAttributeHeaderSize, hmac,
+  return memcmp(data + current_pos + kStunAttributeHeaderSize, computed_hmac,
                 mi_attr_size) == 0;
 }
 
@@ -1449,6 +1469,64 @@ StunMessage* TurnMessage::CreateNew() const {
   return new TurnMessage();
 }
 
+bool TurnMessage::ParseDataIndication(ArrayView<const uint8_t> data,
+                                      SocketAddress* peer_address,
+                                      ArrayView<const uint8_t>* payload) {
+  // Same header checks as in StunMessage::Read().
+  if (data.size() < kStunHeaderSize ||
+      GetBE16(data.data()) != TURN_DATA_INDICATION ||
+      GetBE16(data.data() + 2) != data.size() - kStunHeaderSize) {
+    return false;
+  }
+  // Messages from RFC 3489 peers have no magic cookie, and IPv6 addresses
+  // can't be XORed with their transaction id, see GetXoredIP().
+  const bool has_magic_cookie = GetBE32(data.data() + 4) == kStunMagicCookie;
+
+  bool has_peer_address = false;
+  bool has_payload = false;
+  ByteBufferReader buf(data.subview(kStunHeaderSize));
+  while (buf.Length() > 0) {
+    uint16_t attr_type, attr_length;
+    if (!buf.ReadUInt16(&attr_type) || !buf.ReadUInt16(&attr_length) ||
+        attr_length > buf.Length()) {
+      return false;
+    }
+    ArrayView<const uint8_t> value = buf.DataView().subview(0, attr_length);
+    // The padding of the last attribute may be missing.
+    buf.Consume(std::min<size_t>((attr_length + 3) & ~3, buf.Length()));
+
+    // Only the first attribute of each type is used, as in GetAttribute().
+    if (attr_type == STUN_ATTR_XOR_PEER_ADDRESS && !has_peer_address) {
+      if (attr_length < 4) {
+        return false;
+      }
+      uint16_t port = GetBE16(&value[2]) ^ (kStunMagicCookie >> 16);
+      if (value[1] == STUN_ADDRESS_IPV4 &&
+          attr_length == StunAddressAttribute::SIZE_IP4) {
+        *peer_address = SocketAddress(
+            IPAddress(GetBE32(&value[4]) ^ kStunMagicCookie), port);
+      } else if (value[1] == STUN_ADDRESS_IPV6 &&
+                 attr_length == StunAddressAttribute::SIZE_IP6 &&
+                 has_magic_cookie) {
+        // XORed with the magic cookie and the transaction id, which follow
+        // each other in the header.
+        in6_addr v6addr;
+        for (size_t i = 0; i < sizeof(v6addr); ++i) {
+          v6addr.s6_addr[i] = value[4 + i] ^ data[4 + i];
+        }
+        *peer_address = SocketAddress(IPAddress(v6addr), port);
+      } else {
+        return false;
+      }
+      has_peer_address = true;
+    } else if (attr_type == STUN_ATTR_DATA && !has_payload) {
+      *payload = value;
+      has_payload = true;
+    }
+  }
+  return has_peer_address && has_payload;
+}
+
 StunAttributeValueType IceMessage::GetAttributeValueType(int type) const {
   switch (type) {
     case STUN_ATTR_PRIORITY:
@@ -27,6 +27,7 @@
 #include "rtc_base/byte_buffer.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/ip_address.h"
+#include "rtc_base/message_digest.h"
 #include "rtc_base/net_helpers.h"
 #include "rtc_base/socket_address.h"
 
@@ -145,6 +146,26 @@ class StunUInt32Attribute;
 class StunUInt64Attribute;
 class StunXorAddressAttribute;
 
+// Caches the HMAC-SHA1 key schedule of a STUN password, so that the
+// MESSAGE-INTEGRITY of many messages with the same password, e.g. the binding
+// requests and responses of an ICE connection, can be verified without
+// recomputing it and without allocating memory.
+class StunMessageIntegrityKey {
+ public:
+  explicit StunMessageIntegrityKey(absl::string_view password);
+  StunMessageIntegrityKey(const StunMessageIntegrityKey&) = delete;
+  StunMessageIntegrityKey& operator=(const StunMessageIntegrityKey&) = delete;
+  ~StunMessageIntegrityKey();
+
+  const std::string& password() const { return password_; }
+
+ private:
+  friend class StunMessage;
+
+  const std::string password_;
+  const std::unique_ptr<Hmac> hmac_;
+};
+
 // Records a complete STUN/TURN message.  Each message consists of a type and
 // any number of attributes.  Each attribute is parsed into an instance of an
 // appropriate class (see above).  The Get* methods will return instances of
@@ -225,6 +246,9 @@ class StunMessage {
   // Validates that a STUN message has a correct MESSAGE-INTEGRITY value.
   // This uses the buffered raw-format message stored by Read().
   IntegrityStatus ValidateMessageIntegrity(const std::string& password);
+  // Like the previous function, but using the cached key schedule of `key`.
+  // The message is verified in place, without copying it.
+  IntegrityStatus ValidateMessageIntegrity(StunMessageIntegrityKey& key);
 
   // Revalidates the STUN message with (possibly) a new password.
   // Indicates that calling logic needs review - probably previous call
@@ -320,7 +344,7 @@ class StunMessage {
                                              size_t mi_attr_size,
                                              const char* data,
                                              size_t size,
-                                             const std::string& password);
+                                             Hmac& hmac);
 
   uint16_t type_ = STUN_INVALID_MESSAGE_TYPE;
   uint16_t length_ = 0;
@@ -687,6 +711,14 @@ class TurnMessage : public StunMessage {
  public:
   using StunMessage::StunMessage;
 
+  // Reads the XOR-PEER-ADDRESS and DATA attributes of the Data indication in
+  // `data`, without creating attribute objects or copying the payload, which
+  // points into `data`. Returns false if `data` is not a well formed Data
+  // indication with both attributes.
+  static bool ParseDataIndication(ArrayView<const uint8_t> data,
+                                  SocketAddress* peer_address,
+                                  ArrayView<const uint8_t>* payload);
+
  protected:
   StunAttributeValueType GetAttributeValueType(int type) const override;
   StunMessage* CreateNew() const override;
@@ -880,6 +912,7 @@ using ::webrtc::StunByteStringAttribute;
 using ::webrtc::StunErrorCode;
 using ::webrtc::StunErrorCodeAttribute;
 using ::webrtc::StunMessage;
+using ::webrtc::StunMessageIntegrityKey;
 using ::webrtc::StunMessageType;
 using ::webrtc::StunMethodToString;
 using ::webrtc::StunUInt16ListAttribute;
@@ -0,0 +1,92 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "api/array_view.h"
+#include "api/transport/stun.h"
+#include "benchmark/benchmark.h"
+#include "rtc_base/byte_buffer.h"
+
+namespace webrtc {
+namespace {
+
+constexpr char kUsername[] = "remoteufrag:localufrag";
+constexpr char kPassword[] = "abcdefghijklmnopqrstuvwx";
+
+// Returns a serialized ICE connectivity check, like the ones received by a
+// Port, with MESSAGE-INTEGRITY and FINGERPRINT.
+std::string CreateBindingRequest() {
+  IceMessage request(STUN_BINDING_REQUEST);
+  request.AddAttribute(
+      std::make_unique<StunByteStringAttribute>(STUN_ATTR_USERNAME, kUsername));
+  request.AddAttribute(
+      std::make_unique<StunUInt32Attribute>(STUN_ATTR_PRIORITY, 0x6e7f1eff));
+  request.AddAttribute(std::make_unique<StunUInt64Attribute>(
+      STUN_ATTR_ICE_CONTROLLING, 0x1234567890abcdef));
+  request.AddAttribute(
+      std::make_unique<StunUInt32Attribute>(STUN_ATTR_GOOG_NETWORK_INFO, 1));
+  request.AddMessageIntegrity(kPassword);
+  request.AddFingerprint();
+  ByteBufferWriter buf;
+  request.Write(&buf);
+  return std::string(reinterpret_cast<const char*>(buf.Data()), buf.Length());
+}
+
+// Parses and authenticates a received connectivity check, with the password
+// given per message if `state.range(0)` is 0 and with a StunMessageIntegrityKey
+// cached for the connection otherwise.
+void BM_ValidateBindingRequest(benchmark::State& state) {
+  const bool use_cached_key = state.range(0) != 0;
+  const std::string packet = CreateBindingRequest();
+  const std::string password = kPassword;
+  StunMessageIntegrityKey key(password);
+  for (auto _ : state) {
+    if (!StunMessage::ValidateFingerprint(packet.data(), packet.size())) {
+      state.SkipWithError("Bad fingerprint");
+      break;
+    }
+    IceMessage request;
+    ByteBufferReader buf(MakeArrayView(
+        reinterpret_cast<const uint8_t*>(packet.data()), packet.size()));
+    request.Read(&buf);
+    StunMessage::IntegrityStatus status =
+        use_cached_key ? request.ValidateMessageIntegrity(key)
+                       : request.ValidateMessageIntegrity(password);
+    if (status != StunMessage::IntegrityStatus::kIntegrityOk) {
+      state.SkipWithError("Bad message integrity");
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * packet.size());
+}
+
+// 0 for the password given per message and 1 for a cached key.
+BENCHMARK(BM_ValidateBindingRequest)->Arg(0)->Arg(1);
+
+// Validates the FINGERPRINT of a received connectivity check, which is done
+// for every packet received on an ICE transport to demultiplex STUN.
+void BM_ValidateFingerprint(benchmark::State& state) {
+  const std::string packet = CreateBindingRequest();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        StunMessage::ValidateFingerprint(packet.data(), packet.size()));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * packet.size());
+}
+BENCHMARK(BM_ValidateFingerprint);
+
+}  // namespace
+}  // namespace webrtc
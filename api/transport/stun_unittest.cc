@@ -16,7 +16,9 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "absl/strings/string_view.h"
 #include "api/array_view.h"
 #include "rtc_base/byte_buffer.h"
 #include "rtc_base/byte_order.h"
@@ -1223,6 +1225,39 @@ TEST_F(StunTest, ValidateMessageIntegrity) {
   }
 }
 
+// Check that a StunMessageIntegrityKey can be reused to validate several
+// messages, which here have a FINGERPRINT after the MESSAGE-INTEGRITY.
+TEST_F(StunTest, ValidateMessageIntegrityWithKey) {
+  StunMessageIntegrityKey key(kRfc5769SampleMsgPassword);
+  StunMessageIntegrityKey bad_key("InvalidPassword");
+  for (int i = 0; i < 2; ++i) {
+    IceMessage request;
+    ByteBufferReader request_buf(kRfc5769SampleRequest);
+    ASSERT_TRUE(request.Read(&request_buf));
+    EXPECT_EQ(request.ValidateMessageIntegrity(key),
+              StunMessage::IntegrityStatus::kIntegrityOk);
+    EXPECT_EQ(request.password(), kRfc5769SampleMsgPassword);
+
+    IceMessage response;
+    ByteBufferReader response_buf(kRfc5769SampleResponse);
+    ASSERT_TRUE(response.Read(&response_buf));
+    EXPECT_EQ(response.ValidateMessageIntegrity(key),
+              StunMessage::IntegrityStatus::kIntegrityOk);
+
+    IceMessage bad_request;
+    ByteBufferReader bad_request_buf(kRfc5769SampleRequest);
+    ASSERT_TRUE(bad_request.Read(&bad_request_buf));
+    EXPECT_EQ(bad_request.ValidateMessageIntegrity(bad_key),
+              StunMessage::IntegrityStatus::kIntegrityBad);
+  }
+
+  IceMessage no_integrity;
+  ByteBufferReader no_integrity_buf(kRfc5769SampleRequestWithoutMI);
+  ASSERT_TRUE(no_integrity.Read(&no_integrity_buf));
+  EXPECT_EQ(no_integrity.ValidateMessageIntegrity(key),
+            StunMessage::IntegrityStatus::kNoIntegrity);
+}
+
 // Validate that we generate correct MESSAGE-INTEGRITY attributes.
 // Note the use of IceMessage instead of StunMessage; this is necessary because
 // the RFC5769 test messages used include attributes not found in basic STUN.
@@ -1704,6 +1739,72 @@ TEST_F(StunTest, SizeRestrictionOnAttributes) {
   ASSERT_FALSE(msg.Write(&out));
 }
 
+// Returns a serialized Data indication with the given attributes.
+static std::vector<uint8_t> CreateDataIndication(
+    const SocketAddress* peer_address,
+    const std::string* data) {
+  TurnMessage msg(TURN_DATA_INDICATION);
+  if (peer_address) {
+    msg.AddAttribute(std::make_unique<StunXorAddressAttribute>(
+        STUN_ATTR_XOR_PEER_ADDRESS, *peer_address));
+  }
+  if (data) {
+    msg.AddAttribute(
+        std::make_unique<StunByteStringAttribute>(STUN_ATTR_DATA, *data));
+  }
+  ByteBufferWriter buf;
+  EXPECT_TRUE(msg.Write(&buf));
+  return std::vector<uint8_t>(buf.Data(), buf.Data() + buf.Length());
+}
+
+TEST_F(StunTest, ParseDataIndication) {
+  const std::string data = "payload";  // Needs padding.
+  for (const SocketAddress& address :
+       {SocketAddress(IPAddress(kIPv4TestAddress1), kTestMessagePort1),
+        SocketAddress(IPAddress(kIPv6TestAddress1), kTestMessagePort2)}) {
+    std::vector<uint8_t> packet = CreateDataIndication(&address, &data);
+    SocketAddress peer_address;
+    ArrayView<const uint8_t> payload;
+    ASSERT_TRUE(
+        TurnMessage::ParseDataIndication(packet, &peer_address, &payload));
+    EXPECT_EQ(peer_address, address);
+    EXPECT_EQ(absl::string_view(reinterpret_cast<const char*>(payload.data()),
+                                payload.size()),
+              data);
+    // The payload is not copied.
+    EXPECT_GE(payload.data(), packet.data());
+    EXPECT_LE(payload.data() + payload.size(), packet.data() + packet.size());
+
+    // Same result as when reading the message.
+    TurnMessage msg;
+    ByteBufferReader reader(packet);
+    ASSERT_TRUE(msg.Read(&reader));
+    EXPECT_EQ(msg.GetAddress(STUN_ATTR_XOR_PEER_ADDRESS)->GetAddress(),
+              peer_address);
+  }
+}
+
+TEST_F(StunTest, FailToParseInvalidDataIndications) {
+  const SocketAddress address(IPAddress(kIPv4TestAddress1), kTestMessagePort1);
+  const std::string data = "payload";
+  SocketAddress peer_address;
+  ArrayView<const uint8_t> payload;
+  EXPECT_FALSE(TurnMessage::ParseDataIndication(
+      CreateDataIndication(&address, nullptr), &peer_address, &payload));
+  EXPECT_FALSE(TurnMessage::ParseDataIndication(
+      CreateDataIndication(nullptr, &data), &peer_address, &payload));
+
+  std::vector<uint8_t> packet = CreateDataIndication(&address, &data);
+  // Truncated.
+  EXPECT_FALSE(TurnMessage::ParseDataIndication(
+      ArrayView<const uint8_t>(packet).subview(0, packet.size() - 4),
+      &peer_address, &payload));
+  // Not a Data indication.
+  SetBE16(packet.data(), TURN_SEND_INDICATION);
+  EXPECT_FALSE(
+      TurnMessage::ParseDataIndication(packet, &peer_address, &payload));
+}
+
 TEST_F(StunTest, ValidateMessageIntegrityWithParser) {
   metrics::Reset();  // Ensure counters start from zero.
   // Try the messages from RFC 5769.
@@ -71,6 +71,7 @@
 #include "logging/rtc_event_log/rtc_stream_config.h"
 #include "media/base/codec.h"
 #include "modules/congestion_controller/include/receive_side_congestion_controller.h"
+#include "modules/congestion_controller/include/receive_side_feedback_scheduler.h"
 #include "modules/rtp_rtcp/include/flexfec_receiver.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/rtp_rtcp/source/rtp_header_extensions.h"
@@ -753,11 +754,16 @@ Call::Call(CallConfig config,
 
   call_stats_->RegisterStatsObserver(&receive_side_cc_);
 
-  ReceiveSideCongestionController* receive_side_cc = &receive_side_cc_;
-  receive_side_cc_periodic_task_ = RepeatingTaskHandle::Start(
-      worker_thread_,
-      [receive_side_cc] { return receive_side_cc->MaybeProcess(); },
-      TaskQueueBase::DelayPrecision::kLow, &env_.clock());
+  if (config_.receive_side_feedback_scheduler) {
+    config_.receive_side_feedback_scheduler->RegisterController(
+        &receive_side_cc_);
+  } else {
+    ReceiveSideCongestionController* receive_side_cc = &receive_side_cc_;
+    receive_side_cc_periodic_task_ = RepeatingTaskHandle::Start(
+        worker_thread_,
+        [receive_side_cc] { return receive_side_cc->MaybeProcess(); },
+        TaskQueueBase::DelayPrecision::kLow, &env_.clock());
+  }
 
   // TODO(b/350555527): Remove after experiment
   if (GetElasticRateAllocationFieldTrialParameter(env_.field_trials()) !=
@@ -785,6 +791,10 @@ Call::~Call() {
   RTC_CHECK(audio_receive_streams_.empty());
   RTC_CHECK(video_receive_streams_.empty());
 
+  if (config_.receive_side_feedback_scheduler) {
+    config_.receive_side_feedback_scheduler->UnregisterController(
+        &receive_side_cc_);
+  }
   receive_side_cc_periodic_task_.Stop();
   elastic_bandwidth_allocation_task_.Stop();
   call_stats_->DeregisterStatsObserver(&receive_side_cc_);
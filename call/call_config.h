@@ -30,6 +30,7 @@
 namespace webrtc {
 
 class AudioProcessing;
+class ReceiveSideFeedbackScheduler;
 
 struct CallConfig {
   // If `network_task_queue` is set to nullptr, Call will assume that network
@@ -81,6 +82,11 @@ struct CallConfig {
   RtpTransportControllerSendFactoryInterface*
       rtp_transport_controller_send_factory = nullptr;
 
+  // Processes receive side congestion control feedback on behalf of all calls
+  // sharing the worker thread, instead of a timer per call. Must run on the
+  // worker thread of the call.
+  ReceiveSideFeedbackScheduler* receive_side_feedback_scheduler = nullptr;
+
   Metronome* decode_metronome = nullptr;
   Metronome* encode_metronome = nullptr;
 
@@ -12,6 +12,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <vector>
 
 #include "api/array_view.h"
@@ -23,39 +24,39 @@ namespace H264 {
 const uint8_t kNaluTypeMask = 0x1F;
 
 std::vector<NaluIndex> FindNaluIndices(ArrayView<const uint8_t> buffer) {
-  // This is sorta like Boyer-Moore, but with only the first optimization step:
-  // given a 3-byte sequence we're looking at, if the 3rd byte isn't 1 or 0,
-  // skip ahead to the next 3-byte sequence. 0s and 1s are relatively rare, so
-  // this will skip the majority of reads/checks.
+  // Start sequences end with a 1 byte, which is relatively rare in encoded
+  // data. Use memchr, which is vectorized on all platforms we care about, to
+  // find the candidate 1 bytes and only then check for the preceding zeros.
   std::vector<NaluIndex> sequences;
   if (buffer.size() < kNaluShortStartSequenceSize)
     return sequences;
 
   static_assert(kNaluShortStartSequenceSize >= 2,
                 "kNaluShortStartSequenceSize must be larger or equals to 2");
-  const size_t end = buffer.size() - kNaluShortStartSequenceSize;
-  for (size_t i = 0; i < end;) {
-    if (buffer[i + 2] > 1) {
-      i += 3;
-    } else if (buffer[i + 2] == 1) {
-      if (buffer[i + 1] == 0 && buffer[i] == 0) {
-        // We found a start sequence, now check if it was a 3 of 4 byte one.
-        NaluIndex index = {i, i + 3, 0};
-        if (index.start_offset > 0 && buffer[index.start_offset - 1] == 0)
-          --index.start_offset;
-
-        // Update length of previous entry.
-        auto it = sequences.rbegin();
-        if (it != sequences.rend())
-          it->payload_size = index.start_offset - it->payload_start_offset;
-
-        sequences.push_back(index);
-      }
-
-      i += 3;
-    } else {
-      ++i;
+  // A start sequence whose 1 byte is the last byte of the buffer has no
+  // payload and is not reported.
+  const uint8_t* const data = buffer.data();
+  const size_t end = buffer.size() - 1;
+  for (size_t i = kNaluShortStartSequenceSize - 1; i < end;) {
+    const uint8_t* one =
+        static_cast<const uint8_t*>(memchr(data + i, 1, end - i));
+    if (one == nullptr)
+      break;
+    i = one - data;
+    if (data[i - 1] == 0 && data[i - 2] == 0) {
+      // We found a start sequence, now check if it was a 3 of 4 byte one.
+      NaluIndex index = {i - 2, i + 1, 0};
+      if (index.start_offset > 0 && data[index.start_offset - 1] == 0)
+        --index.start_offset;
+
+      // Update length of previous entry.
+      auto it = sequences.rbegin();
+      if (it != sequences.rend())
+        it->payload_size = index.start_offset - it->payload_start_offset;
+
+      sequences.push_back(index);
     }
+    ++i;
   }
 
   // Update length of last entry, if any.
@@ -74,22 +75,27 @@ std::vector<uint8_t> ParseRbsp(ArrayView<const uint8_t> data) {
   std::vector<uint8_t> out;
   out.reserve(data.size());
 
-  for (size_t i = 0; i < data.size();) {
-    // Be careful about over/underflow here. byte_length_ - 3 can underflow, and
-    // i + 3 can overflow, but byte_length_ - i can't, because i < byte_length_
-    // above, and that expression will produce the number of bytes left in
-    // the stream including the byte at i.
-    if (data.size() - i >= 3 && !data[i] && !data[i + 1] && data[i + 2] == 3) {
-      // Two rbsp bytes.
-      out.push_back(data[i++]);
-      out.push_back(data[i++]);
+  // Emulation prevention bytes are 0x03 bytes preceded by two zero bytes. They
+  // are rare, so look for 0x03 bytes with memchr and copy everything in
+  // between in bulk. A removed emulation byte is itself 0x03, so it can't be
+  // one of the zeros preceding a later one and no state needs to be kept
+  // between matches.
+  const uint8_t* const begin = data.data();
+  size_t copied = 0;
+  for (size_t i = 2; i < data.size();) {
+    const uint8_t* three =
+        static_cast<const uint8_t*>(memchr(begin + i, 3, data.size() - i));
+    if (three == nullptr)
+      break;
+    i = three - begin;
+    if (data[i - 1] == 0 && data[i - 2] == 0) {
+      out.insert(out.end(), begin + copied, begin + i);
       // Skip the emulation byte.
-      i++;
-    } else {
-      // Single rbsp byte.
-      out.push_back(data[i++]);
+      copied = i + 1;
     }
+    ++i;
   }
+  out.insert(out.end(), begin + copied, begin + data.size());
   return out;
 }
 
@@ -99,20 +105,37 @@ void WriteRbsp(ArrayView<const uint8_t> bytes, Buffer* destination) {
   size_t num_consecutive_zeros = 0;
   destination->EnsureCapacity(destination->size() + bytes.size());
 
-  for (uint8_t byte : bytes) {
+  // Bytes are appended in bulk between the positions that need escaping.
+  const uint8_t* const data = bytes.data();
+  size_t copied = 0;
+  for (size_t i = 0; i < bytes.size(); ++i) {
+    if (num_consecutive_zeros == 0) {
+      // Escaping is only needed after a run of zeros, so skip ahead to the
+      // next zero.
+      const uint8_t* zero = static_cast<const uint8_t*>(
+          memchr(data + i, 0, bytes.size() - i));
+      if (zero == nullptr)
+        break;
+      i = zero - data;
+    }
+    const uint8_t byte = data[i];
     if (byte <= kEmulationByte &&
         num_consecutive_zeros >= kZerosInStartSequence) {
       // Need to escape.
+      destination->AppendData(data + copied, i - copied);
       destination->AppendData(kEmulationByte);
+      copied = i;
       num_consecutive_zeros = 0;
     }
-    destination->AppendData(byte);
     if (byte == 0) {
       ++num_consecutive_zeros;
     } else {
       num_consecutive_zeros = 0;
     }
   }
+  if (copied < bytes.size()) {
+    destination->AppendData(data + copied, bytes.size() - copied);
+  }
 }
 
 }  // namespace H264
@@ -0,0 +1,80 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "common_video/h264/h264_common.h"
+#include "rtc_base/buffer.h"
+
+namespace webrtc {
+namespace {
+
+// Generates an Annex B stream similar to a high bitrate key frame: slices of
+// `slice_size` bytes of high entropy data, escaped and prefixed with start
+// sequences.
+Buffer CreateAnnexBStream(size_t size, size_t slice_size) {
+  Buffer stream;
+  uint32_t state = 1;
+  std::vector<uint8_t> rbsp(slice_size);
+  while (stream.size() < size) {
+    for (uint8_t& byte : rbsp) {
+      state = state * 1103515245 + 12345;
+      byte = state >> 24;
+    }
+    const uint8_t kStartSequence[] = {0, 0, 0, 1};
+    stream.AppendData(kStartSequence);
+    H264::WriteRbsp(rbsp, &stream);
+  }
+  return stream;
+}
+
+void BM_FindNaluIndices(benchmark::State& state) {
+  const Buffer stream = CreateAnnexBStream(state.range(0), 1200);
+  for (auto _ : state) {
+    std::vector<H264::NaluIndex> indices = H264::FindNaluIndices(stream);
+    benchmark::DoNotOptimize(indices);
+  }
+  state.SetBytesProcessed(state.iterations() * stream.size());
+}
+
+void BM_ParseRbsp(benchmark::State& state) {
+  const Buffer stream = CreateAnnexBStream(state.range(0), state.range(0));
+  for (auto _ : state) {
+    std::vector<uint8_t> rbsp = H264::ParseRbsp(stream);
+    benchmark::DoNotOptimize(rbsp);
+  }
+  state.SetBytesProcessed(state.iterations() * stream.size());
+}
+
+void BM_WriteRbsp(benchmark::State& state) {
+  std::vector<uint8_t> rbsp(state.range(0));
+  uint32_t seed = 1;
+  for (uint8_t& byte : rbsp) {
+    seed = seed * 1103515245 + 12345;
+    byte = seed >> 24;
+  }
+  Buffer escaped;
+  for (auto _ : state) {
+    escaped.Clear();
+    H264::WriteRbsp(rbsp, &escaped);
+    benchmark::DoNotOptimize(escaped.data());
+  }
+  state.SetBytesProcessed(state.iterations() * rbsp.size());
+}
+
+BENCHMARK(BM_FindNaluIndices)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ParseRbsp)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_WriteRbsp)->Range(1 << 10, 1 << 20);
+
+}  // namespace
+}  // namespace webrtc
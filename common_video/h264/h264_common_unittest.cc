@@ -0,0 +1,90 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/h264/h264_common.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "rtc_base/buffer.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace H264 {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
+using ::testing::IsEmpty;
+
+MATCHER_P3(NaluIndexIs, start_offset, payload_start_offset, payload_size, "") {
+  return arg.start_offset == static_cast<size_t>(start_offset) &&
+         arg.payload_start_offset ==
+             static_cast<size_t>(payload_start_offset) &&
+         arg.payload_size == static_cast<size_t>(payload_size);
+}
+
+TEST(H264CommonTest, FindNaluIndicesInEmptyAndShortBuffers) {
+  EXPECT_THAT(FindNaluIndices({}), IsEmpty());
+  const uint8_t kShort[] = {0, 0, 1};
+  EXPECT_THAT(FindNaluIndices(kShort), IsEmpty());
+}
+
+TEST(H264CommonTest, FindNaluIndicesWithThreeAndFourByteStartSequences) {
+  const uint8_t kBuffer[] = {0, 0, 0, 1, 0x67, 0xAA, 0,    0,
+                             1, 0x68, 1, 0,    0,    0,    1,    0x65};
+  EXPECT_THAT(FindNaluIndices(kBuffer),
+              ElementsAre(NaluIndexIs(0, 4, 2), NaluIndexIs(6, 9, 2),
+                          NaluIndexIs(11, 15, 1)));
+}
+
+TEST(H264CommonTest, FindNaluIndicesIgnoresStartSequenceAtEndOfBuffer) {
+  const uint8_t kBuffer[] = {0, 0, 1, 0x67, 0x42, 0, 0, 1};
+  EXPECT_THAT(FindNaluIndices(kBuffer), ElementsAre(NaluIndexIs(0, 3, 5)));
+}
+
+TEST(H264CommonTest, FindNaluIndicesWithoutLeadingZeros) {
+  const uint8_t kBuffer[] = {1, 1, 1, 0, 1, 0, 0, 1, 9};
+  EXPECT_THAT(FindNaluIndices(kBuffer), ElementsAre(NaluIndexIs(5, 8, 1)));
+}
+
+TEST(H264CommonTest, ParseRbspRemovesEmulationPreventionBytes) {
+  const uint8_t kEscaped[] = {0x11, 0, 0, 3, 0, 0, 0, 3, 1, 0, 0, 3, 3, 0, 0, 3};
+  EXPECT_THAT(ParseRbsp(kEscaped),
+              ElementsAre(0x11, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0));
+}
+
+TEST(H264CommonTest, WriteRbspInsertsEmulationPreventionBytes) {
+  const uint8_t kRbsp[] = {0x11, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0};
+  Buffer escaped;
+  WriteRbsp(kRbsp, &escaped);
+  EXPECT_THAT(escaped, ElementsAre(0x11, 0, 0, 3, 0, 0, 3, 0, 1, 0, 0, 3, 3,
+                                   0, 0));
+}
+
+TEST(H264CommonTest, RbspRoundTrip) {
+  std::vector<uint8_t> rbsp(1000);
+  uint32_t state = 1;
+  for (uint8_t& byte : rbsp) {
+    state = state * 1103515245 + 12345;
+    // Mostly small values to get many sequences needing escaping.
+    byte = (state >> 16) % 5;
+  }
+  Buffer escaped;
+  WriteRbsp(rbsp, &escaped);
+  EXPECT_GT(escaped.size(), rbsp.size());
+  EXPECT_THAT(FindNaluIndices(escaped), IsEmpty());
+  EXPECT_THAT(ParseRbsp(escaped), ElementsAreArray(rbsp));
+}
+
+}  // namespace
+}  // namespace H264
+}  // namespace webrtc
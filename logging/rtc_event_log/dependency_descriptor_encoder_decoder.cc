@@ -30,7 +30,8 @@ namespace webrtc {
 // static
 std::optional<rtclog2::DependencyDescriptorsWireInfo>
 RtcEventLogDependencyDescriptorEncoderDecoder::Encode(
-    const std::vector<ArrayView<const uint8_t>>& raw_dd_data) {
+    const std::vector<ArrayView<const uint8_t>>& raw_dd_data,
+    DeltaEncodingMode delta_encoding_mode) {
   if (raw_dd_data.empty()) {
     return {};
   }
@@ -61,7 +62,8 @@ RtcEventLogDependencyDescriptorEncoderDecoder::Encode(
           values[i] = delta_dds[i][0] >> 6;
         }
       }
-      std::string encoded_deltas = EncodeDeltas(start_end_bit, values);
+      std::string encoded_deltas =
+          EncodeDeltas(start_end_bit, values, delta_encoding_mode);
       if (!encoded_deltas.empty()) {
         res.set_start_end_bit_deltas(encoded_deltas);
       }
@@ -83,7 +85,8 @@ RtcEventLogDependencyDescriptorEncoderDecoder::Encode(
           values[i] = delta_dds[i][0] & 0b0011'1111;
         }
       }
-      std::string encoded_deltas = EncodeDeltas(template_id, values);
+      std::string encoded_deltas =
+          EncodeDeltas(template_id, values, delta_encoding_mode);
       if (!encoded_deltas.empty()) {
         res.set_template_id_deltas(encoded_deltas);
       }
@@ -105,7 +108,8 @@ RtcEventLogDependencyDescriptorEncoderDecoder::Encode(
           values[i] = (uint16_t{delta_dds[i][1]} << 8) + delta_dds[i][2];
         }
       }
-      std::string encoded_deltas = EncodeDeltas(frame_id, values);
+      std::string encoded_deltas =
+          EncodeDeltas(frame_id, values, delta_encoding_mode);
       if (!encoded_deltas.empty()) {
         res.set_frame_id_deltas(encoded_deltas);
       }
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "api/array_view.h"
+#include "logging/rtc_event_log/encoder/delta_encoding.h"
 #include "logging/rtc_event_log/events/rtc_event_log_parse_status.h"
 #include "logging/rtc_event_log/rtc_event_log2_proto_include.h"
 
@@ -24,8 +25,11 @@ namespace webrtc {
 
 class RtcEventLogDependencyDescriptorEncoderDecoder {
  public:
+  // The start/end bits, template ids and frame ids are delta encoded using
+  // `delta_encoding_mode`.
   static std::optional<rtclog2::DependencyDescriptorsWireInfo> Encode(
-      const std::vector<ArrayView<const uint8_t>>& raw_dd_data);
+      const std::vector<ArrayView<const uint8_t>>& raw_dd_data,
+      DeltaEncodingMode delta_encoding_mode = DeltaEncodingMode::kFixedSize);
   static RtcEventLogParseStatusOr<std::vector<std::vector<uint8_t>>> Decode(
       const rtclog2::DependencyDescriptorsWireInfo& dd_wire_info,
       size_t num_packets);
@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 
+#include "api/array_view.h"
 #include "logging/rtc_event_log/encoder/delta_encoding.h"
 #include "logging/rtc_event_log/encoder/optional_blob_encoding.h"
 #include "logging/rtc_event_log/rtc_event_log2_proto_include.h"
@@ -144,6 +145,30 @@ TEST(RtcEventLogDependencyDescriptorEncoding, SomePacketMissingDd) {
   EXPECT_THAT(encoded->frame_id_deltas(), Eq(EncodeDeltas({1}, {{}, {3}})));
 }
 
+TEST(RtcEventLogDependencyDescriptorEncoding, RunLengthDeltas) {
+  // One packet per frame, all using the same template.
+  std::vector<std::vector<uint8_t>> raw_dds;
+  for (uint16_t frame_id = 100; frame_id < 200; ++frame_id) {
+    raw_dds.push_back(DdBuilder().B().E().Tid(1).Fid(frame_id).Build());
+  }
+  std::vector<ArrayView<const uint8_t>> raw_dd_views(raw_dds.begin(),
+                                                     raw_dds.end());
+
+  auto fixed_size = RtcEventLogDependencyDescriptorEncoderDecoder::Encode(
+      raw_dd_views, DeltaEncodingMode::kFixedSize);
+  auto run_length = RtcEventLogDependencyDescriptorEncoderDecoder::Encode(
+      raw_dd_views, DeltaEncodingMode::kAllowRunLength);
+  ASSERT_TRUE(fixed_size.has_value());
+  ASSERT_TRUE(run_length.has_value());
+  EXPECT_LT(run_length->frame_id_deltas().size(),
+            fixed_size->frame_id_deltas().size());
+
+  auto decoded = RtcEventLogDependencyDescriptorEncoderDecoder::Decode(
+      *run_length, raw_dds.size());
+  ASSERT_THAT(decoded.ok(), Eq(true));
+  EXPECT_THAT(decoded.value(), Eq(raw_dds));
+}
+
 TEST(RtcEventLogDependencyDescriptorDecoding, SinglePacket) {
   rtclog2::DependencyDescriptorsWireInfo encoded;
   encoded.set_start_end_bit(kBeginEnd);
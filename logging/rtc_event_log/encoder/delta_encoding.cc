@@ -88,7 +88,7 @@ uint64_t UnsignedDelta(uint64_t previous, uint64_t current, uint64_t bit_mask) {
 enum class EncodingType {
   kFixedSizeUnsignedDeltasNoEarlyWrapNoOpt = 0,
   kFixedSizeSignedDeltasEarlyWrapAndOptSupported = 1,
-  kReserved1 = 2,
+  kFixedSizeDeltasRunLengthEncoded = 2,
   kReserved2 = 3,
   kNumberOfEncodingTypes  // Keep last
 };
@@ -100,6 +100,7 @@ constexpr size_t kBitsInHeaderForDeltaWidthBits = 6;
 constexpr size_t kBitsInHeaderForSignedDeltas = 1;
 constexpr size_t kBitsInHeaderForValuesOptional = 1;
 constexpr size_t kBitsInHeaderForValueWidthBits = 6;
+constexpr size_t kBitsInHeaderForRunLengthWidthBits = 6;
 
 static_assert(static_cast<size_t>(EncodingType::kNumberOfEncodingTypes) <=
                   1 << kBitsInHeaderForEncodingType,
@@ -177,6 +178,9 @@ class FixedLengthEncodingParameters final {
 // (With the exception of optional elements; those are encoded as a bit vector
 // with one bit per element, plus a fixed number of bits for every element that
 // has a value.)
+// If allowed, runs of identical consecutive deltas are written as a run length
+// followed by a single delta, which makes e.g. sequence numbers or timestamps
+// of a constant rate stream take a few bytes regardless of their number.
 class FixedLengthDeltaEncoder final {
  public:
   // See webrtc::EncodeDeltas() for general details.
@@ -186,7 +190,8 @@ class FixedLengthDeltaEncoder final {
   // by a different encoder.
   static std::string EncodeDeltas(
       std::optional<uint64_t> base,
-      const std::vector<std::optional<uint64_t>>& values);
+      const std::vector<std::optional<uint64_t>>& values,
+      DeltaEncodingMode mode);
 
   FixedLengthDeltaEncoder(const FixedLengthDeltaEncoder&) = delete;
   FixedLengthDeltaEncoder& operator=(const FixedLengthDeltaEncoder&) = delete;
@@ -216,7 +221,13 @@ class FixedLengthDeltaEncoder final {
   FixedLengthDeltaEncoder(const FixedLengthEncodingParameters& params,
                           std::optional<uint64_t> base,
                           const std::vector<std::optional<uint64_t>>& values,
-                          size_t existent_values_count);
+                          size_t existent_values_count,
+                          DeltaEncodingMode mode);
+
+  // Groups the deltas into runs of identical consecutive deltas, and keeps
+  // them in `runs_` if writing them that way makes the output shorter.
+  void MaybeUseRunLengthEncoding();
+  bool run_length_encoded() const { return !runs_.empty(); }
 
   // Perform delta-encoding using the parameters given to the ctor on the
   // sequence of values given to the ctor.
@@ -232,8 +243,11 @@ class FixedLengthDeltaEncoder final {
 
   // Encode a given delta into the stream.
   void EncodeDelta(uint64_t previous, uint64_t current);
-  void EncodeUnsignedDelta(uint64_t previous, uint64_t current);
-  void EncodeSignedDelta(uint64_t previous, uint64_t current);
+
+  // Compute the bits with which a given delta is encoded.
+  uint64_t ComputeDelta(uint64_t previous, uint64_t current) const;
+  uint64_t ComputeUnsignedDelta(uint64_t previous, uint64_t current) const;
+  uint64_t ComputeSignedDelta(uint64_t previous, uint64_t current) const;
 
   // The parameters according to which encoding will be done (width of
   // fields, whether signed deltas should be used, etc.)
@@ -248,6 +262,16 @@ class FixedLengthDeltaEncoder final {
   // Note: This is a non-owning reference. See comment above ctor for details.
   const std::vector<std::optional<uint64_t>>& values_;
 
+  // A run of `length` identical consecutive deltas.
+  struct DeltaRun {
+    uint64_t delta;
+    uint64_t length;
+  };
+
+  // Empty unless run-length encoding is used.
+  std::vector<DeltaRun> runs_;
+  uint64_t run_length_width_bits_ = 0;
+
   // Buffer into which encoded values will be written.
   // This is created dynmically as a way to enforce that the rest of the
   // ctor has finished running when this is constructed, so that the lower
@@ -258,7 +282,8 @@ class FixedLengthDeltaEncoder final {
 // TODO(eladalon): Reduce the number of passes.
 std::string FixedLengthDeltaEncoder::EncodeDeltas(
     std::optional<uint64_t> base,
-    const std::vector<std::optional<uint64_t>>& values) {
+    const std::vector<std::optional<uint64_t>>& values,
+    DeltaEncodingMode mode) {
   RTC_DCHECK(!values.empty());
 
   // As a special case, if all of the elements are identical to the base,
@@ -319,7 +344,8 @@ std::string FixedLengthDeltaEncoder::EncodeDeltas(
   ConsiderTestOverrides(&params, delta_width_bits_signed,
                         delta_width_bits_unsigned);
 
-  FixedLengthDeltaEncoder encoder(params, base, values, existent_values_count);
+  FixedLengthDeltaEncoder encoder(params, base, values, existent_values_count,
+                                  mode);
   return encoder.Encode();
 }
 
@@ -395,13 +421,59 @@ FixedLengthDeltaEncoder::FixedLengthDeltaEncoder(
     const FixedLengthEncodingParameters& params,
     std::optional<uint64_t> base,
     const std::vector<std::optional<uint64_t>>& values,
-    size_t existent_values_count)
+    size_t existent_values_count,
+    DeltaEncodingMode mode)
     : params_(params), base_(base), values_(values) {
   RTC_DCHECK(!values_.empty());
+  if (mode == DeltaEncodingMode::kAllowRunLength) {
+    MaybeUseRunLengthEncoding();
+  }
   writer_ =
       std::make_unique<BitWriter>(OutputLengthBytes(existent_values_count));
 }
 
+void FixedLengthDeltaEncoder::MaybeUseRunLengthEncoding() {
+  RTC_DCHECK(runs_.empty());
+  std::vector<DeltaRun> runs;
+  uint64_t deltas_count = 0;
+  uint64_t max_run_length = 0;
+  std::optional<uint64_t> previous = base_;
+  for (std::optional<uint64_t> value : values_) {
+    if (!value.has_value()) {
+      continue;
+    }
+    if (previous.has_value()) {
+      const uint64_t delta = ComputeDelta(previous.value(), value.value());
+      if (!runs.empty() && runs.back().delta == delta) {
+        ++runs.back().length;
+      } else {
+        runs.push_back({delta, 1});
+      }
+      max_run_length = std::max(max_run_length, runs.back().length);
+      ++deltas_count;
+    }
+    previous = value;
+  }
+  if (runs.empty()) {
+    return;
+  }
+
+  // The existence bitmap and the leading varint (if any) are the same for
+  // both encodings.
+  const uint64_t run_length_width_bits = UnsignedBitWidth(max_run_length - 1);
+  const size_t fixed_size_bits =
+      HeaderLengthBits() + deltas_count * params_.delta_width_bits();
+  const size_t run_length_bits =
+      kBitsInHeaderForEncodingType + kBitsInHeaderForDeltaWidthBits +
+      kBitsInHeaderForSignedDeltas + kBitsInHeaderForValuesOptional +
+      kBitsInHeaderForValueWidthBits + kBitsInHeaderForRunLengthWidthBits +
+      runs.size() * (run_length_width_bits + params_.delta_width_bits());
+  if (run_length_bits < fixed_size_bits) {
+    runs_ = std::move(runs);
+    run_length_width_bits_ = run_length_width_bits;
+  }
+}
+
 std::string FixedLengthDeltaEncoder::Encode() {
   EncodeHeader();
 
@@ -424,13 +496,20 @@ std::string FixedLengthDeltaEncoder::Encode() {
       // a varint, rather than as a delta.
       RTC_DCHECK(!base_.has_value());
       writer_->WriteBits(EncodeVarInt(value.value()));
-    } else {
+    } else if (!run_length_encoded()) {
       EncodeDelta(previous.value(), value.value());
     }
 
     previous = value;
   }
 
+  // Note: When run-length encoded, the leading varint (if any) was written
+  // by the loop above, and the runs cover the deltas of all the other values.
+  for (const DeltaRun& run : runs_) {
+    writer_->WriteBits(run.length - 1, run_length_width_bits_);
+    writer_->WriteBits(run.delta, params_.delta_width_bits());
+  }
+
   return writer_->GetString();
 }
 
@@ -441,7 +520,11 @@ size_t FixedLengthDeltaEncoder::OutputLengthBytes(
 }
 
 size_t FixedLengthDeltaEncoder::HeaderLengthBits() const {
-  if (params_.signed_deltas() == kDefaultSignedDeltas &&
+  if (run_length_encoded()) {
+    return kBitsInHeaderForEncodingType + kBitsInHeaderForDeltaWidthBits +
+           kBitsInHeaderForSignedDeltas + kBitsInHeaderForValuesOptional +
+           kBitsInHeaderForValueWidthBits + kBitsInHeaderForRunLengthWidthBits;
+  } else if (params_.signed_deltas() == kDefaultSignedDeltas &&
       params_.values_optional() == kDefaultValuesOptional &&
       params_.value_width_bits() == kDefaultValueWidthBits) {
     return kBitsInHeaderForEncodingType + kBitsInHeaderForDeltaWidthBits;
@@ -454,7 +537,18 @@ size_t FixedLengthDeltaEncoder::HeaderLengthBits() const {
 
 size_t FixedLengthDeltaEncoder::EncodedDeltasLengthBits(
     size_t existent_values_count) const {
-  if (!params_.values_optional()) {
+  if (run_length_encoded()) {
+    // Existence bitmap and leading varint as below, then one run length and
+    // one delta for each run.
+    const size_t existence_bitmap_size_bits =
+        params_.values_optional() ? values_.size() : 0;
+    const size_t first_value_varint_size_bits =
+        base_.has_value() ? 0 : 8 * kMaxVarIntLengthBytes;
+    const size_t runs_size_bits =
+        runs_.size() * (run_length_width_bits_ + params_.delta_width_bits());
+    return existence_bitmap_size_bits + first_value_varint_size_bits +
+           runs_size_bits;
+  } else if (!params_.values_optional()) {
     return values_.size() * params_.delta_width_bits();
   } else {
     RTC_DCHECK_EQ(std::count_if(values_.begin(), values_.end(),
@@ -480,12 +574,17 @@ size_t FixedLengthDeltaEncoder::EncodedDeltasLengthBits(
 void FixedLengthDeltaEncoder::EncodeHeader() {
   RTC_DCHECK(writer_);
 
-  const EncodingType encoding_type =
-      (params_.value_width_bits() == kDefaultValueWidthBits &&
-       params_.signed_deltas() == kDefaultSignedDeltas &&
-       params_.values_optional() == kDefaultValuesOptional)
-          ? EncodingType::kFixedSizeUnsignedDeltasNoEarlyWrapNoOpt
-          : EncodingType::kFixedSizeSignedDeltasEarlyWrapAndOptSupported;
+  EncodingType encoding_type;
+  if (run_length_encoded()) {
+    encoding_type = EncodingType::kFixedSizeDeltasRunLengthEncoded;
+  } else if (params_.value_width_bits() == kDefaultValueWidthBits &&
+             params_.signed_deltas() == kDefaultSignedDeltas &&
+             params_.values_optional() == kDefaultValuesOptional) {
+    encoding_type = EncodingType::kFixedSizeUnsignedDeltasNoEarlyWrapNoOpt;
+  } else {
+    encoding_type =
+        EncodingType::kFixedSizeSignedDeltasEarlyWrapAndOptSupported;
+  }
 
   writer_->WriteBits(static_cast<uint64_t>(encoding_type),
                      kBitsInHeaderForEncodingType);
@@ -506,27 +605,36 @@ void FixedLengthDeltaEncoder::EncodeHeader() {
                      kBitsInHeaderForValuesOptional);
   writer_->WriteBits(params_.value_width_bits() - 1,
                      kBitsInHeaderForValueWidthBits);
+
+  if (encoding_type == EncodingType::kFixedSizeDeltasRunLengthEncoded) {
+    writer_->WriteBits(run_length_width_bits_ - 1,
+                       kBitsInHeaderForRunLengthWidthBits);
+  }
 }
 
 void FixedLengthDeltaEncoder::EncodeDelta(uint64_t previous, uint64_t current) {
+  RTC_DCHECK(writer_);
+  writer_->WriteBits(ComputeDelta(previous, current),
+                     params_.delta_width_bits());
+}
+
+uint64_t FixedLengthDeltaEncoder::ComputeDelta(uint64_t previous,
+                                               uint64_t current) const {
   if (params_.signed_deltas()) {
-    EncodeSignedDelta(previous, current);
+    return ComputeSignedDelta(previous, current);
   } else {
-    EncodeUnsignedDelta(previous, current);
+    return ComputeUnsignedDelta(previous, current);
   }
 }
 
-void FixedLengthDeltaEncoder::EncodeUnsignedDelta(uint64_t previous,
-                                                  uint64_t current) {
-  RTC_DCHECK(writer_);
-  const uint64_t delta = UnsignedDelta(previous, current, params_.value_mask());
-  writer_->WriteBits(delta, params_.delta_width_bits());
+uint64_t FixedLengthDeltaEncoder::ComputeUnsignedDelta(
+    uint64_t previous,
+    uint64_t current) const {
+  return UnsignedDelta(previous, current, params_.value_mask());
 }
 
-void FixedLengthDeltaEncoder::EncodeSignedDelta(uint64_t previous,
-                                                uint64_t current) {
-  RTC_DCHECK(writer_);
-
+uint64_t FixedLengthDeltaEncoder::ComputeSignedDelta(uint64_t previous,
+                                                     uint64_t current) const {
   const uint64_t forward_delta =
       UnsignedDelta(previous, current, params_.value_mask());
   const uint64_t backward_delta =
@@ -545,7 +653,7 @@ void FixedLengthDeltaEncoder::EncodeSignedDelta(uint64_t previous,
     RTC_DCHECK_LE(delta, params_.delta_mask());
   }
 
-  writer_->WriteBits(delta, params_.delta_width_bits());
+  return delta;
 }
 
 // Perform decoding of a a delta-encoded stream, extracting the original
@@ -593,6 +701,7 @@ class FixedLengthDeltaDecoder final {
   // of `reader`'s underlying buffer.
   FixedLengthDeltaDecoder(BitstreamReader reader,
                           const FixedLengthEncodingParameters& params,
+                          uint64_t run_length_width_bits,
                           std::optional<uint64_t> base,
                           size_t num_of_deltas);
 
@@ -617,6 +726,9 @@ class FixedLengthDeltaDecoder final {
   // fields, whether signed deltas should be used, etc.)
   const FixedLengthEncodingParameters params_;
 
+  // Width of the run lengths if the deltas are run-length encoded, else 0.
+  const uint64_t run_length_width_bits_;
+
   // The encoding scheme assumes that at least one value is transmitted OOB,
   // so that the first value can be encoded as a delta from that OOB value,
   // which is `base_`.
@@ -637,7 +749,8 @@ bool FixedLengthDeltaDecoder::IsSuitableDecoderFor(absl::string_view input) {
   return encoding_type ==
              EncodingType::kFixedSizeUnsignedDeltasNoEarlyWrapNoOpt ||
          encoding_type ==
-             EncodingType::kFixedSizeSignedDeltasEarlyWrapAndOptSupported;
+             EncodingType::kFixedSizeSignedDeltasEarlyWrapAndOptSupported ||
+         encoding_type == EncodingType::kFixedSizeDeltasRunLengthEncoded;
 }
 
 std::vector<std::optional<uint64_t>> FixedLengthDeltaDecoder::DecodeDeltas(
@@ -666,7 +779,8 @@ std::unique_ptr<FixedLengthDeltaDecoder> FixedLengthDeltaDecoder::Create(
   const EncodingType encoding = static_cast<EncodingType>(encoding_type_bits);
   if (encoding != EncodingType::kFixedSizeUnsignedDeltasNoEarlyWrapNoOpt &&
       encoding !=
-          EncodingType::kFixedSizeSignedDeltasEarlyWrapAndOptSupported) {
+          EncodingType::kFixedSizeSignedDeltasEarlyWrapAndOptSupported &&
+      encoding != EncodingType::kFixedSizeDeltasRunLengthEncoded) {
     RTC_LOG(LS_WARNING) << "Unrecognized encoding type.";
     return nullptr;
   }
@@ -692,6 +806,14 @@ std::unique_ptr<FixedLengthDeltaDecoder> FixedLengthDeltaDecoder::Create(
     RTC_DCHECK_LE(value_width_bits, 64);
   }
 
+  uint64_t run_length_width_bits = 0;
+  if (encoding == EncodingType::kFixedSizeDeltasRunLengthEncoded) {
+    // See encoding for +1's rationale.
+    run_length_width_bits =
+        reader.ReadBits(kBitsInHeaderForRunLengthWidthBits) + 1;
+    RTC_DCHECK_LE(run_length_width_bits, 64);
+  }
+
   if (!reader.Ok()) {
     return nullptr;
   }
@@ -707,17 +829,19 @@ std::unique_ptr<FixedLengthDeltaDecoder> FixedLengthDeltaDecoder::Create(
 
   FixedLengthEncodingParameters params(delta_width_bits, signed_deltas,
                                        values_optional, value_width_bits);
-  return absl::WrapUnique(
-      new FixedLengthDeltaDecoder(reader, params, base, num_of_deltas));
+  return absl::WrapUnique(new FixedLengthDeltaDecoder(
+      reader, params, run_length_width_bits, base, num_of_deltas));
 }
 
 FixedLengthDeltaDecoder::FixedLengthDeltaDecoder(
     BitstreamReader reader,
     const FixedLengthEncodingParameters& params,
+    uint64_t run_length_width_bits,
     std::optional<uint64_t> base,
     size_t num_of_deltas)
     : reader_(reader),
       params_(params),
+      run_length_width_bits_(run_length_width_bits),
       base_(base),
       num_of_deltas_(num_of_deltas) {
   RTC_DCHECK(reader_.Ok());
@@ -737,6 +861,10 @@ std::vector<std::optional<uint64_t>> FixedLengthDeltaDecoder::Decode() {
   std::optional<uint64_t> previous = base_;
   std::vector<std::optional<uint64_t>> values(num_of_deltas_);
 
+  // Remainder of the current run, if run-length encoded.
+  uint64_t run_delta = 0;
+  uint64_t run_remaining = 0;
+
   for (size_t i = 0; i < num_of_deltas_; ++i) {
     if (!existing_values[i]) {
       RTC_DCHECK(params_.values_optional());
@@ -748,9 +876,16 @@ std::vector<std::optional<uint64_t>> FixedLengthDeltaDecoder::Decode() {
       // a varint, rather than as a delta.
       RTC_DCHECK(!base_.has_value());
       values[i] = DecodeVarInt(reader_);
-    } else {
+    } else if (run_length_width_bits_ == 0) {
       uint64_t delta = reader_.ReadBits(params_.delta_width_bits());
       values[i] = ApplyDelta(*previous, delta);
+    } else {
+      if (run_remaining == 0) {
+        run_remaining = reader_.ReadBits(run_length_width_bits_) + 1;
+        run_delta = reader_.ReadBits(params_.delta_width_bits());
+      }
+      --run_remaining;
+      values[i] = ApplyDelta(*previous, run_delta);
     }
 
     previous = values[i];
@@ -800,9 +935,10 @@ uint64_t FixedLengthDeltaDecoder::ApplySignedDelta(uint64_t base,
 }  // namespace
 
 std::string EncodeDeltas(std::optional<uint64_t> base,
-                         const std::vector<std::optional<uint64_t>>& values) {
+                         const std::vector<std::optional<uint64_t>>& values,
+                         DeltaEncodingMode mode) {
   // TODO(eladalon): Support additional encodings.
-  return FixedLengthDeltaEncoder::EncodeDeltas(base, values);
+  return FixedLengthDeltaEncoder::EncodeDeltas(base, values, mode);
 }
 
 std::vector<std::optional<uint64_t>> DecodeDeltas(absl::string_view input,
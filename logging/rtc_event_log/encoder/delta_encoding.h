@@ -22,6 +22,16 @@
 
 namespace webrtc {
 
+enum class DeltaEncodingMode {
+  // All deltas are written with the same number of bits.
+  kFixedSize,
+  // Like kFixedSize, but runs of identical consecutive deltas are written
+  // once, together with the length of the run, if that is shorter. Streams
+  // written this way can not be decoded by versions of DecodeDeltas() that
+  // predate this mode.
+  kAllowRunLength,
+};
+
 // Encode `values` as a sequence of deltas following on `base` and return it.
 // If all of the values were equal to the base, an empty string will be
 // returned; this is a valid encoding of that edge case.
@@ -29,8 +39,10 @@ namespace webrtc {
 // be provided separately to the decoder.
 // This function never fails.
 // TODO(eladalon): Split into optional and non-optional variants (efficiency).
-std::string EncodeDeltas(std::optional<uint64_t> base,
-                         const std::vector<std::optional<uint64_t>>& values);
+std::string EncodeDeltas(
+    std::optional<uint64_t> base,
+    const std::vector<std::optional<uint64_t>>& values,
+    DeltaEncodingMode mode = DeltaEncodingMode::kFixedSize);
 
 // EncodeDeltas() and DecodeDeltas() are inverse operations;
 // invoking DecodeDeltas() over the output of EncodeDeltas(), will return
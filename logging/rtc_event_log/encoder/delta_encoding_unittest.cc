@@ -74,6 +74,8 @@ uint64_t RandomWithMaxBitWidth(Random* prng, uint64_t max_width) {
 // that it is equal to the original input.
 // If `encoded_string` is non-null, the encoded result will also be written
 // into it.
+// The same is checked for the run-length encoding, which may never produce a
+// longer output.
 void TestEncodingAndDecoding(std::optional<uint64_t> base,
                              const std::vector<std::optional<uint64_t>>& values,
                              std::string* encoded_string = nullptr) {
@@ -86,6 +88,11 @@ void TestEncodingAndDecoding(std::optional<uint64_t> base,
       DecodeDeltas(encoded, base, values.size());
 
   EXPECT_EQ(decoded, values);
+
+  const std::string run_length_encoded =
+      EncodeDeltas(base, values, DeltaEncodingMode::kAllowRunLength);
+  EXPECT_LE(run_length_encoded.size(), encoded.size());
+  EXPECT_EQ(DecodeDeltas(run_length_encoded, base, values.size()), values);
 }
 
 std::vector<std::optional<uint64_t>> CreateSequenceByFirstValue(
@@ -625,6 +632,39 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Bool(),
         ::testing::Values(21, 22, 23)));
 
+TEST(DeltaEncodingRunLengthTest, ConstantDeltasAreWrittenOnce) {
+  const std::optional<uint64_t> base(1000);
+  const std::vector<std::optional<uint64_t>> values =
+      CreateSequenceByFirstValue(base.value() + 1, 10000);
+
+  std::string encoded;
+  TestEncodingAndDecoding(base, values, &encoded);
+  const std::string run_length_encoded =
+      EncodeDeltas(base, values, DeltaEncodingMode::kAllowRunLength);
+  // One bit per delta when using fixed-size deltas, versus a header and a
+  // single run.
+  EXPECT_GE(encoded.size(), 10000u / 8);
+  EXPECT_LE(run_length_encoded.size(), 8u);
+}
+
+TEST(DeltaEncodingRunLengthTest, RunsOfDeltasWithMissingValues) {
+  // Mimics RTP timestamps of a video stream, where several packets belong to
+  // the same frame, with a few values missing.
+  const std::optional<uint64_t> base(90000);
+  std::vector<std::optional<uint64_t>> values;
+  uint64_t timestamp = base.value();
+  for (int frame = 0; frame < 100; ++frame) {
+    timestamp += 3000;
+    for (int packet = 0; packet < 5; ++packet) {
+      values.push_back(frame % 7 == 3 && packet == 2
+                           ? std::nullopt
+                           : std::optional<uint64_t>(timestamp));
+    }
+  }
+  TestEncodingAndDecoding(base, values);
+  TestEncodingAndDecoding(std::nullopt, values);
+}
+
 class DeltaEncodingSpecificEdgeCasesTest
     : public ::testing::TestWithParam<
           std::tuple<DeltaSignedness, uint64_t, bool>> {
@@ -0,0 +1,111 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "api/field_trials.h"
+#include "api/rtc_event_log/rtc_event.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "logging/rtc_event_log/encoder/rtc_event_log_encoder_new_format.h"
+#include "logging/rtc_event_log/events/rtc_event_rtcp_packet_incoming.h"
+#include "logging/rtc_event_log/events/rtc_event_rtp_packet_outgoing.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/receiver_report.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/fake_clock.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+namespace {
+
+// Five seconds, i.e. the default output period, of a 2.5 Mbps video stream
+// at 30 fps along with its receiver reports.
+constexpr int kFramesPerSecond = 30;
+constexpr int kPacketsPerFrame = 8;
+constexpr int kNumFrames = 5 * kFramesPerSecond;
+constexpr int kFramesPerReceiverReport = 3;
+constexpr uint32_t kSsrc = 0x1234;
+
+std::deque<std::unique_ptr<RtcEvent>> CreateVideoCallBatch() {
+  ScopedBaseFakeClock clock;
+  clock.SetTime(Timestamp::Seconds(1000));
+  RtpHeaderExtensionMap extensions;
+  extensions.Register<TransportSequenceNumber>(1);
+  extensions.Register<AbsoluteSendTime>(2);
+
+  std::deque<std::unique_ptr<RtcEvent>> events;
+  uint16_t sequence_number = 0;
+  uint32_t rtp_timestamp = 0;
+  for (int frame = 0; frame < kNumFrames; ++frame) {
+    rtp_timestamp += 90000 / kFramesPerSecond;
+    for (int i = 0; i < kPacketsPerFrame; ++i) {
+      RtpPacketToSend packet(&extensions);
+      packet.SetSsrc(kSsrc);
+      packet.SetPayloadType(96);
+      packet.SetSequenceNumber(sequence_number);
+      packet.SetTimestamp(rtp_timestamp);
+      packet.SetMarker(i == kPacketsPerFrame - 1);
+      packet.SetExtension<TransportSequenceNumber>(sequence_number);
+      packet.SetExtension<AbsoluteSendTime>(
+          AbsoluteSendTime::To24Bits(Timestamp::Micros(TimeMicros())));
+      packet.SetPayloadSize(1200);
+      ++sequence_number;
+      events.push_back(std::make_unique<RtcEventRtpPacketOutgoing>(
+          packet, /*probe_cluster_id=*/0));
+      clock.AdvanceTime(TimeDelta::Millis(2));
+    }
+    if (frame % kFramesPerReceiverReport == 0) {
+      rtcp::ReportBlock report_block;
+      report_block.SetMediaSsrc(kSsrc);
+      report_block.SetExtHighestSeqNum(sequence_number);
+      rtcp::ReceiverReport receiver_report;
+      receiver_report.SetSenderSsrc(kSsrc + 1);
+      receiver_report.AddReportBlock(report_block);
+      Buffer rtcp_packet = receiver_report.Build();
+      events.push_back(std::make_unique<RtcEventRtcpPacketIncoming>(
+          rtcp_packet));
+    }
+    clock.AdvanceTime(TimeDelta::Seconds(1) / kFramesPerSecond -
+                      kPacketsPerFrame * TimeDelta::Millis(2));
+  }
+  return events;
+}
+
+void BM_EncodeBatch(benchmark::State& state) {
+  const std::deque<std::unique_ptr<RtcEvent>> events = CreateVideoCallBatch();
+  FieldTrials field_trials(state.range(0)
+                               ? "WebRTC-RtcEventLogRunLengthDeltas/Enabled/"
+                               : "");
+  RtcEventLogEncoderNewFormat encoder(field_trials);
+  size_t encoded_size = 0;
+  for (auto _ : state) {
+    std::string encoded = encoder.EncodeBatch(events.begin(), events.end());
+    encoded_size = encoded.size();
+    benchmark::DoNotOptimize(encoded);
+  }
+  state.SetItemsProcessed(state.iterations() * events.size());
+  state.counters["bytes_per_event"] =
+      static_cast<double>(encoded_size) / events.size();
+}
+
+// 0 encodes fixed-size deltas, 1 allows run-length encoded deltas.
+BENCHMARK(BM_EncodeBatch)->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace webrtc
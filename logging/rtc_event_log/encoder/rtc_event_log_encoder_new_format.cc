@@ -344,6 +344,7 @@ size_t RemoveNonAllowlistedRtcpBlocks(const Buffer& packet, uint8_t* buffer) {
 
 template <typename EventType, typename ProtoType>
 void EncodeRtcpPacket(ArrayView<const EventType*> batch,
+                      DeltaEncodingMode delta_encoding_mode,
                       ProtoType* proto_batch) {
   if (batch.empty()) {
     return;
@@ -373,12 +374,16 @@ void EncodeRtcpPacket(ArrayView<const EventType*> batch,
     const EventType* event = batch[i + 1];
     values[i] = ToUnsigned(event->timestamp_ms());
   }
-  encoded_deltas = EncodeDeltas(ToUnsigned(base_event->timestamp_ms()), values);
+  encoded_deltas = EncodeDeltas(ToUnsigned(base_event->timestamp_ms()), values,
+                                delta_encoding_mode);
   if (!encoded_deltas.empty()) {
     proto_batch->set_timestamp_ms_deltas(encoded_deltas);
   }
 
   // raw_packet
+  // The allowlisted blocks are stored as is. Encoding their fields as columns
+  // would need a proto message per RTCP block type, which parsers that predate
+  // it could not read, and run-length deltas do not apply to opaque blobs.
   std::vector<std::string> scrubed_packets(batch.size() - 1);
   for (size_t i = 0; i < scrubed_packets.size(); ++i) {
     const EventType* event = batch[i + 1];
@@ -482,7 +487,7 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
       if (has_dd) {
         if (auto dd_encoded =
                 RtcEventLogDependencyDescriptorEncoderDecoder::Encode(
-                    raw_dds)) {
+                    raw_dds, delta_encoding_mode_)) {
           *proto_batch->mutable_dependency_descriptor() = *dd_encoded;
         }
       }
@@ -503,7 +508,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
     const EventType* event = batch[i + 1];
     values[i] = ToUnsigned(event->timestamp_ms());
   }
-  encoded_deltas = EncodeDeltas(ToUnsigned(base_event->timestamp_ms()), values);
+  encoded_deltas = EncodeDeltas(ToUnsigned(base_event->timestamp_ms()), values,
+                                delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_timestamp_ms_deltas(encoded_deltas);
   }
@@ -513,7 +519,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
     const EventType* event = batch[i + 1];
     values[i] = event->Marker();
   }
-  encoded_deltas = EncodeDeltas(base_event->Marker(), values);
+  encoded_deltas =
+      EncodeDeltas(base_event->Marker(), values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_marker_deltas(encoded_deltas);
   }
@@ -523,7 +530,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
     const EventType* event = batch[i + 1];
     values[i] = event->PayloadType();
   }
-  encoded_deltas = EncodeDeltas(base_event->PayloadType(), values);
+  encoded_deltas =
+      EncodeDeltas(base_event->PayloadType(), values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_payload_type_deltas(encoded_deltas);
   }
@@ -533,7 +541,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
     const EventType* event = batch[i + 1];
     values[i] = event->SequenceNumber();
   }
-  encoded_deltas = EncodeDeltas(base_event->SequenceNumber(), values);
+  encoded_deltas =
+      EncodeDeltas(base_event->SequenceNumber(), values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_sequence_number_deltas(encoded_deltas);
   }
@@ -543,7 +552,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
     const EventType* event = batch[i + 1];
     values[i] = event->Timestamp();
   }
-  encoded_deltas = EncodeDeltas(base_event->Timestamp(), values);
+  encoded_deltas =
+      EncodeDeltas(base_event->Timestamp(), values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_rtp_timestamp_deltas(encoded_deltas);
   }
@@ -553,7 +563,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
     const EventType* event = batch[i + 1];
     values[i] = event->Ssrc();
   }
-  encoded_deltas = EncodeDeltas(base_event->Ssrc(), values);
+  encoded_deltas =
+      EncodeDeltas(base_event->Ssrc(), values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_ssrc_deltas(encoded_deltas);
   }
@@ -563,7 +574,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
     const EventType* event = batch[i + 1];
     values[i] = event->payload_length();
   }
-  encoded_deltas = EncodeDeltas(base_event->payload_length(), values);
+  encoded_deltas =
+      EncodeDeltas(base_event->payload_length(), values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_payload_size_deltas(encoded_deltas);
   }
@@ -573,7 +585,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
     const EventType* event = batch[i + 1];
     values[i] = event->header_length();
   }
-  encoded_deltas = EncodeDeltas(base_event->header_length(), values);
+  encoded_deltas =
+      EncodeDeltas(base_event->header_length(), values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_header_size_deltas(encoded_deltas);
   }
@@ -583,7 +596,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
     const EventType* event = batch[i + 1];
     values[i] = event->padding_length();
   }
-  encoded_deltas = EncodeDeltas(base_event->padding_length(), values);
+  encoded_deltas =
+      EncodeDeltas(base_event->padding_length(), values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_padding_size_deltas(encoded_deltas);
   }
@@ -598,7 +612,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
       values[i].reset();
     }
   }
-  encoded_deltas = EncodeDeltas(base_transport_sequence_number, values);
+  encoded_deltas = EncodeDeltas(base_transport_sequence_number, values,
+                                delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_transport_sequence_number_deltas(encoded_deltas);
   }
@@ -613,7 +628,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
       values[i].reset();
     }
   }
-  encoded_deltas = EncodeDeltas(unsigned_base_transmission_time_offset, values);
+  encoded_deltas = EncodeDeltas(unsigned_base_transmission_time_offset, values,
+                                delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_transmission_time_offset_deltas(encoded_deltas);
   }
@@ -628,7 +644,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
       values[i].reset();
     }
   }
-  encoded_deltas = EncodeDeltas(base_absolute_send_time, values);
+  encoded_deltas =
+      EncodeDeltas(base_absolute_send_time, values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_absolute_send_time_deltas(encoded_deltas);
   }
@@ -643,7 +660,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
       values[i].reset();
     }
   }
-  encoded_deltas = EncodeDeltas(base_video_rotation, values);
+  encoded_deltas =
+      EncodeDeltas(base_video_rotation, values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_video_rotation_deltas(encoded_deltas);
   }
@@ -659,7 +677,7 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
       values[i].reset();
     }
   }
-  encoded_deltas = EncodeDeltas(base_audio_level, values);
+  encoded_deltas = EncodeDeltas(base_audio_level, values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_audio_level_deltas(encoded_deltas);
   }
@@ -675,7 +693,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtpPacket(const Batch& batch,
       values[i].reset();
     }
   }
-  encoded_deltas = EncodeDeltas(base_voice_activity, values);
+  encoded_deltas =
+      EncodeDeltas(base_voice_activity, values, delta_encoding_mode_);
   if (!encoded_deltas.empty()) {
     proto_batch->set_voice_activity_deltas(encoded_deltas);
   }
@@ -686,7 +705,11 @@ RtcEventLogEncoderNewFormat::RtcEventLogEncoderNewFormat(
     : encode_neteq_set_minimum_delay_kill_switch_(field_trials.IsEnabled(
           "WebRTC-RtcEventLogEncodeNetEqSetMinimumDelayKillSwitch")),
       encode_dependency_descriptor_(!field_trials.IsDisabled(
-          "WebRTC-RtcEventLogEncodeDependencyDescriptor")) {}
+          "WebRTC-RtcEventLogEncodeDependencyDescriptor")),
+      delta_encoding_mode_(
+          field_trials.IsEnabled("WebRTC-RtcEventLogRunLengthDeltas")
+              ? DeltaEncodingMode::kAllowRunLength
+              : DeltaEncodingMode::kFixedSize) {}
 
 std::string RtcEventLogEncoderNewFormat::EncodeLogStart(int64_t timestamp_us,
                                                         int64_t utc_time_us) {
@@ -1543,7 +1566,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtcpPacketIncoming(
   if (batch.empty()) {
     return;
   }
-  EncodeRtcpPacket(batch, event_stream->add_incoming_rtcp_packets());
+  EncodeRtcpPacket(batch, delta_encoding_mode_,
+                   event_stream->add_incoming_rtcp_packets());
 }
 
 void RtcEventLogEncoderNewFormat::EncodeRtcpPacketOutgoing(
@@ -1552,7 +1576,8 @@ void RtcEventLogEncoderNewFormat::EncodeRtcpPacketOutgoing(
   if (batch.empty()) {
     return;
   }
-  EncodeRtcpPacket(batch, event_stream->add_outgoing_rtcp_packets());
+  EncodeRtcpPacket(batch, delta_encoding_mode_,
+                   event_stream->add_outgoing_rtcp_packets());
 }
 
 void RtcEventLogEncoderNewFormat::EncodeRtpPacketIncoming(
@@ -21,6 +21,7 @@
 #include "api/array_view.h"
 #include "api/field_trials_view.h"
 #include "api/rtc_event_log/rtc_event.h"
+#include "logging/rtc_event_log/encoder/delta_encoding.h"
 #include "logging/rtc_event_log/encoder/rtc_event_log_encoder.h"
 
 namespace webrtc {
@@ -162,6 +163,12 @@ class RtcEventLogEncoderNewFormat final : public RtcEventLogEncoder {
 
   const bool encode_neteq_set_minimum_delay_kill_switch_;
   const bool encode_dependency_descriptor_;
+  // RTP and RTCP packet fields, including the RTP header extensions and the
+  // dependency descriptor fields, are run-length encoded where that is smaller.
+  // Such logs can only be parsed by parsers that support it. Columns never
+  // span more than one call to EncodeBatch(), so that every batch can be
+  // decoded on its own, e.g. by incremental parsing or from a truncated log.
+  const DeltaEncodingMode delta_encoding_mode_;
 };
 
 }  // namespace webrtc
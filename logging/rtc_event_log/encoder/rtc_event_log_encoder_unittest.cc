@@ -1393,6 +1393,20 @@ TEST_P(RtcEventLogEncoderTest,
   TestRtpPackets<RtcEventRtpPacketOutgoing, LoggedRtpPacketOutgoing>(*encoder);
 }
 
+TEST_P(RtcEventLogEncoderTest, RtcEventRtpPacketIncomingRunLengthDeltas) {
+  ExplicitKeyValueConfig run_length(
+      "WebRTC-RtcEventLogRunLengthDeltas/Enabled/");
+  std::unique_ptr<RtcEventLogEncoder> encoder = CreateEncoder(run_length);
+  TestRtpPackets<RtcEventRtpPacketIncoming, LoggedRtpPacketIncoming>(*encoder);
+}
+
+TEST_P(RtcEventLogEncoderTest, RtcEventRtpPacketOutgoingRunLengthDeltas) {
+  ExplicitKeyValueConfig run_length(
+      "WebRTC-RtcEventLogRunLengthDeltas/Enabled/");
+  std::unique_ptr<RtcEventLogEncoder> encoder = CreateEncoder(run_length);
+  TestRtpPackets<RtcEventRtpPacketOutgoing, LoggedRtpPacketOutgoing>(*encoder);
+}
+
 // TODO(eladalon/terelius): Test with multiple events in the batch.
 TEST_P(RtcEventLogEncoderTest, RtcEventVideoReceiveStreamConfig) {
   std::unique_ptr<RtcEventLogEncoder> encoder = CreateEncoder();
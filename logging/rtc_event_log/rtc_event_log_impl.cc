@@ -108,6 +108,8 @@ bool RtcEventLogImpl::StartLogging(std::unique_ptr<RtcEventLogOutput> output,
   logging_state_started_ = true;
   immediately_output_mode_ = (output_period_ms == kImmediateOutput);
   need_schedule_output_ = (output_period_ms != kImmediateOutput);
+  immediate_output_pending_ = false;
+  ++session_id_;
 
   // Binding to `this` is safe because `this` outlives the `task_queue_`.
   task_queue_->PostTask([this, output_period_ms, timestamp_us, utc_time_us,
@@ -158,6 +160,8 @@ void RtcEventLogImpl::StopLogging(std::function<void()> callback) {
   RTC_DCHECK_RUN_ON(&logging_state_checker_);
   MutexLock lock(&mutex_);
   logging_state_started_ = false;
+  immediate_output_pending_ = false;
+  ++session_id_;
   task_queue_->PostTask(
       [this, callback, histories = ExtractRecentHistories()]() mutable {
         RTC_DCHECK_RUN_ON(task_queue_.get());
@@ -178,11 +182,26 @@ RtcEventLogImpl::EventHistories RtcEventLogImpl::ExtractRecentHistories() {
 
 void RtcEventLogImpl::Log(std::unique_ptr<RtcEvent> event) {
   RTC_CHECK(event);
-  MutexLock lock(&mutex_);
-
-  LogToMemory(std::move(event));
-  if (logging_state_started_) {
-    if (ShouldOutputImmediately()) {
+  bool post_immediate_output = false;
+  bool post_schedule_output = false;
+  uint64_t session_id;
+  {
+    MutexLock lock(&mutex_);
+    LogToMemory(std::move(event));
+    if (!logging_state_started_) {
+      return;
+    }
+    session_id = session_id_;
+    if (immediately_output_mode_) {
+      // Only the first event since the last output posts a task; the events
+      // logged before it runs are encoded together with it.
+      post_immediate_output = !immediate_output_pending_;
+      immediate_output_pending_ = true;
+    } else if (recent_.history.size() >= max_events_in_history_) {
+      // We have to emergency drain the buffer. We can't wait for the scheduled
+      // output task because there might be other event incoming before that.
+      // The histories are extracted while holding the lock so that batches
+      // are output in the order they were logged.
       // Binding to `this` is safe because `this` outlives the `task_queue_`.
       task_queue_->PostTask(
           [this, histories = ExtractRecentHistories()]() mutable {
@@ -194,44 +213,81 @@ void RtcEventLogImpl::Log(std::unique_ptr<RtcEvent> event) {
           });
     } else if (need_schedule_output_) {
       need_schedule_output_ = false;
-      // Binding to `this` is safe because `this` outlives the `task_queue_`.
-      task_queue_->PostTask([this]() mutable {
-        RTC_DCHECK_RUN_ON(task_queue_.get());
-        if (event_output_) {
-          RTC_DCHECK(event_output_->IsActive());
-          ScheduleOutput();
-        }
-      });
+      post_schedule_output = true;
     }
   }
-}
 
-bool RtcEventLogImpl::ShouldOutputImmediately() {
-  if (recent_.history.size() >= max_events_in_history_) {
-    // We have to emergency drain the buffer. We can't wait for the scheduled
-    // output task because there might be other event incoming before that.
-    return true;
+  // The remaining tasks do not carry any events, so they are posted without
+  // holding `mutex_` to keep other threads from waiting on the task queue.
+  // Logging may be started or stopped before they are posted, so they check
+  // `session_id` when they run.
+  // Binding to `this` is safe because `this` outlives the `task_queue_`.
+  if (post_immediate_output) {
+    task_queue_->PostTask([this, session_id] {
+      RTC_DCHECK_RUN_ON(task_queue_.get());
+      LogRecentHistoriesToOutput(session_id);
+    });
+  } else if (post_schedule_output) {
+    task_queue_->PostTask([this, session_id] {
+      RTC_DCHECK_RUN_ON(task_queue_.get());
+      ScheduleOutput(session_id);
+    });
   }
+}
 
-  return immediately_output_mode_;
+void RtcEventLogImpl::LogRecentHistoriesToOutput(uint64_t session_id) {
+  EventHistories histories;
+  {
+    MutexLock lock(&mutex_);
+    if (session_id != session_id_) {
+      // StartLogging() or StopLogging() has already taken the events.
+      return;
+    }
+    RTC_DCHECK(immediate_output_pending_);
+    immediate_output_pending_ = false;
+    histories = ExtractRecentHistories();
+  }
+  if (event_output_) {
+    RTC_DCHECK(event_output_->IsActive());
+    LogEventsToOutput(std::move(histories));
+  }
 }
 
-void RtcEventLogImpl::ScheduleOutput() {
+void RtcEventLogImpl::ScheduleOutput(uint64_t session_id) {
+  {
+    MutexLock lock(&mutex_);
+    if (session_id != session_id_) {
+      // Logging was started or stopped after the output was requested. A new
+      // session schedules its own output.
+      return;
+    }
+  }
+  if (!event_output_) {
+    return;
+  }
+  RTC_DCHECK(event_output_->IsActive());
   RTC_DCHECK(output_period_ms_ != kImmediateOutput);
   // Binding to `this` is safe because `this` outlives the `task_queue_`.
-  auto output_task = [this]() {
+  auto output_task = [this, session_id]() {
     RTC_DCHECK_RUN_ON(task_queue_.get());
     // Allow scheduled output if the `event_output_` is valid.
-    if (event_output_) {
-      RTC_DCHECK(event_output_->IsActive());
-      mutex_.Lock();
+    if (!event_output_) {
+      return;
+    }
+    RTC_DCHECK(event_output_->IsActive());
+    EventHistories histories;
+    {
+      MutexLock lock(&mutex_);
+      if (session_id != session_id_) {
+        // StartLogging() or StopLogging() has already taken the events.
+        return;
+      }
       RTC_DCHECK(!need_schedule_output_);
       // Let the next `Log()` to schedule output.
       need_schedule_output_ = true;
-      EventHistories histories = ExtractRecentHistories();
-      mutex_.Unlock();
-      LogEventsToOutput(std::move(histories));
+      histories = ExtractRecentHistories();
     }
+    LogEventsToOutput(std::move(histories));
   };
   const int64_t now_ms = TimeMillis();
   const int64_t time_since_output_ms = now_ms - last_output_ms_;
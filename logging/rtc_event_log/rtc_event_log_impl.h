@@ -76,6 +76,9 @@ class RtcEventLogImpl final : public RtcEventLog {
   void LogToMemory(std::unique_ptr<RtcEvent> event)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
   void LogEventsToOutput(EventHistories histories) RTC_RUN_ON(task_queue_);
+  // Outputs everything logged since the last output, unless logging has been
+  // started or stopped since `session_id` was recorded.
+  void LogRecentHistoriesToOutput(uint64_t session_id) RTC_RUN_ON(task_queue_);
 
   void StopOutput() RTC_RUN_ON(task_queue_);
 
@@ -86,8 +89,9 @@ class RtcEventLogImpl final : public RtcEventLog {
 
   void StopLoggingInternal() RTC_RUN_ON(task_queue_);
 
-  bool ShouldOutputImmediately() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
-  void ScheduleOutput() RTC_RUN_ON(task_queue_);
+  // Schedules the next periodic output, unless logging has been started or
+  // stopped since `session_id` was recorded.
+  void ScheduleOutput(uint64_t session_id) RTC_RUN_ON(task_queue_);
 
   // Max size of event history.
   const size_t max_events_in_history_;
@@ -113,6 +117,13 @@ class RtcEventLogImpl final : public RtcEventLog {
   bool logging_state_started_ RTC_GUARDED_BY(mutex_) = false;
   bool immediately_output_mode_ RTC_GUARDED_BY(mutex_) = false;
   bool need_schedule_output_ RTC_GUARDED_BY(mutex_) = false;
+  // In immediate output mode, set while an output task is posted but has not
+  // yet extracted `recent_`. Events logged in the meantime are picked up by
+  // that task instead of each posting a task of their own.
+  bool immediate_output_pending_ RTC_GUARDED_BY(mutex_) = false;
+  // Incremented by StartLogging() and StopLogging(), so that pending output
+  // tasks from an earlier session can tell they are stale.
+  uint64_t session_id_ RTC_GUARDED_BY(mutex_) = 0;
 
   std::unique_ptr<TaskQueueBase, TaskQueueDeleter> task_queue_;
 
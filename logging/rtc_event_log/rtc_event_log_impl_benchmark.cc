@@ -0,0 +1,88 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <memory>
+
+#include "absl/strings/string_view.h"
+#include "api/field_trials.h"
+#include "api/rtc_event_log/rtc_event_log.h"
+#include "api/rtc_event_log_output.h"
+#include "api/task_queue/default_task_queue_factory.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "benchmark/benchmark.h"
+#include "logging/rtc_event_log/encoder/rtc_event_log_encoder_new_format.h"
+#include "logging/rtc_event_log/events/rtc_event_rtp_packet_outgoing.h"
+#include "logging/rtc_event_log/rtc_event_log_impl.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+
+namespace webrtc {
+namespace {
+
+class NullOutput : public RtcEventLogOutput {
+ public:
+  bool IsActive() const override { return true; }
+  bool Write(absl::string_view /* output */) override { return true; }
+};
+
+// Returns an event log that has been started with `output_period_ms`. The log
+// is shared by all benchmark threads and is never stopped, so that the
+// measurement only covers `Log()` and the encoding running in the background.
+RtcEventLog& StartedEventLog(int64_t output_period_ms) {
+  static TaskQueueFactory* const task_queue_factory =
+      CreateDefaultTaskQueueFactory().release();
+  static FieldTrials* const field_trials = new FieldTrials("");
+  auto create_started_log = [&] {
+    auto* event_log = new RtcEventLogImpl(
+        std::make_unique<RtcEventLogEncoderNewFormat>(*field_trials),
+        task_queue_factory);
+    event_log->StartLogging(std::make_unique<NullOutput>(), output_period_ms);
+    return event_log;
+  };
+  if (output_period_ms == RtcEventLog::kImmediateOutput) {
+    static RtcEventLog* const immediate_log = create_started_log();
+    return *immediate_log;
+  }
+  static RtcEventLog* const periodic_log = create_started_log();
+  return *periodic_log;
+}
+
+// Logs an outgoing RTP packet per iteration, including the allocation of the
+// event, which is what the RTP sender pays per packet.
+void BM_LogRtpPacketOutgoing(benchmark::State& state) {
+  RtcEventLog& event_log = StartedEventLog(state.range(0));
+  RtpHeaderExtensionMap extensions;
+  extensions.Register<TransportSequenceNumber>(1);
+  RtpPacketToSend packet(&extensions);
+  packet.SetSsrc(0x1234 + state.thread_index());
+  packet.SetPayloadSize(1200);
+  uint16_t sequence_number = 0;
+  for (auto _ : state) {
+    packet.SetSequenceNumber(sequence_number);
+    packet.SetExtension<TransportSequenceNumber>(sequence_number);
+    ++sequence_number;
+    event_log.Log(std::make_unique<RtcEventRtpPacketOutgoing>(
+        packet, /*probe_cluster_id=*/0));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Output periods in ms, 0 being immediate output.
+BENCHMARK(BM_LogRtpPacketOutgoing)
+    ->Arg(RtcEventLog::kImmediateOutput)
+    ->Arg(5000)
+    ->Threads(1)
+    ->Threads(4)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace webrtc
@@ -19,6 +19,7 @@
 
 #include "absl/strings/string_view.h"
 #include "api/rtc_event_log/rtc_event.h"
+#include "api/rtc_event_log/rtc_event_log.h"
 #include "api/rtc_event_log_output.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
@@ -253,6 +254,64 @@ TEST_F(RtcEventLogImplTest, SchedulesWriteAfterOutputDurationPassed) {
   Mock::VerifyAndClearExpectations(encoder_ptr_);
 }
 
+TEST_F(RtcEventLogImplTest, ImmediateOutputEncodesPendingEventsInOrder) {
+  auto e1 = std::make_unique<FakeEvent>();
+  RtcEvent* e1_ptr = e1.get();
+  auto e2 = std::make_unique<FakeEvent>();
+  RtcEvent* e2_ptr = e2.get();
+  auto e3 = std::make_unique<FakeEvent>();
+  RtcEvent* e3_ptr = e3.get();
+  event_log_.StartLogging(std::move(output_), RtcEventLog::kImmediateOutput);
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  // More events than fit in the history are logged before the output task
+  // runs. None of them may be dropped or reordered.
+  event_log_.Log(std::move(e1));
+  event_log_.Log(std::move(e2));
+  event_log_.Log(std::move(e3));
+  InSequence s;
+  EXPECT_CALL(*encoder_ptr_, OnEncode(Ref(*e1_ptr)));
+  EXPECT_CALL(*encoder_ptr_, OnEncode(Ref(*e2_ptr)));
+  EXPECT_CALL(*encoder_ptr_, OnEncode(Ref(*e3_ptr)));
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  Mock::VerifyAndClearExpectations(encoder_ptr_);
+}
+
+TEST_F(RtcEventLogImplTest, ImmediateOutputDoesNotEncodeEventsTwiceOnStop) {
+  event_log_.StartLogging(std::move(output_), RtcEventLog::kImmediateOutput);
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  EXPECT_CALL(*encoder_ptr_, OnEncode(_)).Times(1);
+  // The output task posted by `Log` is still pending when logging stops.
+  event_log_.Log(std::make_unique<FakeEvent>());
+  event_log_.StopLogging();
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  Mock::VerifyAndClearExpectations(encoder_ptr_);
+}
+
+TEST_F(RtcEventLogImplTest, IgnoresScheduledOutputOfEarlierSession) {
+  event_log_.StartLogging(std::make_unique<FakeOutput>(written_data_),
+                          kOutputPeriod.ms());
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  // Schedules output one output period from now.
+  event_log_.Log(std::make_unique<FakeEvent>());
+  time_controller_.AdvanceTime(kOutputPeriod / 2);
+  event_log_.StopLogging();
+
+  // Restart logging. The output of the earlier session is still scheduled and
+  // must not output the events of this session.
+  event_log_.StartLogging(std::move(output_), kOutputPeriod.ms());
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+  auto e = std::make_unique<FakeEvent>();
+  RtcEvent* e_ptr = e.get();
+  event_log_.Log(std::move(e));
+  EXPECT_CALL(*encoder_ptr_, OnEncode(Ref(*e_ptr))).Times(0);
+  time_controller_.AdvanceTime(kOutputPeriod / 2);
+  Mock::VerifyAndClearExpectations(encoder_ptr_);
+
+  EXPECT_CALL(*encoder_ptr_, OnEncode(Ref(*e_ptr)));
+  time_controller_.AdvanceTime(kOutputPeriod / 2);
+  Mock::VerifyAndClearExpectations(encoder_ptr_);
+}
+
 TEST_F(RtcEventLogImplTest, DoNotDropEventsIfHistoryFullAfterStarted) {
   constexpr size_t kNumberOfEvents = 10 * kMaxEventsInHistory;
 
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -26,6 +27,7 @@
 #include "absl/strings/string_view.h"
 #include "api/candidate.h"
 #include "api/dtls_transport_interface.h"
+#include "api/function_view.h"
 #include "api/rtc_event_log/rtc_event.h"
 #include "api/rtc_event_log/rtc_event_log.h"
 #include "api/rtp_headers.h"
@@ -98,6 +100,8 @@
 #include "rtc_base/numerics/sequence_number_unwrapper.h"
 #include "rtc_base/protobuf_utils.h"
 #include "rtc_base/system/file_wrapper.h"
+#include "rtc_base/system/memory_mapped_file.h"
+#include "rtc_base/time_utils.h"
 
 using webrtc_event_logging::ToSigned;
 using webrtc_event_logging::ToUnsigned;
@@ -118,6 +122,60 @@ constexpr uint16_t kDefaultOverhead =
 constexpr char kIncompleteLogError[] =
     "Could not parse the entire log. Only the beginning will be used.";
 
+// Reads the whole file into `buffer`.
+ParsedRtcEventLog::ParseStatus ReadLogFile(absl::string_view filename,
+                                           std::string& buffer) {
+  FileWrapper file = FileWrapper::OpenReadOnly(filename);
+  if (!file.is_open()) {
+    RTC_LOG(LS_WARNING) << "Could not open file " << filename
+                        << " for reading.";
+    RTC_PARSE_CHECK_OR_RETURN(file.is_open());
+  }
+
+  // Compute file size.
+  std::optional<size_t> file_size = file.FileSize();
+  RTC_PARSE_CHECK_OR_RETURN(file_size.has_value());
+  RTC_PARSE_CHECK_OR_RETURN_GE(*file_size, 0u);
+  RTC_PARSE_CHECK_OR_RETURN_LE(*file_size, kMaxLogSize);
+
+  // Read file into memory.
+  buffer.assign(*file_size, '\0');
+  size_t bytes_read = file.Read(&buffer[0], buffer.size());
+  if (bytes_read != *file_size) {
+    RTC_LOG(LS_WARNING) << "Failed to read file " << filename;
+    RTC_PARSE_CHECK_OR_RETURN_EQ(bytes_read, *file_size);
+  }
+  return ParsedRtcEventLog::ParseStatus::Success();
+}
+
+bool IsV3Log(absl::string_view s) {
+  uint64_t tag = 0;
+  return DecodeVarInt(s, &tag).first &&
+         tag >> 1 == static_cast<uint64_t>(RtcEvent::Type::BeginV3Log);
+}
+
+// Returns the length of the shortest prefix of `s` that consists of whole
+// events and is at least `min_length` bytes long. All formats store each
+// event (or batch of events) as a varint tag followed by a varint length and
+// that many bytes. If the end of an event can't be determined, the rest of
+// the log is returned as a single chunk and left for the parser to handle.
+size_t GetChunkLength(absl::string_view s, size_t min_length) {
+  absl::string_view remaining = s;
+  while (!remaining.empty() && s.size() - remaining.size() < min_length) {
+    uint64_t tag = 0;
+    uint64_t length = 0;
+    bool success = false;
+    std::tie(success, remaining) = DecodeVarInt(remaining, &tag);
+    if (!success)
+      return s.size();
+    std::tie(success, remaining) = DecodeVarInt(remaining, &length);
+    if (!success || length > remaining.size())
+      return s.size();
+    remaining = remaining.substr(length);
+  }
+  return s.size() - remaining.size();
+}
+
 struct MediaStreamInfo {
   MediaStreamInfo() = default;
   MediaStreamInfo(LoggedMediaType media_type, bool rtx)
@@ -1160,6 +1218,8 @@ ParsedRtcEventLog::ParsedRtcEventLog(
 }
 
 void ParsedRtcEventLog::Clear() {
+  ClearChunkEvents();
+
   default_extension_map_ = GetDefaultHeaderExtensionMap();
 
   incoming_rtx_ssrcs_.clear();
@@ -1169,6 +1229,25 @@ void ParsedRtcEventLog::Clear() {
   outgoing_video_ssrcs_.clear();
   outgoing_audio_ssrcs_.clear();
 
+  start_log_events_.clear();
+  stop_log_events_.clear();
+  audio_recv_configs_.clear();
+  audio_send_configs_.clear();
+  video_recv_configs_.clear();
+  video_send_configs_.clear();
+
+  last_incoming_rtcp_packet_.clear();
+  expect_begin_v3_log_event_ = true;
+
+  first_timestamp_ = Timestamp::PlusInfinity();
+  last_timestamp_ = Timestamp::MinusInfinity();
+  first_log_segment_ = LogSegment(0, std::numeric_limits<int64_t>::max());
+
+  incoming_rtp_extensions_maps_.clear();
+  outgoing_rtp_extensions_maps_.clear();
+}
+
+void ParsedRtcEventLog::ClearChunkEvents() {
   incoming_rtp_packets_map_.clear();
   outgoing_rtp_packets_map_.clear();
   incoming_rtp_packets_by_ssrc_.clear();
@@ -1183,17 +1262,25 @@ void ParsedRtcEventLog::Clear() {
   outgoing_rr_.clear();
   incoming_sr_.clear();
   outgoing_sr_.clear();
+  incoming_xr_.clear();
+  outgoing_xr_.clear();
   incoming_nack_.clear();
   outgoing_nack_.clear();
   incoming_remb_.clear();
   outgoing_remb_.clear();
+  incoming_fir_.clear();
+  outgoing_fir_.clear();
+  incoming_pli_.clear();
+  outgoing_pli_.clear();
+  incoming_bye_.clear();
+  outgoing_bye_.clear();
   incoming_transport_feedback_.clear();
   outgoing_transport_feedback_.clear();
+  incoming_congestion_feedback_.clear();
+  outgoing_congestion_feedback_.clear();
   incoming_loss_notification_.clear();
   outgoing_loss_notification_.clear();
 
-  start_log_events_.clear();
-  stop_log_events_.clear();
   audio_playout_events_.clear();
   neteq_set_minimum_delay_events_.clear();
   audio_network_adaptation_events_.clear();
@@ -1208,47 +1295,61 @@ void ParsedRtcEventLog::Clear() {
   alr_state_events_.clear();
   ice_candidate_pair_configs_.clear();
   ice_candidate_pair_events_.clear();
-  audio_recv_configs_.clear();
-  audio_send_configs_.clear();
-  video_recv_configs_.clear();
-  video_send_configs_.clear();
-
-  last_incoming_rtcp_packet_.clear();
-
-  first_timestamp_ = Timestamp::PlusInfinity();
-  last_timestamp_ = Timestamp::MinusInfinity();
-  first_log_segment_ = LogSegment(0, std::numeric_limits<int64_t>::max());
-
-  incoming_rtp_extensions_maps_.clear();
-  outgoing_rtp_extensions_maps_.clear();
+  generic_packets_received_.clear();
+  generic_packets_sent_.clear();
+  generic_acks_received_.clear();
+  route_change_events_.clear();
+  remote_estimate_events_.clear();
 }
 
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseFile(
     absl::string_view filename) {
-  FileWrapper file = FileWrapper::OpenReadOnly(filename);
-  if (!file.is_open()) {
-    RTC_LOG(LS_WARNING) << "Could not open file " << filename
-                        << " for reading.";
-    RTC_PARSE_CHECK_OR_RETURN(file.is_open());
-  }
-
-  // Compute file size.
-  std::optional<size_t> file_size = file.FileSize();
-  RTC_PARSE_CHECK_OR_RETURN(file_size.has_value());
-  RTC_PARSE_CHECK_OR_RETURN_GE(*file_size, 0u);
-  RTC_PARSE_CHECK_OR_RETURN_LE(*file_size, kMaxLogSize);
-
-  // Read file into memory.
-  std::string buffer(*file_size, '\0');
-  size_t bytes_read = file.Read(&buffer[0], buffer.size());
-  if (bytes_read != *file_size) {
-    RTC_LOG(LS_WARNING) << "Failed to read file " << filename;
-    RTC_PARSE_CHECK_OR_RETURN_EQ(bytes_read, *file_size);
-  }
-
+  std::string buffer;
+  RTC_RETURN_IF_ERROR(ReadLogFile(filename, buffer));
   return ParseStream(buffer);
 }
 
+ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseFileIncrementally(
+    absl::string_view filename,
+    FunctionView<void(const ParsedRtcEventLog&)> on_chunk,
+    size_t chunk_size) {
+  const int64_t start_time_us = TimeMicros();
+  std::unique_ptr<MemoryMappedFile> mapped_file =
+      MemoryMappedFile::OpenReadOnly(filename);
+  std::string buffer;
+  absl::string_view s;
+  if (mapped_file) {
+    mapped_file->AdviseSequential();
+    s = absl::string_view(
+        reinterpret_cast<const char*>(mapped_file->data().data()),
+        mapped_file->size());
+  } else {
+    // Memory mapping is not supported on all platforms.
+    RTC_RETURN_IF_ERROR(ReadLogFile(filename, buffer));
+    s = buffer;
+  }
+
+  // Exclude the time spent in `on_chunk` from the reported throughput.
+  int64_t on_chunk_time_us = 0;
+  ParseStatus status = ParseStreamIncrementally(
+      s,
+      [&](const ParsedRtcEventLog& chunk) {
+        const int64_t on_chunk_start_us = TimeMicros();
+        on_chunk(chunk);
+        on_chunk_time_us += TimeMicros() - on_chunk_start_us;
+      },
+      chunk_size);
+  const int64_t parse_time_us =
+      TimeMicros() - start_time_us - on_chunk_time_us;
+  RTC_LOG(LS_INFO) << "Parsed " << s.size() << " bytes from " << filename
+                   << " in " << parse_time_us / 1000 << " ms ("
+                   << (parse_time_us > 0
+                           ? static_cast<double>(s.size()) / parse_time_us
+                           : 0.0)
+                   << " MB/s).";
+  return status;
+}
+
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseString(
     absl::string_view s) {
   return ParseStream(s);
@@ -1258,7 +1359,45 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStream(
     absl::string_view s) {
   Clear();
   ParseStatus status = ParseStreamInternal(s);
+  RTC_RETURN_IF_ERROR(PostProcessParsedEvents());
+
+  if (first_timestamp_ > last_timestamp_) {
+    first_timestamp_ = last_timestamp_ = Timestamp::Zero();
+  }
+
+  return status;
+}
+
+ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamIncrementally(
+    absl::string_view s,
+    FunctionView<void(const ParsedRtcEventLog&)> on_chunk,
+    size_t chunk_size) {
+  Clear();
+  const bool is_v3_log = IsV3Log(s);
+  bool first_chunk = true;
+  do {
+    const absl::string_view chunk = s.substr(0, GetChunkLength(s, chunk_size));
+    s.remove_prefix(chunk.size());
+    ClearChunkEvents();
+    // The format is detected from the first chunk only.
+    ParseStatus status = first_chunk ? ParseStreamInternal(chunk)
+                         : is_v3_log ? ParseStreamInternalV3(chunk)
+                                     : ParseStreamInternalProtobuf(chunk);
+    first_chunk = false;
+    RTC_RETURN_IF_ERROR(PostProcessParsedEvents());
+    on_chunk(*this);
+    RTC_RETURN_IF_ERROR(status);
+  } while (!s.empty());
+  ClearChunkEvents();
+
+  if (first_timestamp_ > last_timestamp_) {
+    first_timestamp_ = last_timestamp_ = Timestamp::Zero();
+  }
+
+  return ParseStatus::Success();
+}
 
+ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::PostProcessParsedEvents() {
   // Cache the configured SSRCs.
   for (const auto& video_recv_config : video_recv_configs()) {
     incoming_video_ssrcs_.insert(video_recv_config.config.remote_ssrc);
@@ -1337,8 +1476,6 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStream(
   // stream configurations and starting/stopping the log.
   // TODO(terelius): Figure out if we actually need to find the first and last
   // timestamp in the parser. It seems like this could be done by the caller.
-  first_timestamp_ = Timestamp::PlusInfinity();
-  last_timestamp_ = Timestamp::MinusInfinity();
   StoreFirstAndLastTimestamp(alr_state_events());
   StoreFirstAndLastTimestamp(route_change_events());
   for (const auto& audio_stream : audio_playout_events()) {
@@ -1402,22 +1539,11 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStream(
   RTC_PARSE_CHECK_OR_RETURN_LE(start_us, stop_us);
   first_log_segment_ = LogSegment(start_us, stop_us);
 
-  if (first_timestamp_ > last_timestamp_) {
-    first_timestamp_ = last_timestamp_ = Timestamp::Zero();
-  }
-
-  return status;
+  return ParseStatus::Success();
 }
 
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
     absl::string_view s) {
-  constexpr uint64_t kMaxEventSize = 10000000;  // Sanity check.
-  // Protobuf defines the message tag as
-  // (field_number << 3) | wire_type. In the legacy encoding, the field number
-  // is supposed to be 1 and the wire type for a length-delimited field is 2.
-  // In the new encoding we still expect the wire type to be 2, but the field
-  // number will be greater than 1.
-  constexpr uint64_t kExpectedV1Tag = (1 << 3) | 2;
   bool success = false;
 
   // "Peek" at the first varint.
@@ -1436,10 +1562,24 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
   if (tag >> 1 == static_cast<uint64_t>(RtcEvent::Type::BeginV3Log)) {
     return ParseStreamInternalV3(s);
   }
+  return ParseStreamInternalProtobuf(s);
+}
+
+ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternalProtobuf(
+    absl::string_view s) {
+  constexpr uint64_t kMaxEventSize = 10000000;  // Sanity check.
+  // Protobuf defines the message tag as
+  // (field_number << 3) | wire_type. In the legacy encoding, the field number
+  // is supposed to be 1 and the wire type for a length-delimited field is 2.
+  // In the new encoding we still expect the wire type to be 2, but the field
+  // number will be greater than 1.
+  constexpr uint64_t kExpectedV1Tag = (1 << 3) | 2;
+  bool success = false;
 
   while (!s.empty()) {
-    // If not, "reset" event_start and read the field tag for the next event.
-    event_start = s;
+    // Read the field tag for the next event.
+    absl::string_view event_start = s;
+    uint64_t tag = 0;
     std::tie(success, s) = DecodeVarInt(s, &tag);
     if (!success) {
       RTC_LOG(LS_WARNING)
@@ -1522,7 +1662,6 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternalV3(
     absl::string_view s) {
   constexpr uint64_t kMaxEventSize = 10000000;  // Sanity check.
-  bool expect_begin_log_event = true;
   bool success = false;
 
   while (!s.empty()) {
@@ -1547,10 +1686,10 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternalV3(
     absl::string_view event_fields = s.substr(0, event_size_bytes);
     s = s.substr(event_size_bytes);
 
-    if (expect_begin_log_event) {
+    if (expect_begin_v3_log_event_) {
       RTC_PARSE_CHECK_OR_RETURN_EQ(
           event_type, static_cast<uint32_t>(RtcEvent::Type::BeginV3Log));
-      expect_begin_log_event = false;
+      expect_begin_v3_log_event_ = false;
     }
 
     switch (event_type) {
@@ -1559,7 +1698,7 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternalV3(
         break;
       case static_cast<uint32_t>(RtcEvent::Type::EndV3Log):
         RtcEventEndLog::Parse(event_fields, batched, stop_log_events_);
-        expect_begin_log_event = true;
+        expect_begin_v3_log_event_ = true;
         break;
       case static_cast<uint32_t>(RtcEvent::Type::AlrStateEvent):
         RtcEventAlrState::Parse(event_fields, batched, alr_state_events_);
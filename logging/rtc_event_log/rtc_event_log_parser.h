@@ -23,6 +23,7 @@
 #include "absl/strings/string_view.h"
 #include "api/candidate.h"
 #include "api/dtls_transport_interface.h"
+#include "api/function_view.h"
 #include "api/rtp_parameters.h"
 #include "api/transport/bandwidth_usage.h"
 #include "api/units/time_delta.h"
@@ -401,6 +402,30 @@ class ParsedRtcEventLog {
   // Reads an RtcEventLog from an string and returns success if successful.
   ParseStatus ParseStream(absl::string_view s);
 
+  // Default minimum amount of encoded data decoded at a time by the
+  // incremental parsing functions.
+  static constexpr size_t kDefaultChunkSize = 1 << 20;
+
+  // Parses the log in chunks of at least `chunk_size` bytes of encoded data,
+  // split at event boundaries. `on_chunk` is called with this object after
+  // each chunk has been decoded; at that point the event accessors only return
+  // the events of that chunk, and those events are discarded before the next
+  // chunk is decoded. Stream configurations, log start and stop events and
+  // first_timestamp()/last_timestamp() cover everything parsed so far. Memory
+  // use is bounded by the chunk size rather than by the size of the log.
+  ParseStatus ParseStreamIncrementally(
+      absl::string_view s,
+      FunctionView<void(const ParsedRtcEventLog&)> on_chunk,
+      size_t chunk_size = kDefaultChunkSize);
+
+  // Like ParseStreamIncrementally, but reads the log from a memory mapping of
+  // the file where supported, so that the file is never copied into memory as
+  // a whole. Unlike ParseFile, there is no limit on the size of the log.
+  ParseStatus ParseFileIncrementally(
+      absl::string_view filename,
+      FunctionView<void(const ParsedRtcEventLog&)> on_chunk,
+      size_t chunk_size = kDefaultChunkSize);
+
   MediaType GetMediaType(uint32_t ssrc, PacketDirection direction) const;
 
   // Configured SSRCs.
@@ -690,8 +715,20 @@ class ParsedRtcEventLog {
 
  private:
   ABSL_MUST_USE_RESULT ParseStatus ParseStreamInternal(absl::string_view s);
+  ABSL_MUST_USE_RESULT ParseStatus
+  ParseStreamInternalProtobuf(absl::string_view s);
   ABSL_MUST_USE_RESULT ParseStatus ParseStreamInternalV3(absl::string_view s);
 
+  // Groups the parsed RTP packets by SSRC, splits the RTCP packets into blocks
+  // and updates the configured SSRCs, first and last timestamps and the first
+  // log segment.
+  ABSL_MUST_USE_RESULT ParseStatus PostProcessParsedEvents();
+
+  // Clears the events that are handed out one chunk at a time by
+  // ParseStreamIncrementally, i.e. everything but the stream configurations,
+  // the log start and stop events and the state needed to decode later events.
+  void ClearChunkEvents();
+
   ABSL_MUST_USE_RESULT ParseStatus
   StoreParsedLegacyEvent(const rtclog::Event& event);
 
@@ -928,6 +965,9 @@ class ParsedRtcEventLog {
 
   std::vector<uint8_t> last_incoming_rtcp_packet_;
 
+  // Whether the next event of a v3 log must be the start of a log.
+  bool expect_begin_v3_log_event_ = true;
+
   Timestamp first_timestamp_ = Timestamp::PlusInfinity();
   Timestamp last_timestamp_ = Timestamp::MinusInfinity();
 
@@ -0,0 +1,124 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "api/field_trials.h"
+#include "api/rtc_event_log/rtc_event.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "logging/rtc_event_log/encoder/rtc_event_log_encoder_new_format.h"
+#include "logging/rtc_event_log/events/rtc_event_rtcp_packet_incoming.h"
+#include "logging/rtc_event_log/events/rtc_event_rtp_packet_outgoing.h"
+#include "logging/rtc_event_log/rtc_event_log_parser.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/receiver_report.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/fake_clock.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+namespace {
+
+// One minute of a 2.5 Mbps video call, written in one second batches.
+constexpr int kNumBatches = 60;
+constexpr int kRtpPacketsPerBatch = 250;
+constexpr int kRtcpPacketsPerBatch = 10;
+constexpr uint32_t kSsrc = 0x1234;
+
+std::string CreateNewFormatLog() {
+  FakeClock clock;
+  clock.SetTime(Timestamp::Seconds(1000));
+  SetClockForTesting(&clock);
+
+  FieldTrials field_trials("");
+  RtcEventLogEncoderNewFormat encoder(field_trials);
+  RtpHeaderExtensionMap extensions;
+  extensions.Register<TransportSequenceNumber>(1);
+  std::string log = encoder.EncodeLogStart(TimeMicros(), TimeUTCMicros());
+  uint16_t sequence_number = 0;
+  for (int batch = 0; batch < kNumBatches; ++batch) {
+    std::deque<std::unique_ptr<RtcEvent>> events;
+    for (int i = 0; i < kRtpPacketsPerBatch; ++i) {
+      RtpPacketToSend packet(&extensions);
+      packet.SetSsrc(kSsrc);
+      packet.SetSequenceNumber(sequence_number);
+      packet.SetExtension<TransportSequenceNumber>(sequence_number);
+      packet.SetPayloadSize(1200);
+      ++sequence_number;
+      events.push_back(std::make_unique<RtcEventRtpPacketOutgoing>(
+          packet, /*probe_cluster_id=*/0));
+      clock.AdvanceTime(TimeDelta::Seconds(1) / kRtpPacketsPerBatch);
+      if (i % (kRtpPacketsPerBatch / kRtcpPacketsPerBatch) == 0) {
+        rtcp::ReportBlock report_block;
+        report_block.SetMediaSsrc(kSsrc);
+        report_block.SetExtHighestSeqNum(sequence_number);
+        rtcp::ReceiverReport receiver_report;
+        receiver_report.SetSenderSsrc(kSsrc + 1);
+        receiver_report.AddReportBlock(report_block);
+        Buffer rtcp_packet = receiver_report.Build();
+        events.push_back(std::make_unique<RtcEventRtcpPacketIncoming>(
+            rtcp_packet));
+      }
+    }
+    log += encoder.EncodeBatch(events.begin(), events.end());
+  }
+  log += encoder.EncodeLogEnd(TimeMicros());
+
+  SetClockForTesting(nullptr);
+  return log;
+}
+
+void BM_ParseString(benchmark::State& state) {
+  const std::string log = CreateNewFormatLog();
+  for (auto _ : state) {
+    ParsedRtcEventLog parsed_log;
+    benchmark::DoNotOptimize(parsed_log.ParseString(log).ok());
+  }
+  state.SetBytesProcessed(state.iterations() * log.size());
+}
+
+void BM_ParseStreamIncrementally(benchmark::State& state) {
+  const std::string log = CreateNewFormatLog();
+  size_t num_rtp_packets = 0;
+  for (auto _ : state) {
+    ParsedRtcEventLog parsed_log;
+    benchmark::DoNotOptimize(
+        parsed_log
+            .ParseStreamIncrementally(
+                log,
+                [&](const ParsedRtcEventLog& chunk) {
+                  for (const auto& stream :
+                       chunk.outgoing_rtp_packets_by_ssrc()) {
+                    num_rtp_packets += stream.outgoing_packets.size();
+                  }
+                },
+                state.range(0))
+            .ok());
+  }
+  state.SetBytesProcessed(state.iterations() * log.size());
+  state.counters["rtp_packets_per_iteration"] =
+      static_cast<double>(num_rtp_packets) / state.iterations();
+}
+
+BENCHMARK(BM_ParseString);
+// Chunk sizes in bytes.
+BENCHMARK(BM_ParseStreamIncrementally)->Arg(1)->Arg(16 << 10)->Arg(1 << 20);
+
+}  // namespace
+}  // namespace webrtc
@@ -163,6 +163,9 @@ class RtcEventLogSession
   // write the remaining non-config events.
   void WriteLog(EventCounts count, size_t num_events_before_start);
   void ReadAndVerifyLog();
+  // Verifies that parsing the log incrementally yields the same events as
+  // parsing it all at once.
+  void ReadIncrementallyAndVerifyLog();
 
   bool IsNewFormat() {
     return encoding_type_ == RtcEventLog::EncodingType::NewFormat;
@@ -846,6 +849,90 @@ void RtcEventLogSession::ReadAndVerifyLog() {
             stop_time_us_ / 1000);
 }
 
+// Returns the number of events of each type in `log`.
+std::vector<size_t> CountEvents(const ParsedRtcEventLog& log) {
+  auto count_grouped = [](const auto& groups) {
+    size_t count = 0;
+    for (const auto& [key, events] : groups) {
+      count += events.size();
+    }
+    return count;
+  };
+  size_t incoming_rtp_packets = 0;
+  for (const auto& stream : log.incoming_rtp_packets_by_ssrc()) {
+    incoming_rtp_packets += stream.incoming_packets.size();
+  }
+  size_t outgoing_rtp_packets = 0;
+  for (const auto& stream : log.outgoing_rtp_packets_by_ssrc()) {
+    outgoing_rtp_packets += stream.outgoing_packets.size();
+  }
+  return {log.alr_state_events().size(),
+          log.route_change_events().size(),
+          count_grouped(log.audio_playout_events()),
+          log.audio_network_adaptation_events().size(),
+          log.bwe_delay_updates().size(),
+          log.bwe_loss_updates().size(),
+          log.bwe_probe_cluster_created_events().size(),
+          log.bwe_probe_failure_events().size(),
+          log.bwe_probe_success_events().size(),
+          log.dtls_transport_states().size(),
+          log.dtls_writable_states().size(),
+          count_grouped(log.decoded_frames()),
+          log.ice_candidate_pair_configs().size(),
+          log.ice_candidate_pair_events().size(),
+          incoming_rtp_packets,
+          outgoing_rtp_packets,
+          log.incoming_rtcp_packets().size(),
+          log.outgoing_rtcp_packets().size(),
+          log.receiver_reports(kIncomingPacket).size(),
+          log.sender_reports(kOutgoingPacket).size(),
+          log.generic_packets_sent().size(),
+          log.generic_packets_received().size(),
+          log.generic_acks_received().size()};
+}
+
+void RtcEventLogSession::ReadIncrementallyAndVerifyLog() {
+  auto it = log_storage_.logs().find(temp_filename_);
+  ASSERT_TRUE(it != log_storage_.logs().end());
+  ParsedRtcEventLog parsed_log;
+  ASSERT_TRUE(parsed_log.ParseString(it->second).ok());
+  const std::vector<size_t> expected_counts = CountEvents(parsed_log);
+
+  ParsedRtcEventLog incremental_log;
+  std::vector<size_t> counts(expected_counts.size(), 0);
+  int num_chunks = 0;
+  // With a chunk size of one byte, every event (or batch of events) is
+  // decoded on its own.
+  ASSERT_TRUE(incremental_log
+                  .ParseStreamIncrementally(
+                      it->second,
+                      [&](const ParsedRtcEventLog& chunk) {
+                        ++num_chunks;
+                        std::vector<size_t> chunk_counts = CountEvents(chunk);
+                        for (size_t i = 0; i < counts.size(); ++i) {
+                          counts[i] += chunk_counts[i];
+                        }
+                      },
+                      /*chunk_size=*/1)
+                  .ok());
+
+  EXPECT_GT(num_chunks, 1);
+  EXPECT_EQ(counts, expected_counts);
+  EXPECT_EQ(incremental_log.start_log_events().size(),
+            parsed_log.start_log_events().size());
+  EXPECT_EQ(incremental_log.stop_log_events().size(),
+            parsed_log.stop_log_events().size());
+  EXPECT_EQ(incremental_log.audio_send_configs().size(),
+            parsed_log.audio_send_configs().size());
+  EXPECT_EQ(incremental_log.video_recv_configs().size(),
+            parsed_log.video_recv_configs().size());
+  EXPECT_EQ(incremental_log.first_timestamp(), parsed_log.first_timestamp());
+  EXPECT_EQ(incremental_log.last_timestamp(), parsed_log.last_timestamp());
+  // Only the configurations are kept once parsing is done.
+  EXPECT_TRUE(incremental_log.incoming_rtp_packets_by_ssrc().empty());
+  EXPECT_TRUE(incremental_log.outgoing_rtcp_packets().empty());
+}
+
 }  // namespace
 
 TEST_P(RtcEventLogSession, StartLoggingFromBeginning) {
@@ -916,6 +1003,40 @@ TEST_P(RtcEventLogSession, StartLoggingInTheMiddle) {
   ReadAndVerifyLog();
 }
 
+TEST_P(RtcEventLogSession, ParseIncrementally) {
+  EventCounts count;
+  count.audio_send_streams = 2;
+  count.audio_recv_streams = 2;
+  count.video_send_streams = 3;
+  count.video_recv_streams = 4;
+  count.alr_states = 4;
+  count.audio_playouts = 100;
+  count.ana_configs = 3;
+  count.bwe_loss_events = 20;
+  count.bwe_delay_events = 20;
+  count.probe_creations = 4;
+  count.probe_successes = 2;
+  count.probe_failures = 2;
+  count.ice_configs = 3;
+  count.ice_events = 10;
+  count.incoming_rtp_packets = 100;
+  count.outgoing_rtp_packets = 100;
+  count.incoming_rtcp_packets = 20;
+  count.outgoing_rtcp_packets = 20;
+  if (IsNewFormat()) {
+    count.dtls_transport_states = 4;
+    count.dtls_writable_states = 2;
+    count.frame_decoded_events = 50;
+    count.generic_packets_sent = 100;
+    count.generic_packets_received = 100;
+    count.generic_acks_received = 20;
+    count.route_changes = 4;
+  }
+
+  WriteLog(count, 0);
+  ReadIncrementallyAndVerifyLog();
+}
+
 INSTANTIATE_TEST_SUITE_P(
     RtcEventLogTest,
     RtcEventLogSession,
@@ -102,9 +102,20 @@ DelayBasedBwe::Result DelayBasedBwe::IncomingPacketFeedbackVector(
     std::optional<DataRate> probe_bitrate,
     std::optional<NetworkStateEstimate> network_estimate,
     bool in_alr) {
+  return IncomingPacketFeedbackVector(
+      msg.SortedByReceiveTime(), msg.feedback_time, acked_bitrate,
+      probe_bitrate, std::move(network_estimate), in_alr);
+}
+
+DelayBasedBwe::Result DelayBasedBwe::IncomingPacketFeedbackVector(
+    const std::vector<PacketResult>& packet_feedback_vector,
+    Timestamp feedback_time,
+    std::optional<DataRate> acked_bitrate,
+    std::optional<DataRate> probe_bitrate,
+    std::optional<NetworkStateEstimate> network_estimate,
+    bool in_alr) {
   RTC_DCHECK_RUNS_SERIALIZED(&network_race_);
 
-  auto packet_feedback_vector = msg.SortedByReceiveTime();
   // TODO(holmer): An empty feedback vector here likely means that
   // all acks were too late and that the send time history had
   // timed out. We should reduce the rate when this occurs.
@@ -124,7 +135,7 @@ DelayBasedBwe::Result DelayBasedBwe::IncomingPacketFeedbackVector(
   BandwidthUsage prev_detector_state = active_delay_detector_->State();
   for (const auto& packet_feedback : packet_feedback_vector) {
     delayed_feedback = false;
-    IncomingPacketFeedback(packet_feedback, msg.feedback_time);
+    IncomingPacketFeedback(packet_feedback, feedback_time);
     if (prev_detector_state == BandwidthUsage::kBwUnderusing &&
         active_delay_detector_->State() == BandwidthUsage::kBwNormal) {
       recovered_from_overuse = true;
@@ -141,7 +152,7 @@ DelayBasedBwe::Result DelayBasedBwe::IncomingPacketFeedbackVector(
   rate_control_.SetNetworkStateEstimate(network_estimate);
   return MaybeUpdateEstimate(acked_bitrate, probe_bitrate,
                              std::move(network_estimate),
-                             recovered_from_overuse, in_alr, msg.feedback_time);
+                             recovered_from_overuse, in_alr, feedback_time);
 }
 
 void DelayBasedBwe::IncomingPacketFeedback(const PacketResult& packet_feedback,
@@ -78,6 +78,16 @@ class DelayBasedBwe {
       std::optional<DataRate> probe_bitrate,
       std::optional<NetworkStateEstimate> network_estimate,
       bool in_alr);
+  // Same as above, but takes the received packets of the feedback report
+  // sorted by receive time, as returned by
+  // TransportPacketsFeedback::SortedByReceiveTime().
+  Result IncomingPacketFeedbackVector(
+      const std::vector<PacketResult>& packet_feedback_vector,
+      Timestamp feedback_time,
+      std::optional<DataRate> acked_bitrate,
+      std::optional<DataRate> probe_bitrate,
+      std::optional<NetworkStateEstimate> network_estimate,
+      bool in_alr);
   void OnRttUpdate(TimeDelta avg_rtt);
   bool LatestEstimate(std::vector<uint32_t>* ssrcs, DataRate* bitrate) const;
   void SetStartBitrate(DataRate start_bitrate);
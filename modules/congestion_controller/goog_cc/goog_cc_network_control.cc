@@ -424,11 +424,20 @@ NetworkControlUpdate GoogCcNetworkController::OnTransportPacketsFeedback(
   TimeDelta min_propagation_rtt = TimeDelta::PlusInfinity();
   Timestamp max_recv_time = Timestamp::MinusInfinity();
 
-  std::vector<PacketResult> feedbacks = report.ReceivedWithSendInfo();
-  for (const auto& feedback : feedbacks)
-    max_recv_time = std::max(max_recv_time, feedback.receive_time);
-
-  for (const auto& feedback : feedbacks) {
+  // The received packets, sorted by receive time, are used by several of the
+  // estimators below. Sort them once, into a buffer that is reused between
+  // reports so that steady state feedback processing doesn't allocate.
+  received_packets_.clear();
+  for (const PacketResult& feedback : report.packet_feedbacks) {
+    if (feedback.IsReceived())
+      received_packets_.push_back(feedback);
+  }
+  std::sort(received_packets_.begin(), received_packets_.end(),
+            PacketResult::ReceiveTimeOrder());
+  if (!received_packets_.empty())
+    max_recv_time = received_packets_.back().receive_time;
+
+  for (const auto& feedback : received_packets_) {
     TimeDelta feedback_rtt =
         report.feedback_time - feedback.sent_packet.send_time;
     TimeDelta min_pending_time = max_recv_time - feedback.receive_time;
@@ -456,11 +465,11 @@ NetworkControlUpdate GoogCcNetworkController::OnTransportPacketsFeedback(
   }
   previously_in_alr_ = alr_start_time.has_value();
   acknowledged_bitrate_estimator_->IncomingPacketFeedbackVector(
-      report.SortedByReceiveTime());
+      received_packets_);
   auto acknowledged_bitrate = acknowledged_bitrate_estimator_->bitrate();
   bandwidth_estimation_->SetAcknowledgedRate(acknowledged_bitrate,
                                              report.feedback_time);
-  for (const auto& feedback : report.SortedByReceiveTime()) {
+  for (const auto& feedback : received_packets_) {
     if (feedback.sent_packet.pacing_info.probe_cluster_id !=
         PacedPacketInfo::kNotAProbe) {
       probe_bitrate_estimator_->HandleProbeAndEstimateBitrate(feedback);
@@ -498,8 +507,8 @@ NetworkControlUpdate GoogCcNetworkController::OnTransportPacketsFeedback(
 
   DelayBasedBwe::Result result;
   result = delay_based_bwe_->IncomingPacketFeedbackVector(
-      report, acknowledged_bitrate, probe_bitrate, estimate_,
-      alr_start_time.has_value());
+      received_packets_, report.feedback_time, acknowledged_bitrate,
+      probe_bitrate, estimate_, alr_start_time.has_value());
 
   if (result.updated) {
     if (result.probe) {
@@ -118,6 +118,9 @@ class GoogCcNetworkController : public NetworkControllerInterface {
   std::optional<NetworkStateEstimate> estimate_;
 
   std::deque<int64_t> feedback_max_rtts_;
+  // Received packets of the last transport feedback report, sorted by receive
+  // time.
+  std::vector<PacketResult> received_packets_;
 
   DataRate last_loss_based_target_rate_;
   DataRate last_pushback_target_rate_;
@@ -0,0 +1,101 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/transport/network_control.h"
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "modules/congestion_controller/goog_cc/goog_cc_network_control.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+// Each iteration replays this many feedback reports through a fresh
+// controller, i.e. 10 seconds of traffic.
+constexpr int kNumFeedbacks = 200;
+constexpr TimeDelta kFeedbackInterval = TimeDelta::Millis(50);
+constexpr DataSize kPacketSize = DataSize::Bytes(1200);
+constexpr TimeDelta kOneWayDelay = TimeDelta::Millis(30);
+constexpr int kMaxJitterUs = 2000;
+constexpr int kLossPercent = 1;
+
+// Creates feedback reports for a stream of packets paced out at `rate`, as
+// seen by a receiver behind a link with some jitter and random loss.
+std::vector<TransportPacketsFeedback> CreateFeedbacks(DataRate rate) {
+  Random random(0x4321);
+  const TimeDelta packet_interval = kPacketSize / rate;
+  std::vector<TransportPacketsFeedback> feedbacks(kNumFeedbacks);
+  Timestamp send_time = Timestamp::Seconds(10);
+  int64_t sequence_number = 0;
+  for (TransportPacketsFeedback& feedback : feedbacks) {
+    const Timestamp end_time = send_time + kFeedbackInterval;
+    for (; send_time < end_time; send_time += packet_interval) {
+      PacketResult packet;
+      packet.sent_packet.send_time = send_time;
+      packet.sent_packet.size = kPacketSize;
+      packet.sent_packet.sequence_number = sequence_number++;
+      if (random.Rand(1, 100) > kLossPercent) {
+        packet.receive_time = send_time + kOneWayDelay +
+                              TimeDelta::Micros(random.Rand(0, kMaxJitterUs));
+      }
+      feedback.packet_feedbacks.push_back(packet);
+    }
+    feedback.feedback_time = end_time + 2 * kOneWayDelay;
+    feedback.data_in_flight = rate * (2 * kOneWayDelay);
+  }
+  return feedbacks;
+}
+
+void BM_OnTransportPacketsFeedback(benchmark::State& state) {
+  const DataRate rate = DataRate::KilobitsPerSec(1000 * state.range(0));
+  const std::vector<TransportPacketsFeedback> feedbacks =
+      CreateFeedbacks(rate);
+  const Environment env = CreateEnvironment();
+  for (auto _ : state) {
+    state.PauseTiming();
+    NetworkControllerConfig config(env);
+    config.constraints.at_time = feedbacks.front().feedback_time;
+    config.constraints.min_data_rate = DataRate::KilobitsPerSec(30);
+    config.constraints.starting_rate = rate;
+    config.constraints.max_data_rate = 2 * rate;
+    auto controller =
+        std::make_unique<GoogCcNetworkController>(config, GoogCcConfig());
+    state.ResumeTiming();
+
+    for (const TransportPacketsFeedback& feedback : feedbacks) {
+      NetworkControlUpdate update =
+          controller->OnTransportPacketsFeedback(feedback);
+      benchmark::DoNotOptimize(update);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumFeedbacks);
+  state.counters["time_per_feedback"] =
+      benchmark::Counter(kNumFeedbacks,
+                         benchmark::Counter::kIsIterationInvariantRate |
+                             benchmark::Counter::kInvert);
+  state.counters["packets_per_feedback"] =
+      static_cast<double>(feedbacks.front().packet_feedbacks.size());
+}
+
+// Send rates of 1, 10 and 100 Mbps.
+BENCHMARK(BM_OnTransportPacketsFeedback)->Arg(1)->Arg(10)->Arg(100);
+
+}  // namespace
+}  // namespace webrtc
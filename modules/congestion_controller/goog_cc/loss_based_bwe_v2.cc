@@ -99,6 +99,7 @@ LossBasedBweV2::LossBasedBweV2(const FieldTrialsView* key_value_config)
   current_best_estimate_.inherent_loss =
       config_->initial_inherent_loss_estimate;
   observations_.resize(config_->observation_window_size);
+  observation_terms_.reserve(config_->observation_window_size);
   temporal_weights_.resize(config_->observation_window_size);
   instant_upper_bound_temporal_weights_.resize(
       config_->observation_window_size);
@@ -220,7 +221,8 @@ void LossBasedBweV2::UpdateBandwidthEstimate(
 
   ChannelParameters best_candidate = current_best_estimate_;
   double objective_max = std::numeric_limits<double>::lowest();
-  for (ChannelParameters candidate : GetCandidates(in_alr)) {
+  GetCandidates(in_alr, candidates_);
+  for (ChannelParameters candidate : candidates_) {
     NewtonsMethodUpdate(candidate);
 
     const double candidate_objective = GetObjective(candidate);
@@ -888,13 +890,24 @@ DataRate LossBasedBweV2::GetCandidateBandwidthUpperBound() const {
   return candidate_bandwidth_upper_bound;
 }
 
-std::vector<LossBasedBweV2::ChannelParameters> LossBasedBweV2::GetCandidates(
-    bool in_alr) const {
-  ChannelParameters best_estimate = current_best_estimate_;
-  std::vector<DataRate> bandwidths;
+void LossBasedBweV2::GetCandidates(
+    bool in_alr,
+    std::vector<ChannelParameters>& candidates) const {
+  const ChannelParameters best_estimate = current_best_estimate_;
+  const DataRate candidate_bandwidth_upper_bound =
+      GetCandidateBandwidthUpperBound();
+  candidates.clear();
+  auto add_candidate = [&](DataRate bandwidth) {
+    ChannelParameters candidate = best_estimate;
+    candidate.loss_limited_bandwidth =
+        std::min(bandwidth, std::max(best_estimate.loss_limited_bandwidth,
+                                     candidate_bandwidth_upper_bound));
+    candidate.inherent_loss = GetFeasibleInherentLoss(candidate);
+    candidates.push_back(candidate);
+  };
+
   for (double candidate_factor : config_->candidate_factors) {
-    bandwidths.push_back(candidate_factor *
-                         best_estimate.loss_limited_bandwidth);
+    add_candidate(candidate_factor * best_estimate.loss_limited_bandwidth);
   }
 
   if (acknowledged_bitrate_.has_value() &&
@@ -903,77 +916,41 @@ std::vector<LossBasedBweV2::ChannelParameters> LossBasedBweV2::GetCandidates(
         (config_->padding_duration > TimeDelta::Zero() &&
          last_padding_info_.padding_timestamp + config_->padding_duration >=
              last_send_time_most_recent_observation_)) {
-      bandwidths.push_back(*acknowledged_bitrate_ *
-                           config_->bandwidth_backoff_lower_bound_factor);
+      add_candidate(*acknowledged_bitrate_ *
+                    config_->bandwidth_backoff_lower_bound_factor);
     }
   }
 
   if (IsValid(delay_based_estimate_) &&
       config_->append_delay_based_estimate_candidate) {
     if (delay_based_estimate_ > best_estimate.loss_limited_bandwidth) {
-      bandwidths.push_back(delay_based_estimate_);
+      add_candidate(delay_based_estimate_);
     }
   }
 
   if (in_alr && config_->append_upper_bound_candidate_in_alr &&
       best_estimate.loss_limited_bandwidth > GetInstantUpperBound()) {
-    bandwidths.push_back(GetInstantUpperBound());
-  }
-
-  const DataRate candidate_bandwidth_upper_bound =
-      GetCandidateBandwidthUpperBound();
-
-  std::vector<ChannelParameters> candidates;
-  candidates.resize(bandwidths.size());
-  for (size_t i = 0; i < bandwidths.size(); ++i) {
-    ChannelParameters candidate = best_estimate;
-    candidate.loss_limited_bandwidth =
-        std::min(bandwidths[i], std::max(best_estimate.loss_limited_bandwidth,
-                                         candidate_bandwidth_upper_bound));
-    candidate.inherent_loss = GetFeasibleInherentLoss(candidate);
-    candidates[i] = candidate;
+    add_candidate(GetInstantUpperBound());
   }
-  return candidates;
 }
 
 LossBasedBweV2::Derivatives LossBasedBweV2::GetDerivatives(
     const ChannelParameters& channel_parameters) const {
   Derivatives derivatives;
 
-  for (const Observation& observation : observations_) {
-    if (!observation.IsInitialized()) {
-      continue;
-    }
-
+  for (const ObservationTerms& terms : observation_terms_) {
     double loss_probability = GetLossProbability(
         channel_parameters.inherent_loss,
-        channel_parameters.loss_limited_bandwidth, observation.sending_rate);
+        channel_parameters.loss_limited_bandwidth, terms.sending_rate);
+    double received_probability = 1.0 - loss_probability;
 
-    double temporal_weight =
-        temporal_weights_[(num_observations_ - 1) - observation.id];
-    if (config_->use_byte_loss_rate) {
-      derivatives.first +=
-          temporal_weight *
-          ((ToKiloBytes(observation.lost_size) / loss_probability) -
-           (ToKiloBytes(observation.size - observation.lost_size) /
-            (1.0 - loss_probability)));
-      derivatives.second -=
-          temporal_weight *
-          ((ToKiloBytes(observation.lost_size) /
-            std::pow(loss_probability, 2)) +
-           (ToKiloBytes(observation.size - observation.lost_size) /
-            std::pow(1.0 - loss_probability, 2)));
-    } else {
-      derivatives.first +=
-          temporal_weight *
-          ((observation.num_lost_packets / loss_probability) -
-           (observation.num_received_packets / (1.0 - loss_probability)));
-      derivatives.second -=
-          temporal_weight *
-          ((observation.num_lost_packets / std::pow(loss_probability, 2)) +
-           (observation.num_received_packets /
-            std::pow(1.0 - loss_probability, 2)));
-    }
+    derivatives.first +=
+        terms.temporal_weight * ((terms.lost / loss_probability) -
+                                 (terms.received / received_probability));
+    derivatives.second -=
+        terms.temporal_weight *
+        ((terms.lost / (loss_probability * loss_probability)) +
+         (terms.received / (received_probability * received_probability)));
   }
 
   if (derivatives.second >= 0.0) {
@@ -1033,34 +1010,15 @@ double LossBasedBweV2::GetObjective(
   const double high_bandwidth_bias =
       GetHighBandwidthBias(channel_parameters.loss_limited_bandwidth);
 
-  for (const Observation& observation : observations_) {
-    if (!observation.IsInitialized()) {
-      continue;
-    }
-
+  for (const ObservationTerms& terms : observation_terms_) {
     double loss_probability = GetLossProbability(
         channel_parameters.inherent_loss,
-        channel_parameters.loss_limited_bandwidth, observation.sending_rate);
+        channel_parameters.loss_limited_bandwidth, terms.sending_rate);
 
-    double temporal_weight =
-        temporal_weights_[(num_observations_ - 1) - observation.id];
-    if (config_->use_byte_loss_rate) {
-      objective +=
-          temporal_weight *
-          ((ToKiloBytes(observation.lost_size) * std::log(loss_probability)) +
-           (ToKiloBytes(observation.size - observation.lost_size) *
-            std::log(1.0 - loss_probability)));
-      objective +=
-          temporal_weight * high_bandwidth_bias * ToKiloBytes(observation.size);
-    } else {
-      objective +=
-          temporal_weight *
-          ((observation.num_lost_packets * std::log(loss_probability)) +
-           (observation.num_received_packets *
-            std::log(1.0 - loss_probability)));
-      objective +=
-          temporal_weight * high_bandwidth_bias * observation.num_packets;
-    }
+    objective += terms.temporal_weight *
+                 ((terms.lost * std::log(loss_probability)) +
+                  (terms.received * std::log(1.0 - loss_probability)));
+    objective += terms.temporal_weight * high_bandwidth_bias * terms.size;
   }
 
   return objective;
@@ -1126,6 +1084,29 @@ void LossBasedBweV2::CalculateTemporalWeights() {
   }
 }
 
+void LossBasedBweV2::UpdateObservationTerms() {
+  observation_terms_.clear();
+  for (const Observation& observation : observations_) {
+    if (!observation.IsInitialized()) {
+      continue;
+    }
+    ObservationTerms terms;
+    terms.temporal_weight =
+        temporal_weights_[(num_observations_ - 1) - observation.id];
+    terms.sending_rate = observation.sending_rate;
+    if (config_->use_byte_loss_rate) {
+      terms.lost = ToKiloBytes(observation.lost_size);
+      terms.received = ToKiloBytes(observation.size - observation.lost_size);
+      terms.size = ToKiloBytes(observation.size);
+    } else {
+      terms.lost = observation.num_lost_packets;
+      terms.received = observation.num_received_packets;
+      terms.size = observation.num_packets;
+    }
+    observation_terms_.push_back(terms);
+  }
+}
+
 void LossBasedBweV2::NewtonsMethodUpdate(
     ChannelParameters& channel_parameters) const {
   if (num_observations_ <= 0) {
@@ -1196,6 +1177,7 @@ bool LossBasedBweV2::PushBackObservation(
       observation;
 
   partial_observation_ = PartialObservation();
+  UpdateObservationTerms();
   UpdateAverageReportedLossRatio();
   CalculateInstantUpperBound();
   return true;
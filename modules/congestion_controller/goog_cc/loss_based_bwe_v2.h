@@ -146,6 +146,22 @@ class LossBasedBweV2 {
     int id = -1;
   };
 
+  // Terms of the objective and its derivatives that only depend on an
+  // observation, not on the channel parameters. Kept up to date when
+  // observations are added, so that the solver doesn't have to recompute them
+  // for every candidate and Newton iteration.
+  struct ObservationTerms {
+    double temporal_weight = 0.0;
+    DataRate sending_rate = DataRate::MinusInfinity();
+    // Lost and received kilobytes if `use_byte_loss_rate`, otherwise lost and
+    // received packets.
+    double lost = 0.0;
+    double received = 0.0;
+    // Observation size in kilobytes if `use_byte_loss_rate`, otherwise in
+    // packets.
+    double size = 0.0;
+  };
+
   struct PartialObservation {
     int num_packets = 0;
     std::unordered_map<int64_t, DataSize> lost_packets;
@@ -174,7 +190,9 @@ class LossBasedBweV2 {
   // observations but skips the observation with min and max loss ratio in order
   // to filter out loss spikes.
   double CalculateAverageReportedByteLossRatio() const;
-  std::vector<ChannelParameters> GetCandidates(bool in_alr) const;
+  // Fills `candidates` with the candidate channel parameters to evaluate.
+  void GetCandidates(bool in_alr,
+                     std::vector<ChannelParameters>& candidates) const;
   DataRate GetCandidateBandwidthUpperBound() const;
   Derivatives GetDerivatives(const ChannelParameters& channel_parameters) const;
   double GetFeasibleInherentLoss(
@@ -190,6 +208,7 @@ class LossBasedBweV2 {
   void CalculateInstantLowerBound();
 
   void CalculateTemporalWeights();
+  void UpdateObservationTerms();
   void NewtonsMethodUpdate(ChannelParameters& channel_parameters) const;
 
   // Returns false if no observation was created.
@@ -205,6 +224,11 @@ class LossBasedBweV2 {
   ChannelParameters current_best_estimate_;
   int num_observations_ = 0;
   std::vector<Observation> observations_;
+  // Terms of the initialized observations in `observations_`, in the same
+  // order.
+  std::vector<ObservationTerms> observation_terms_;
+  // Reused between updates to avoid allocating on every observation.
+  std::vector<ChannelParameters> candidates_;
   PartialObservation partial_observation_;
   Timestamp last_send_time_most_recent_observation_ = Timestamp::PlusInfinity();
   Timestamp last_time_estimate_reduced_ = Timestamp::MinusInfinity();
@@ -0,0 +1,96 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "api/field_trials.h"
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "modules/congestion_controller/goog_cc/loss_based_bwe_v2.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+// Each iteration replays this many feedback reports through a fresh
+// estimator, i.e. 10 seconds of traffic.
+constexpr int kNumFeedbacks = 200;
+constexpr int kPacketsPerFeedback = 100;
+constexpr TimeDelta kFeedbackInterval = TimeDelta::Millis(50);
+constexpr DataSize kPacketSize = DataSize::Bytes(1200);
+constexpr TimeDelta kOneWayDelay = TimeDelta::Millis(30);
+constexpr int kLossPercent = 5;
+
+std::vector<std::vector<PacketResult>> CreateFeedbacks() {
+  Random random(0x5678);
+  const TimeDelta packet_interval = kFeedbackInterval / kPacketsPerFeedback;
+  std::vector<std::vector<PacketResult>> feedbacks(kNumFeedbacks);
+  Timestamp send_time = Timestamp::Seconds(10);
+  int64_t sequence_number = 0;
+  for (std::vector<PacketResult>& feedback : feedbacks) {
+    for (int i = 0; i < kPacketsPerFeedback; ++i) {
+      PacketResult packet;
+      packet.sent_packet.send_time = send_time;
+      packet.sent_packet.size = kPacketSize;
+      packet.sent_packet.sequence_number = sequence_number++;
+      if (random.Rand(1, 100) > kLossPercent) {
+        packet.receive_time = send_time + kOneWayDelay;
+      }
+      feedback.push_back(packet);
+      send_time += packet_interval;
+    }
+  }
+  return feedbacks;
+}
+
+// Runs the solver on every feedback report: the observation duration lower
+// bound is shorter than the feedback interval, so each report creates a new
+// observation.
+void BM_UpdateBandwidthEstimate(benchmark::State& state) {
+  const FieldTrials field_trials(
+      "WebRTC-Bwe-LossBasedBweV2/Enabled:true,ObservationDurationLowerBound:" +
+      std::to_string(kFeedbackInterval.ms() / 2) +
+      "ms,ObservationWindowSize:" + std::to_string(state.range(0)) + "/");
+  const std::vector<std::vector<PacketResult>> feedbacks = CreateFeedbacks();
+  const DataRate delay_based_estimate = DataRate::KilobitsPerSec(20'000);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto loss_based_bwe = std::make_unique<LossBasedBweV2>(&field_trials);
+    loss_based_bwe->SetMinMaxBitrate(DataRate::KilobitsPerSec(30),
+                                     DataRate::KilobitsPerSec(50'000));
+    loss_based_bwe->SetBandwidthEstimate(delay_based_estimate);
+    state.ResumeTiming();
+
+    for (const std::vector<PacketResult>& feedback : feedbacks) {
+      loss_based_bwe->SetAcknowledgedBitrate(DataRate::KilobitsPerSec(18'000));
+      loss_based_bwe->UpdateBandwidthEstimate(feedback, delay_based_estimate,
+                                              /*in_alr=*/false);
+      benchmark::DoNotOptimize(loss_based_bwe->GetLossBasedResult());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumFeedbacks);
+  state.counters["time_per_feedback"] =
+      benchmark::Counter(kNumFeedbacks,
+                         benchmark::Counter::kIsIterationInvariantRate |
+                             benchmark::Counter::kInvert);
+}
+
+// Observation window sizes.
+BENCHMARK(BM_UpdateBandwidthEstimate)->Arg(15)->Arg(50);
+
+}  // namespace
+}  // namespace webrtc
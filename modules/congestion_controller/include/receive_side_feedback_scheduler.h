@@ -0,0 +1,90 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_CONGESTION_CONTROLLER_INCLUDE_RECEIVE_SIDE_FEEDBACK_SCHEDULER_H_
+#define MODULES_CONGESTION_CONTROLLER_INCLUDE_RECEIVE_SIDE_FEEDBACK_SCHEDULER_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "api/sequence_checker.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/congestion_controller/include/receive_side_congestion_controller.h"
+#include "rtc_base/system/no_unique_address.h"
+#include "rtc_base/task_utils/repeating_task.h"
+#include "rtc_base/thread_annotations.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+
+// Runs `ReceiveSideCongestionController::MaybeProcess` on behalf of many
+// controllers, e.g. one per transport on a server, from a single repeating
+// task instead of one timer per controller.
+//
+// Controllers are kept in a timer wheel with slots of `tick`. Every tick only
+// the controllers that are due are processed, after which they are put back in
+// the slot of their next process time rounded up to a whole tick. Feedback may
+// thus be sent up to one tick later than with a timer per controller. Process
+// times further away than the wheel covers are handled by processing the
+// controller early, which is a no-op until it is actually due.
+//
+// All methods must be called on the same sequence, which is the one the
+// controllers are processed on.
+class ReceiveSideFeedbackScheduler {
+ public:
+  static constexpr TimeDelta kDefaultTick = TimeDelta::Millis(5);
+  static constexpr int kNumSlots = 128;
+
+  ReceiveSideFeedbackScheduler(TaskQueueBase* task_queue,
+                               Clock* clock,
+                               TimeDelta tick = kDefaultTick);
+  ~ReceiveSideFeedbackScheduler();
+
+  // `controller` is processed on the next tick and then whenever it is due,
+  // until it is unregistered.
+  void RegisterController(ReceiveSideCongestionController* controller);
+  void UnregisterController(ReceiveSideCongestionController* controller);
+
+ private:
+  int64_t TickAtOrAfter(Timestamp time) const;
+  Timestamp TickTime(int64_t tick) const;
+  // Puts `controller` in the slot it is due in after `delay`, returns the tick
+  // of that slot.
+  int64_t Schedule(ReceiveSideCongestionController* controller,
+                   Timestamp now,
+                   TimeDelta delay) RTC_RUN_ON(sequence_checker_);
+  TimeDelta ProcessDueControllers() RTC_RUN_ON(sequence_checker_);
+
+  TaskQueueBase* const task_queue_;
+  Clock* const clock_;
+  const TimeDelta tick_;
+
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker sequence_checker_;
+  RepeatingTaskHandle repeating_task_ RTC_GUARDED_BY(sequence_checker_);
+  // First tick that has not been processed yet.
+  int64_t next_tick_ RTC_GUARDED_BY(sequence_checker_) = 0;
+  // Tick the repeating task is going to run at next.
+  int64_t wakeup_tick_ RTC_GUARDED_BY(sequence_checker_) = 0;
+  // Slot `tick % kNumSlots` holds the controllers due at `tick`.
+  std::array<std::vector<ReceiveSideCongestionController*>, kNumSlots> slots_
+      RTC_GUARDED_BY(sequence_checker_);
+  size_t num_scheduled_ RTC_GUARDED_BY(sequence_checker_) = 0;
+  // Controllers being processed, kept as a member to reuse its allocation.
+  std::vector<ReceiveSideCongestionController*> due_controllers_
+      RTC_GUARDED_BY(sequence_checker_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_CONGESTION_CONTROLLER_INCLUDE_RECEIVE_SIDE_FEEDBACK_SCHEDULER_H_
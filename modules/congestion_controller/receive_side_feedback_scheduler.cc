@@ -0,0 +1,153 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/congestion_controller/include/receive_side_feedback_scheduler.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "api/sequence_checker.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/congestion_controller/include/receive_side_congestion_controller.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/task_utils/repeating_task.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+
+constexpr TimeDelta ReceiveSideFeedbackScheduler::kDefaultTick;
+constexpr int ReceiveSideFeedbackScheduler::kNumSlots;
+
+ReceiveSideFeedbackScheduler::ReceiveSideFeedbackScheduler(
+    TaskQueueBase* task_queue,
+    Clock* clock,
+    TimeDelta tick)
+    : task_queue_(task_queue), clock_(clock), tick_(tick) {
+  RTC_DCHECK(task_queue_);
+  RTC_DCHECK(tick_ > TimeDelta::Zero());
+  sequence_checker_.Detach();
+}
+
+ReceiveSideFeedbackScheduler::~ReceiveSideFeedbackScheduler() {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  RTC_DCHECK_EQ(num_scheduled_, 0u);
+  repeating_task_.Stop();
+}
+
+void ReceiveSideFeedbackScheduler::RegisterController(
+    ReceiveSideCongestionController* controller) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  Timestamp now = clock_->CurrentTime();
+  if (!repeating_task_.Running()) {
+    // The wheel is empty, start it over from the current time.
+    RTC_DCHECK_EQ(num_scheduled_, 0u);
+    next_tick_ = TickAtOrAfter(now);
+  }
+  int64_t tick = Schedule(controller, now, TimeDelta::Zero());
+  if (repeating_task_.Running() && wakeup_tick_ <= tick) {
+    return;
+  }
+  // The task sleeps past the tick of the new controller, wake up earlier.
+  repeating_task_.Stop();
+  wakeup_tick_ = tick;
+  repeating_task_ = RepeatingTaskHandle::DelayedStart(
+      task_queue_, TickTime(tick) - now,
+      [this] {
+        RTC_DCHECK_RUN_ON(&sequence_checker_);
+        return ProcessDueControllers();
+      },
+      TaskQueueBase::DelayPrecision::kLow, clock_);
+}
+
+void ReceiveSideFeedbackScheduler::UnregisterController(
+    ReceiveSideCongestionController* controller) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  // Controllers that asked to never be processed again are in no slot.
+  for (std::vector<ReceiveSideCongestionController*>& slot : slots_) {
+    auto it = std::find(slot.begin(), slot.end(), controller);
+    if (it != slot.end()) {
+      *it = slot.back();
+      slot.pop_back();
+      --num_scheduled_;
+      break;
+    }
+  }
+  // Unregistered from within `MaybeProcess` of another controller.
+  std::replace(due_controllers_.begin(), due_controllers_.end(), controller,
+               static_cast<ReceiveSideCongestionController*>(nullptr));
+  if (num_scheduled_ == 0 && due_controllers_.empty()) {
+    repeating_task_.Stop();
+  }
+}
+
+int64_t ReceiveSideFeedbackScheduler::TickAtOrAfter(Timestamp time) const {
+  return (time.us() + tick_.us() - 1) / tick_.us();
+}
+
+Timestamp ReceiveSideFeedbackScheduler::TickTime(int64_t tick) const {
+  return Timestamp::Micros(tick * tick_.us());
+}
+
+int64_t ReceiveSideFeedbackScheduler::Schedule(
+    ReceiveSideCongestionController* controller,
+    Timestamp now,
+    TimeDelta delay) {
+  if (delay.IsPlusInfinity()) {
+    // Same as returning infinity from a repeating task, the controller is not
+    // processed again.
+    return next_tick_ + kNumSlots;
+  }
+  int64_t tick = std::clamp(TickAtOrAfter(now + delay), next_tick_,
+                            next_tick_ + kNumSlots - 1);
+  slots_[tick % kNumSlots].push_back(controller);
+  ++num_scheduled_;
+  return tick;
+}
+
+TimeDelta ReceiveSideFeedbackScheduler::ProcessDueControllers() {
+  Timestamp now = clock_->CurrentTime();
+  // Collect the controllers of all ticks that have passed before processing
+  // any, since rescheduled controllers may end up in one of those slots.
+  int64_t now_tick = now.us() / tick_.us();
+  int64_t end_tick = std::min(now_tick + 1, next_tick_ + kNumSlots);
+  for (int64_t tick = next_tick_; tick < end_tick; ++tick) {
+    std::vector<ReceiveSideCongestionController*>& slot =
+        slots_[tick % kNumSlots];
+    due_controllers_.insert(due_controllers_.end(), slot.begin(), slot.end());
+    slot.clear();
+  }
+  next_tick_ = std::max(next_tick_, now_tick + 1);
+  num_scheduled_ -= due_controllers_.size();
+
+  for (size_t i = 0; i < due_controllers_.size(); ++i) {
+    ReceiveSideCongestionController* controller = due_controllers_[i];
+    if (controller != nullptr) {
+      Schedule(controller, now, controller->MaybeProcess());
+    }
+  }
+  due_controllers_.clear();
+
+  if (num_scheduled_ == 0) {
+    repeating_task_.Stop();
+    return TimeDelta::PlusInfinity();
+  }
+  // Sleep until the next tick with controllers due, skipping empty slots.
+  wakeup_tick_ = next_tick_;
+  while (slots_[wakeup_tick_ % kNumSlots].empty()) {
+    ++wakeup_tick_;
+  }
+  return TickTime(wakeup_tick_) - now;
+}
+
+}  // namespace webrtc
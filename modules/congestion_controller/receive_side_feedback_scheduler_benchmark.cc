@@ -0,0 +1,175 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/location.h"
+#include "api/media_types.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "modules/congestion_controller/include/receive_side_congestion_controller.h"
+#include "modules/congestion_controller/include/receive_side_feedback_scheduler.h"
+#include "modules/rtp_rtcp/source/rtcp_packet.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/task_utils/repeating_task.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+namespace {
+
+// Every transport receives a packet this often, like an audio stream.
+constexpr int kPacketIntervalMs = 20;
+
+// Runs tasks in order of their due time on a simulated clock, like a worker
+// thread would, and counts the times the thread wakes up to do so.
+class SimulatedWorkerQueue : public TaskQueueBase {
+ public:
+  explicit SimulatedWorkerQueue(SimulatedClock* clock)
+      : clock_(clock), current_setter_(this) {}
+
+  void Delete() override {}
+
+  void AdvanceTime(TimeDelta duration) {
+    Timestamp end = clock_->CurrentTime() + duration;
+    while (!tasks_.empty() && tasks_.begin()->first <= end) {
+      auto it = tasks_.begin();
+      absl::AnyInvocable<void() &&> task = std::move(it->second);
+      if (it->first != last_wakeup_) {
+        last_wakeup_ = it->first;
+        ++num_wakeups_;
+      }
+      clock_->AdvanceTime(it->first - clock_->CurrentTime());
+      tasks_.erase(it);
+      ++num_tasks_;
+      std::move(task)();
+    }
+    clock_->AdvanceTime(end - clock_->CurrentTime());
+  }
+
+  int64_t num_wakeups() const { return num_wakeups_; }
+  int64_t num_tasks() const { return num_tasks_; }
+
+ private:
+  void PostTaskImpl(absl::AnyInvocable<void() &&> task,
+                    const PostTaskTraits& /* traits */,
+                    const Location& /* location */) override {
+    tasks_.emplace(clock_->CurrentTime(), std::move(task));
+  }
+  void PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
+                           TimeDelta delay,
+                           const PostDelayedTaskTraits& /* traits */,
+                           const Location& /* location */) override {
+    tasks_.emplace(clock_->CurrentTime() + delay, std::move(task));
+  }
+
+  SimulatedClock* const clock_;
+  CurrentTaskQueueSetter current_setter_;
+  std::multimap<Timestamp, absl::AnyInvocable<void() &&>> tasks_;
+  Timestamp last_wakeup_ = Timestamp::MinusInfinity();
+  int64_t num_wakeups_ = 0;
+  int64_t num_tasks_ = 0;
+};
+
+// Simulates one second of RFC 8888 feedback per iteration for `state.range(0)`
+// transports, each with its own repeating task if `state.range(1)` is 0 and
+// processed by a shared ReceiveSideFeedbackScheduler otherwise.
+void BM_ProcessFeedback(benchmark::State& state) {
+  const int num_transports = state.range(0);
+  const bool use_scheduler = state.range(1) != 0;
+  SimulatedClock clock(Timestamp::Seconds(1000));
+  SimulatedWorkerQueue worker(&clock);
+  const Environment env = CreateEnvironment(&clock);
+  int64_t num_feedback_packets = 0;
+
+  std::vector<std::unique_ptr<ReceiveSideCongestionController>> controllers;
+  for (int i = 0; i < num_transports; ++i) {
+    controllers.push_back(std::make_unique<ReceiveSideCongestionController>(
+        env,
+        [&](std::vector<std::unique_ptr<rtcp::RtcpPacket>> packets) {
+          num_feedback_packets += packets.size();
+        },
+        [](uint64_t /* bitrate_bps */, std::vector<uint32_t> /* ssrcs */) {}));
+    controllers.back()->EnableSendCongestionControlFeedbackAccordingToRfc8888();
+  }
+  ReceiveSideFeedbackScheduler scheduler(&worker, &clock);
+  std::vector<RepeatingTaskHandle> repeating_tasks;
+  for (const auto& controller : controllers) {
+    if (use_scheduler) {
+      scheduler.RegisterController(controller.get());
+    } else {
+      // Same as what Call does without a scheduler.
+      repeating_tasks.push_back(RepeatingTaskHandle::Start(
+          &worker,
+          [controller = controller.get()] {
+            return controller->MaybeProcess();
+          },
+          TaskQueueBase::DelayPrecision::kLow, &clock));
+    }
+  }
+
+  RtpPacketReceived packet;
+  packet.SetSsrc(0x1234);
+  packet.SetMarker(true);
+  packet.SetPayloadSize(100);
+  uint16_t sequence_number = 0;
+  const int64_t start_wakeups = worker.num_wakeups();
+  const int64_t start_tasks = worker.num_tasks();
+  for (auto _ : state) {
+    for (int ms = 0; ms < 1000; ++ms) {
+      if (ms % kPacketIntervalMs == 0) {
+        packet.SetSequenceNumber(sequence_number++);
+      }
+      // Packets of different transports are spread over the packet interval.
+      for (int i = ms % kPacketIntervalMs; i < num_transports;
+           i += kPacketIntervalMs) {
+        packet.set_arrival_time(clock.CurrentTime());
+        controllers[i]->OnReceivedPacket(packet, MediaType::AUDIO);
+      }
+      worker.AdvanceTime(TimeDelta::Millis(1));
+    }
+  }
+
+  for (const auto& controller : controllers) {
+    if (use_scheduler) {
+      scheduler.UnregisterController(controller.get());
+    }
+  }
+  for (RepeatingTaskHandle& repeating_task : repeating_tasks) {
+    repeating_task.Stop();
+  }
+  // Every iteration simulates one second.
+  state.SetItemsProcessed(state.iterations() * num_transports);
+  state.counters["wakeups_per_second"] =
+      static_cast<double>(worker.num_wakeups() - start_wakeups) /
+      state.iterations();
+  state.counters["tasks_per_second"] =
+      static_cast<double>(worker.num_tasks() - start_tasks) /
+      state.iterations();
+  state.counters["feedback_per_second"] =
+      static_cast<double>(num_feedback_packets) / state.iterations();
+}
+
+// Number of transports, and 0 for a repeating task per transport or 1 for the
+// shared scheduler.
+BENCHMARK(BM_ProcessFeedback)
+    ->ArgsProduct({{10, 100, 1000, 5000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace webrtc
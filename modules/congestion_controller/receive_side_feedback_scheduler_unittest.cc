@@ -0,0 +1,129 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/congestion_controller/include/receive_side_feedback_scheduler.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/media_types.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/congestion_controller/include/receive_side_congestion_controller.h"
+#include "modules/rtp_rtcp/source/rtcp_packet.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+#include "test/time_controller/simulated_time_controller.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::MockFunction;
+
+class ReceiveSideFeedbackSchedulerTest : public ::testing::Test {
+ protected:
+  ReceiveSideFeedbackSchedulerTest()
+      : time_controller_(Timestamp::Seconds(1000)),
+        env_(CreateEnvironment(time_controller_.GetClock())),
+        scheduler_(time_controller_.GetMainThread(),
+                   time_controller_.GetClock()) {}
+
+  std::unique_ptr<ReceiveSideCongestionController> CreateController(
+      MockFunction<void(std::vector<std::unique_ptr<rtcp::RtcpPacket>>)>&
+          feedback_sender) {
+    auto controller = std::make_unique<ReceiveSideCongestionController>(
+        env_, feedback_sender.AsStdFunction(),
+        [](uint64_t /* bitrate_bps */, std::vector<uint32_t> /* ssrcs */) {});
+    controller->EnableSendCongestionControlFeedbackAccordingToRfc8888();
+    return controller;
+  }
+
+  void ReceivePacket(ReceiveSideCongestionController& controller) {
+    RtpPacketReceived packet;
+    packet.set_arrival_time(time_controller_.GetClock()->CurrentTime());
+    controller.OnReceivedPacket(packet, MediaType::VIDEO);
+  }
+
+  GlobalSimulatedTimeController time_controller_;
+  const Environment env_;
+  ReceiveSideFeedbackScheduler scheduler_;
+};
+
+TEST_F(ReceiveSideFeedbackSchedulerTest, SendsFeedbackForAllControllers) {
+  MockFunction<void(std::vector<std::unique_ptr<rtcp::RtcpPacket>>)>
+      feedback_sender1;
+  MockFunction<void(std::vector<std::unique_ptr<rtcp::RtcpPacket>>)>
+      feedback_sender2;
+  std::unique_ptr<ReceiveSideCongestionController> controller1 =
+      CreateController(feedback_sender1);
+  std::unique_ptr<ReceiveSideCongestionController> controller2 =
+      CreateController(feedback_sender2);
+  scheduler_.RegisterController(controller1.get());
+  scheduler_.RegisterController(controller2.get());
+
+  EXPECT_CALL(feedback_sender1, Call).Times(1);
+  EXPECT_CALL(feedback_sender2, Call).Times(1);
+  ReceivePacket(*controller1);
+  time_controller_.AdvanceTime(TimeDelta::Millis(2));
+  ReceivePacket(*controller2);
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+
+  scheduler_.UnregisterController(controller1.get());
+  scheduler_.UnregisterController(controller2.get());
+}
+
+TEST_F(ReceiveSideFeedbackSchedulerTest, SendsNoFeedbackAfterUnregistering) {
+  MockFunction<void(std::vector<std::unique_ptr<rtcp::RtcpPacket>>)>
+      feedback_sender1;
+  MockFunction<void(std::vector<std::unique_ptr<rtcp::RtcpPacket>>)>
+      feedback_sender2;
+  std::unique_ptr<ReceiveSideCongestionController> controller1 =
+      CreateController(feedback_sender1);
+  std::unique_ptr<ReceiveSideCongestionController> controller2 =
+      CreateController(feedback_sender2);
+  scheduler_.RegisterController(controller1.get());
+  scheduler_.RegisterController(controller2.get());
+  time_controller_.AdvanceTime(TimeDelta::Millis(100));
+  scheduler_.UnregisterController(controller1.get());
+
+  EXPECT_CALL(feedback_sender1, Call).Times(0);
+  EXPECT_CALL(feedback_sender2, Call).Times(1);
+  ReceivePacket(*controller1);
+  ReceivePacket(*controller2);
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+
+  scheduler_.UnregisterController(controller2.get());
+}
+
+TEST_F(ReceiveSideFeedbackSchedulerTest,
+       SendsFeedbackAfterRegisteringAgainOnceEmpty) {
+  MockFunction<void(std::vector<std::unique_ptr<rtcp::RtcpPacket>>)>
+      feedback_sender;
+  std::unique_ptr<ReceiveSideCongestionController> controller =
+      CreateController(feedback_sender);
+  scheduler_.RegisterController(controller.get());
+  time_controller_.AdvanceTime(TimeDelta::Millis(100));
+  scheduler_.UnregisterController(controller.get());
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+  scheduler_.RegisterController(controller.get());
+
+  EXPECT_CALL(feedback_sender, Call).Times(1);
+  ReceivePacket(*controller);
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+
+  scheduler_.UnregisterController(controller.get());
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <deque>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -30,6 +31,7 @@
 #include "modules/rtp_rtcp/source/rtcp_packet/transport_feedback.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/containers/flat_map.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/network/sent_packet.h"
 #include "rtc_base/network_route.h"
@@ -120,26 +122,31 @@ void TransportFeedbackAdapter::AddPacket(const RtpPacketToSend& packet_to_send,
       packet_to_send.packet_type() == RtpPacketMediaType::kRetransmission;
 
   while (!history_.empty() &&
-         creation_time - history_.begin()->second.creation_time >
+         creation_time - history_.front()->creation_time >
              kSendTimeHistoryWindow) {
     // TODO(sprang): Warn if erasing (too many) old items?
-    if (history_.begin()->second.sent.sequence_number > last_ack_seq_num_)
-      in_flight_.RemoveInFlightPacketBytes(history_.begin()->second);
-
-    const PacketFeedback& packet = history_.begin()->second;
-    rtp_to_transport_sequence_number_.erase(
-        {.ssrc = packet.ssrc,
-         .rtp_sequence_number = packet.rtp_sequence_number});
-    history_.erase(history_.begin());
+    const PacketFeedback& packet = *history_.front();
+    if (packet.sent.sequence_number > last_ack_seq_num_)
+      in_flight_.RemoveInFlightPacketBytes(packet);
+
+    const int64_t transport_seq_num = packet.sent.sequence_number;
+    const SsrcAndRtpSequencenumber key = {
+        .ssrc = packet.ssrc, .rtp_sequence_number = packet.rtp_sequence_number};
+    RemoveFromHistory(transport_seq_num);
+    RemoveTransportSequenceNumber(key, transport_seq_num);
+    auto ssrc_it = rtp_to_transport_sequence_number_.find(key.ssrc);
+    if (ssrc_it != rtp_to_transport_sequence_number_.end() &&
+        ssrc_it->second.transport_sequence_numbers.empty()) {
+      rtp_to_transport_sequence_number_.erase(ssrc_it);
+    }
   }
   // Note that it can happen that the same SSRC and sequence number is sent
   // again. e.g, audio retransmission.
-  rtp_to_transport_sequence_number_.emplace(
-      SsrcAndRtpSequencenumber(
-          {.ssrc = feedback.ssrc,
-           .rtp_sequence_number = feedback.rtp_sequence_number}),
+  AddTransportSequenceNumber(
+      {.ssrc = feedback.ssrc,
+       .rtp_sequence_number = feedback.rtp_sequence_number},
       feedback.sent.sequence_number);
-  history_.emplace(feedback.sent.sequence_number, feedback);
+  AddToHistory(feedback);
 }
 
 std::optional<SentPacket> TransportFeedbackAdapter::ProcessSentPacket(
@@ -149,10 +156,10 @@ std::optional<SentPacket> TransportFeedbackAdapter::ProcessSentPacket(
   if (sent_packet.info.included_in_feedback || sent_packet.packet_id != -1) {
     int64_t unwrapped_seq_num =
         seq_num_unwrapper_.Unwrap(sent_packet.packet_id);
-    auto it = history_.find(unwrapped_seq_num);
-    if (it != history_.end()) {
-      bool packet_retransmit = it->second.sent.send_time.IsFinite();
-      it->second.sent.send_time = send_time;
+    PacketFeedback* packet = FindPacket(unwrapped_seq_num);
+    if (packet != nullptr) {
+      bool packet_retransmit = packet->sent.send_time.IsFinite();
+      packet->sent.send_time = send_time;
       last_send_time_ = std::max(last_send_time_, send_time);
       // TODO(srte): Don't do this on retransmit.
       if (!pending_untracked_size_.IsZero()) {
@@ -160,14 +167,14 @@ std::optional<SentPacket> TransportFeedbackAdapter::ProcessSentPacket(
           RTC_LOG(LS_WARNING)
               << "appending acknowledged data for out of order packet. (Diff: "
               << ToString(last_untracked_send_time_ - send_time) << " ms.)";
-        it->second.sent.prior_unacked_data += pending_untracked_size_;
+        packet->sent.prior_unacked_data += pending_untracked_size_;
         pending_untracked_size_ = DataSize::Zero();
       }
       if (!packet_retransmit) {
-        if (it->second.sent.sequence_number > last_ack_seq_num_)
-          in_flight_.AddInFlightPacketBytes(it->second);
-        it->second.sent.data_in_flight = GetOutstandingData();
-        return it->second.sent;
+        if (packet->sent.sequence_number > last_ack_seq_num_)
+          in_flight_.AddInFlightPacketBytes(*packet);
+        packet->sent.data_in_flight = GetOutstandingData();
+        return packet->sent;
       }
     }
   } else if (sent_packet.info.included_in_allocation) {
@@ -363,35 +370,43 @@ DataSize TransportFeedbackAdapter::GetOutstandingData() const {
 std::optional<PacketFeedback> TransportFeedbackAdapter::RetrievePacketFeedback(
     const SsrcAndRtpSequencenumber& key,
     bool received) {
-  auto it = rtp_to_transport_sequence_number_.find(key);
-  if (it == rtp_to_transport_sequence_number_.end()) {
+  std::optional<int64_t> transport_seq_num = FindTransportSequenceNumber(key);
+  if (!transport_seq_num) {
     return std::nullopt;
   }
-  return RetrievePacketFeedback(it->second, received);
+  return RetrievePacketFeedback(*transport_seq_num, received);
 }
 
 std::optional<PacketFeedback> TransportFeedbackAdapter::RetrievePacketFeedback(
     int64_t transport_seq_num,
     bool received) {
   if (transport_seq_num > last_ack_seq_num_) {
-    // Starts at history_.begin() if last_ack_seq_num_ < 0, since any
-    // valid sequence number is >= 0.
-    for (auto it = history_.upper_bound(last_ack_seq_num_);
-         it != history_.upper_bound(transport_seq_num); ++it) {
-      in_flight_.RemoveInFlightPacketBytes(it->second);
+    // Packets in (`last_ack_seq_num_`, `transport_seq_num`] are no longer in
+    // flight.
+    const int64_t history_end_seq_num =
+        history_first_seq_num_ + static_cast<int64_t>(history_.size());
+    for (int64_t seq_num =
+             std::max(last_ack_seq_num_ + 1, history_first_seq_num_);
+         seq_num <= transport_seq_num && seq_num < history_end_seq_num;
+         ++seq_num) {
+      const std::optional<PacketFeedback>& packet =
+          history_[seq_num - history_first_seq_num_];
+      if (packet) {
+        in_flight_.RemoveInFlightPacketBytes(*packet);
+      }
     }
     last_ack_seq_num_ = transport_seq_num;
   }
 
-  auto it = history_.find(transport_seq_num);
-  if (it == history_.end()) {
+  const PacketFeedback* packet = FindPacket(transport_seq_num);
+  if (packet == nullptr) {
     RTC_LOG(LS_WARNING) << "Failed to lookup send time for packet with "
                         << transport_seq_num
                         << ". Send time history too small?";
     return std::nullopt;
   }
 
-  if (it->second.sent.send_time.IsInfinite()) {
+  if (packet->sent.send_time.IsInfinite()) {
     // TODO(srte): Fix the tests that makes this happen and make this a
     // DCHECK.
     RTC_DLOG(LS_ERROR)
@@ -399,16 +414,137 @@ std::optional<PacketFeedback> TransportFeedbackAdapter::RetrievePacketFeedback(
     return std::nullopt;
   }
 
-  PacketFeedback packet_feedback = it->second;
+  PacketFeedback packet_feedback = *packet;
   if (received) {
     // Note: Lost packets are not removed from history because they might
     // be reported as received by a later feedback.
-    rtp_to_transport_sequence_number_.erase(
+    RemoveFromHistory(transport_seq_num);
+    RemoveTransportSequenceNumber(
         {.ssrc = packet_feedback.ssrc,
-         .rtp_sequence_number = packet_feedback.rtp_sequence_number});
-    history_.erase(it);
+         .rtp_sequence_number = packet_feedback.rtp_sequence_number},
+        transport_seq_num);
   }
   return packet_feedback;
 }
 
+PacketFeedback* TransportFeedbackAdapter::FindPacket(
+    int64_t transport_seq_num) {
+  const int64_t index = transport_seq_num - history_first_seq_num_;
+  if (index < 0 || index >= static_cast<int64_t>(history_.size()) ||
+      !history_[index]) {
+    return nullptr;
+  }
+  return &*history_[index];
+}
+
+void TransportFeedbackAdapter::AddToHistory(const PacketFeedback& packet) {
+  const int64_t transport_seq_num = packet.sent.sequence_number;
+  if (history_.empty()) {
+    history_first_seq_num_ = transport_seq_num;
+  }
+  int64_t index = transport_seq_num - history_first_seq_num_;
+  if (index < 0) {
+    history_.insert(history_.begin(), -index, std::nullopt);
+    history_first_seq_num_ = transport_seq_num;
+    index = 0;
+  } else if (index >= static_cast<int64_t>(history_.size())) {
+    history_.resize(index + 1);
+  }
+  if (!history_[index]) {
+    history_[index] = packet;
+  }
+}
+
+void TransportFeedbackAdapter::RemoveFromHistory(int64_t transport_seq_num) {
+  const int64_t index = transport_seq_num - history_first_seq_num_;
+  if (index < 0 || index >= static_cast<int64_t>(history_.size())) {
+    return;
+  }
+  history_[index].reset();
+  while (!history_.empty() && !history_.front()) {
+    history_.pop_front();
+    ++history_first_seq_num_;
+  }
+}
+
+std::optional<int64_t> TransportFeedbackAdapter::FindTransportSequenceNumber(
+    const SsrcAndRtpSequencenumber& key) {
+  auto it = rtp_to_transport_sequence_number_.find(key.ssrc);
+  if (it == rtp_to_transport_sequence_number_.end()) {
+    return std::nullopt;
+  }
+  const RtpSequenceNumberHistory& ssrc_history = it->second;
+  const int64_t index =
+      ssrc_history.unwrapper.PeekUnwrap(key.rtp_sequence_number) -
+      ssrc_history.first_sequence_number;
+  if (index < 0 ||
+      index >= static_cast<int64_t>(
+                   ssrc_history.transport_sequence_numbers.size())) {
+    return std::nullopt;
+  }
+  const int64_t transport_seq_num =
+      ssrc_history.transport_sequence_numbers[index];
+  // The packet may have been removed from the history without the mapping
+  // being removed, e.g. if the same RTP sequence number was sent twice.
+  if (transport_seq_num < 0 || FindPacket(transport_seq_num) == nullptr) {
+    return std::nullopt;
+  }
+  return transport_seq_num;
+}
+
+void TransportFeedbackAdapter::AddTransportSequenceNumber(
+    const SsrcAndRtpSequencenumber& key,
+    int64_t transport_seq_num) {
+  RtpSequenceNumberHistory& ssrc_history =
+      rtp_to_transport_sequence_number_[key.ssrc];
+  std::deque<int64_t>& transport_seq_nums =
+      ssrc_history.transport_sequence_numbers;
+  const int64_t rtp_seq_num =
+      ssrc_history.unwrapper.Unwrap(key.rtp_sequence_number);
+  if (transport_seq_nums.empty()) {
+    ssrc_history.first_sequence_number = rtp_seq_num;
+  }
+  int64_t index = rtp_seq_num - ssrc_history.first_sequence_number;
+  if (index < 0) {
+    transport_seq_nums.insert(transport_seq_nums.begin(), -index, -1);
+    ssrc_history.first_sequence_number = rtp_seq_num;
+    index = 0;
+  } else if (index >= static_cast<int64_t>(transport_seq_nums.size())) {
+    transport_seq_nums.resize(index + 1, -1);
+  }
+  // Keep the mapping of the first packet sent with this RTP sequence number,
+  // unless that packet has been removed from the history.
+  if (transport_seq_nums[index] < 0 ||
+      FindPacket(transport_seq_nums[index]) == nullptr) {
+    transport_seq_nums[index] = transport_seq_num;
+  }
+}
+
+void TransportFeedbackAdapter::RemoveTransportSequenceNumber(
+    const SsrcAndRtpSequencenumber& key,
+    int64_t transport_seq_num) {
+  auto it = rtp_to_transport_sequence_number_.find(key.ssrc);
+  if (it == rtp_to_transport_sequence_number_.end()) {
+    return;
+  }
+  RtpSequenceNumberHistory& ssrc_history = it->second;
+  std::deque<int64_t>& transport_seq_nums =
+      ssrc_history.transport_sequence_numbers;
+  const int64_t index =
+      ssrc_history.unwrapper.PeekUnwrap(key.rtp_sequence_number) -
+      ssrc_history.first_sequence_number;
+  if (index >= 0 && index < static_cast<int64_t>(transport_seq_nums.size()) &&
+      transport_seq_nums[index] == transport_seq_num) {
+    transport_seq_nums[index] = -1;
+  }
+  // Also drop leading mappings to packets that are no longer in the history,
+  // so that the first slot is always in use.
+  while (!transport_seq_nums.empty() &&
+         (transport_seq_nums.front() < 0 ||
+          FindPacket(transport_seq_nums.front()) == nullptr)) {
+    transport_seq_nums.pop_front();
+    ++ssrc_history.first_sequence_number;
+  }
+}
+
 }  // namespace webrtc
@@ -13,9 +13,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <map>
 #include <optional>
-#include <tuple>
 #include <vector>
 
 #include "api/transport/network_types.h"
@@ -24,6 +24,7 @@
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/congestion_control_feedback.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/containers/flat_map.h"
 #include "rtc_base/network/sent_packet.h"
 #include "rtc_base/network_route.h"
 #include "rtc_base/numerics/sequence_number_unwrapper.h"
@@ -92,11 +93,16 @@ class TransportFeedbackAdapter {
   struct SsrcAndRtpSequencenumber {
     uint32_t ssrc;
     uint16_t rtp_sequence_number;
+  };
 
-    bool operator<(const SsrcAndRtpSequencenumber& other) const {
-      return std::tie(ssrc, rtp_sequence_number) <
-             std::tie(other.ssrc, other.rtp_sequence_number);
-    }
+  // Transport sequence numbers of the packets sent on one SSRC, indexed by
+  // unwrapped RTP sequence number relative to `first_sequence_number`. Slots
+  // without a mapping hold -1. Leading slots that don't map to a packet in
+  // `history_` are removed.
+  struct RtpSequenceNumberHistory {
+    RtpSequenceNumberUnwrapper unwrapper;
+    int64_t first_sequence_number = 0;
+    std::deque<int64_t> transport_sequence_numbers;
   };
 
   std::optional<PacketFeedback> RetrievePacketFeedback(
@@ -110,6 +116,21 @@ class TransportFeedbackAdapter {
       Timestamp feedback_receive_time,
       bool supports_ecn);
 
+  // Returns the packet with the given transport sequence number, or nullptr
+  // if it is not in the send history.
+  PacketFeedback* FindPacket(int64_t transport_seq_num);
+  void AddToHistory(const PacketFeedback& packet);
+  void RemoveFromHistory(int64_t transport_seq_num);
+
+  // Returns the transport sequence number of the packet in the send history
+  // with the given SSRC and RTP sequence number, if any.
+  std::optional<int64_t> FindTransportSequenceNumber(
+      const SsrcAndRtpSequencenumber& key);
+  void AddTransportSequenceNumber(const SsrcAndRtpSequencenumber& key,
+                                  int64_t transport_seq_num);
+  void RemoveTransportSequenceNumber(const SsrcAndRtpSequencenumber& key,
+                                     int64_t transport_seq_num);
+
   DataSize pending_untracked_size_ = DataSize::Zero();
   Timestamp last_send_time_ = Timestamp::MinusInfinity();
   Timestamp last_untracked_send_time_ = Timestamp::MinusInfinity();
@@ -130,9 +151,16 @@ class TransportFeedbackAdapter {
   std::optional<uint32_t> last_feedback_compact_ntp_time_;
 
   // Map SSRC and RTP sequence number to transport sequence number.
-  std::map<SsrcAndRtpSequencenumber, int64_t /*transport_sequence_number*/>
+  flat_map<uint32_t, RtpSequenceNumberHistory>
       rtp_to_transport_sequence_number_;
-  std::map<int64_t, PacketFeedback> history_;
+
+  // Sent packets, indexed by transport sequence number relative to
+  // `history_first_seq_num_`. Packets are removed from the history when
+  // feedback reports them as received, or when they are older than the send
+  // time history window. Removed packets leave an empty slot, except at the
+  // front, so that the oldest packet is always `history_.front()`.
+  std::deque<std::optional<PacketFeedback>> history_;
+  int64_t history_first_seq_num_ = 0;
 };
 
 }  // namespace webrtc
@@ -0,0 +1,209 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "api/transport/ecn_marking.h"
+#include "api/transport/network_types.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "modules/congestion_controller/rtp/transport_feedback_adapter.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/ntp_time_util.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/congestion_control_feedback.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/transport_feedback.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/network/sent_packet.h"
+#include "rtc_base/random.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+namespace {
+
+// Number of packets sent through a fresh adapter per iteration; one second of
+// traffic at 10k packets/s.
+constexpr int kNumPackets = 10000;
+constexpr TimeDelta kPacketInterval = TimeDelta::Micros(100);
+// Packets are spread round robin over one audio and two video SSRCs.
+constexpr uint32_t kSsrcs[] = {1111, 2222, 3333};
+constexpr size_t kNumSsrcs = sizeof(kSsrcs) / sizeof(kSsrcs[0]);
+// Start close to the wrap around of the 16 bit sequence numbers.
+constexpr uint16_t kFirstTransportSequenceNumber = 60000;
+constexpr uint16_t kFirstRtpSequenceNumber = 65000;
+constexpr int kLossPercent = 5;
+const PacedPacketInfo kPacingInfo(0, 5, 2000);
+
+struct SimulatedPacket {
+  RtpPacketToSend rtp_packet;
+  Timestamp send_time;
+  // Infinite if the packet was lost.
+  Timestamp receive_time;
+};
+
+std::vector<SimulatedPacket> CreatePackets() {
+  Random random(0x1234);
+  std::vector<SimulatedPacket> packets;
+  packets.reserve(kNumPackets);
+  Timestamp send_time = Timestamp::Seconds(1);
+  for (int i = 0; i < kNumPackets; ++i) {
+    const size_t ssrc_index = i % kNumSsrcs;
+    RtpPacketToSend rtp_packet(nullptr);
+    rtp_packet.SetSsrc(kSsrcs[ssrc_index]);
+    rtp_packet.SetSequenceNumber(
+        static_cast<uint16_t>(kFirstRtpSequenceNumber + i / kNumSsrcs));
+    rtp_packet.SetPayloadSize(ssrc_index == 0 ? 100 : 1100);
+    rtp_packet.set_transport_sequence_number(
+        static_cast<uint16_t>(kFirstTransportSequenceNumber + i));
+    rtp_packet.set_packet_type(ssrc_index == 0 ? RtpPacketMediaType::kAudio
+                                               : RtpPacketMediaType::kVideo);
+    const bool lost = random.Rand(1, 100) <= kLossPercent;
+    packets.push_back(
+        {.rtp_packet = std::move(rtp_packet),
+         .send_time = send_time,
+         .receive_time = lost ? Timestamp::PlusInfinity()
+                              : send_time + TimeDelta::Millis(20)});
+    send_time += kPacketInterval;
+  }
+  return packets;
+}
+
+std::vector<rtcp::TransportFeedback> CreateTransportFeedback(
+    const std::vector<SimulatedPacket>& packets,
+    size_t packets_per_feedback) {
+  std::vector<rtcp::TransportFeedback> feedbacks;
+  for (size_t begin = 0; begin < packets.size();
+       begin += packets_per_feedback) {
+    const size_t end = std::min(begin + packets_per_feedback, packets.size());
+    rtcp::TransportFeedback feedback;
+    bool has_base = false;
+    for (size_t i = begin; i < end; ++i) {
+      if (packets[i].receive_time.IsInfinite())
+        continue;
+      const uint16_t sequence_number =
+          *packets[i].rtp_packet.transport_sequence_number();
+      if (!has_base) {
+        feedback.SetBase(sequence_number, packets[i].receive_time);
+        has_base = true;
+      }
+      feedback.AddReceivedPacket(sequence_number, packets[i].receive_time);
+    }
+    // Feedback without any received packets is ignored by the adapter, but
+    // is kept so that there is one feedback per batch of sent packets.
+    feedbacks.push_back(std::move(feedback));
+  }
+  return feedbacks;
+}
+
+std::vector<rtcp::CongestionControlFeedback> CreateCongestionControlFeedback(
+    const std::vector<SimulatedPacket>& packets,
+    size_t packets_per_feedback) {
+  std::vector<rtcp::CongestionControlFeedback> feedbacks;
+  SimulatedClock clock(Timestamp::Zero());
+  for (size_t begin = 0; begin < packets.size();
+       begin += packets_per_feedback) {
+    const size_t end = std::min(begin + packets_per_feedback, packets.size());
+    // Assume the feedback was sent when the last packet was received.
+    const Timestamp feedback_sent_time =
+        packets[end - 1].send_time + TimeDelta::Millis(20);
+    std::vector<rtcp::CongestionControlFeedback::PacketInfo> packet_infos;
+    packet_infos.reserve(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+      rtcp::CongestionControlFeedback::PacketInfo packet_info = {
+          .ssrc = packets[i].rtp_packet.Ssrc(),
+          .sequence_number = packets[i].rtp_packet.SequenceNumber(),
+          .ecn = EcnMarking::kNotEct};
+      if (packets[i].receive_time.IsFinite()) {
+        packet_info.arrival_time_offset =
+            feedback_sent_time - packets[i].receive_time;
+      }
+      packet_infos.push_back(packet_info);
+    }
+    feedbacks.emplace_back(
+        std::move(packet_infos),
+        CompactNtp(clock.ConvertTimestampToNtpTime(feedback_sent_time)));
+  }
+  return feedbacks;
+}
+
+void SendPackets(const std::vector<SimulatedPacket>& packets,
+                 size_t begin,
+                 size_t end,
+                 TransportFeedbackAdapter& adapter) {
+  for (size_t i = begin; i < end; ++i) {
+    const SimulatedPacket& packet = packets[i];
+    adapter.AddPacket(packet.rtp_packet, kPacingInfo, /*overhead_bytes=*/0u,
+                      packet.send_time);
+    std::optional<SentPacket> sent_packet =
+        adapter.ProcessSentPacket(SentPacketInfo(
+            *packet.rtp_packet.transport_sequence_number(),
+            packet.send_time.ms(), PacketInfo()));
+    benchmark::DoNotOptimize(sent_packet);
+  }
+}
+
+// Sends `packets_per_feedback` packets, then processes the feedback for them,
+// until all packets have been sent.
+template <typename FeedbackType, typename ProcessFeedback>
+void RunFeedbackLoop(benchmark::State& state,
+                     const std::vector<SimulatedPacket>& packets,
+                     const std::vector<FeedbackType>& feedbacks,
+                     ProcessFeedback process_feedback) {
+  const size_t packets_per_feedback = state.range(0);
+  size_t packet_results = 0;
+  for (auto _ : state) {
+    TransportFeedbackAdapter adapter;
+    size_t begin = 0;
+    for (const FeedbackType& feedback : feedbacks) {
+      const size_t end = std::min(begin + packets_per_feedback, packets.size());
+      SendPackets(packets, begin, end, adapter);
+      std::optional<TransportPacketsFeedback> result =
+          process_feedback(adapter, feedback, packets[end - 1].send_time);
+      if (result)
+        packet_results += result->packet_feedbacks.size();
+      begin = end;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * packets.size());
+  state.counters["packet_results_per_iteration"] =
+      static_cast<double>(packet_results) / state.iterations();
+}
+
+void BM_ProcessTransportFeedback(benchmark::State& state) {
+  const std::vector<SimulatedPacket> packets = CreatePackets();
+  RunFeedbackLoop(
+      state, packets, CreateTransportFeedback(packets, state.range(0)),
+      [](TransportFeedbackAdapter& adapter,
+         const rtcp::TransportFeedback& feedback, Timestamp now) {
+        return adapter.ProcessTransportFeedback(feedback, now);
+      });
+}
+
+void BM_ProcessCongestionControlFeedback(benchmark::State& state) {
+  const std::vector<SimulatedPacket> packets = CreatePackets();
+  RunFeedbackLoop(
+      state, packets, CreateCongestionControlFeedback(packets, state.range(0)),
+      [](TransportFeedbackAdapter& adapter,
+         const rtcp::CongestionControlFeedback& feedback, Timestamp now) {
+        return adapter.ProcessCongestionControlFeedback(feedback, now);
+      });
+}
+
+// Number of packets reported per feedback message.
+BENCHMARK(BM_ProcessTransportFeedback)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_ProcessCongestionControlFeedback)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace webrtc
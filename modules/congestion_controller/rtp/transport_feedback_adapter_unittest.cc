@@ -401,6 +401,39 @@ TEST_P(TransportFeedbackAdapterTest, HandlesArrivalReordering) {
   ComparePacketFeedbackVectors(packets, adapted_feedback->packet_feedbacks);
 }
 
+TEST_P(TransportFeedbackAdapterTest, HandlesSequenceNumberWrapAround) {
+  TransportFeedbackAdapter adapter;
+
+  std::vector<PacketTemplate> packets = {
+      {.transport_sequence_number = 0xfffe,
+       .rtp_sequence_number = 0xfffe,
+       .send_timestamp = Timestamp::Millis(200),
+       .receive_timestamp = Timestamp::Millis(100)},
+      {.transport_sequence_number = 0xffff,
+       .rtp_sequence_number = 0xffff,
+       .send_timestamp = Timestamp::Millis(210),
+       .receive_timestamp = Timestamp::Millis(110)},
+      {.transport_sequence_number = 0x10000,
+       .rtp_sequence_number = 0,
+       .send_timestamp = Timestamp::Millis(220),
+       .receive_timestamp = Timestamp::Millis(120)},
+      {.transport_sequence_number = 0x10001,
+       .rtp_sequence_number = 1,
+       .send_timestamp = Timestamp::Millis(230),
+       .receive_timestamp = Timestamp::Millis(130)}};
+
+  for (const PacketTemplate& packet : packets) {
+    adapter.AddPacket(CreatePacketToSend(packet), packet.pacing_info,
+                      /*overhead=*/0u, TimeNow());
+    adapter.ProcessSentPacket(SentPacketInfo(packet.transport_sequence_number,
+                                             packet.send_timestamp.ms()));
+  }
+
+  std::optional<TransportPacketsFeedback> adapted_feedback =
+      CreateAndProcessFeedback(packets, adapter);
+  ComparePacketFeedbackVectors(packets, adapted_feedback->packet_feedbacks);
+}
+
 TEST_P(TransportFeedbackAdapterTest, IgnoreDuplicatePacketSentCalls) {
   TransportFeedbackAdapter adapter;
 
@@ -404,17 +404,25 @@ std::vector<rtcp::ReportBlock> ReceiveStatisticsImpl::RtcpReportBlocks(
     size_t max_blocks) {
   std::vector<rtcp::ReportBlock> result;
   result.reserve(std::min(max_blocks, all_ssrcs_.size()));
+  AppendRtcpReportBlocks(max_blocks, result);
+  return result;
+}
 
+void ReceiveStatisticsImpl::AppendRtcpReportBlocks(
+    size_t max_blocks,
+    std::vector<rtcp::ReportBlock>& report_blocks) {
+  const size_t initial_size = report_blocks.size();
   size_t ssrc_idx = 0;
-  for (size_t i = 0; i < all_ssrcs_.size() && result.size() < max_blocks; ++i) {
+  for (size_t i = 0; i < all_ssrcs_.size() &&
+                     report_blocks.size() - initial_size < max_blocks;
+       ++i) {
     ssrc_idx = (last_returned_ssrc_idx_ + i + 1) % all_ssrcs_.size();
     const uint32_t media_ssrc = all_ssrcs_[ssrc_idx];
     auto statistician_it = statisticians_.find(media_ssrc);
     RTC_DCHECK(statistician_it != statisticians_.end());
-    statistician_it->second->MaybeAppendReportBlockAndReset(result);
+    statistician_it->second->MaybeAppendReportBlockAndReset(report_blocks);
   }
   last_returned_ssrc_idx_ = ssrc_idx;
-  return result;
 }
 
 }  // namespace webrtc
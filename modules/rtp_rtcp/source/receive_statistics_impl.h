@@ -174,6 +174,9 @@ class ReceiveStatisticsImpl : public ReceiveStatistics {
 
   // Implements ReceiveStatisticsProvider.
   std::vector<rtcp::ReportBlock> RtcpReportBlocks(size_t max_blocks) override;
+  void AppendRtcpReportBlocks(
+      size_t max_blocks,
+      std::vector<rtcp::ReportBlock>& report_blocks) override;
 
   // Implements RtpPacketSinkInterface
   void OnRtpPacket(const RtpPacketReceived& packet) override;
@@ -213,6 +216,12 @@ class ReceiveStatisticsLocked : public ReceiveStatistics {
     MutexLock lock(&receive_statistics_lock_);
     return impl_.RtcpReportBlocks(max_blocks);
   }
+  void AppendRtcpReportBlocks(
+      size_t max_blocks,
+      std::vector<rtcp::ReportBlock>& report_blocks) override {
+    MutexLock lock(&receive_statistics_lock_);
+    impl_.AppendRtcpReportBlocks(max_blocks, report_blocks);
+  }
   void OnRtpPacket(const RtpPacketReceived& packet) override {
     MutexLock lock(&receive_statistics_lock_);
     return impl_.OnRtpPacket(packet);
@@ -28,6 +28,7 @@
 namespace webrtc {
 namespace {
 
+using ::testing::IsSupersetOf;
 using ::testing::SizeIs;
 using ::testing::UnorderedElementsAre;
 
@@ -213,6 +214,31 @@ TEST_P(ReceiveStatisticsTest,
               UnorderedElementsAre(kSsrc1, kSsrc2, kSsrc3, kSsrc4));
 }
 
+TEST_P(ReceiveStatisticsTest,
+       AppendRtcpReportBlocksAppendsAtMostMaxBlocksToExistingBlocks) {
+  RtpPacketReceived packet1 = CreateRtpPacket(kSsrc1, kPacketSize1);
+  RtpPacketReceived packet2 = CreateRtpPacket(kSsrc2, kPacketSize1);
+  RtpPacketReceived packet3 = CreateRtpPacket(kSsrc3, kPacketSize1);
+  receive_statistics_->OnRtpPacket(packet1);
+  receive_statistics_->OnRtpPacket(packet2);
+  receive_statistics_->OnRtpPacket(packet3);
+
+  std::vector<rtcp::ReportBlock> report_blocks(1);
+  report_blocks[0].SetMediaSsrc(kSsrc4);
+  receive_statistics_->AppendRtcpReportBlocks(2, report_blocks);
+  ASSERT_THAT(report_blocks, SizeIs(3));
+  EXPECT_EQ(report_blocks[0].source_ssrc(), kSsrc4);
+
+  receive_statistics_->AppendRtcpReportBlocks(2, report_blocks);
+  ASSERT_THAT(report_blocks, SizeIs(5));
+  std::vector<uint32_t> observed_ssrcs;
+  for (size_t i = 1; i < report_blocks.size(); ++i) {
+    observed_ssrcs.push_back(report_blocks[i].source_ssrc());
+  }
+  // The second call continues with the statisticians not yet reported on.
+  EXPECT_THAT(observed_ssrcs, IsSupersetOf({kSsrc1, kSsrc2, kSsrc3}));
+}
+
 TEST_P(ReceiveStatisticsTest, ActiveStatisticians) {
   receive_statistics_->OnRtpPacket(packet1_);
   IncrementSequenceNumber(&packet1_);
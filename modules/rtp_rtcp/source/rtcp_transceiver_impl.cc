@@ -145,6 +145,12 @@ RtcpTransceiverImpl::RtcpTransceiverImpl(const RtcpTransceiverConfig& config)
       rtcp_transport_(GetRtcpTransport(config_)),
       ready_to_send_(config.initial_ready_to_send) {
   RTC_CHECK(config_.Validate());
+  if (!config_.cname.empty()) {
+    sdes_.emplace();
+    bool added = sdes_->AddCName(config_.feedback_ssrc, config_.cname);
+    RTC_DCHECK(added) << "Failed to add CNAME " << config_.cname
+                      << " to RTCP SDES packet.";
+  }
   if (ready_to_send_ && config_.schedule_periodic_compound_packets) {
     SchedulePeriodicCompoundPackets(config_.initial_report_delay);
   }
@@ -644,7 +650,7 @@ void RtcpTransceiverImpl::SchedulePeriodicCompoundPackets(TimeDelta delay) {
       TaskQueueBase::DelayPrecision::kLow, config_.clock);
 }
 
-std::vector<uint32_t> RtcpTransceiverImpl::FillReports(
+ArrayView<const uint32_t> RtcpTransceiverImpl::FillReports(
     Timestamp now,
     ReservedBytes reserved,
     PacketSender& rtcp_sender) {
@@ -676,20 +682,19 @@ std::vector<uint32_t> RtcpTransceiverImpl::FillReports(
         rtcp::ReportBlock::kLength;
   }
 
-  std::vector<rtcp::ReportBlock> report_blocks =
-      CreateReportBlocks(now, max_report_blocks);
+  CreateReportBlocks(now, max_report_blocks);
   // Previous calculation of max number of sender report made space for max
   // number of report blocks per sender report, but if number of report blocks
   // is low, more sender reports may fit in.
   size_t max_sender_reports =
-      (available_bytes - report_blocks.size() * rtcp::ReportBlock::kLength) /
+      (available_bytes - report_blocks_.size() * rtcp::ReportBlock::kLength) /
       sender_report_size_bytes;
 
   auto last_handled_sender_it = local_senders_.end();
-  auto report_block_it = report_blocks.begin();
-  std::vector<uint32_t> sender_ssrcs;
+  auto report_block_it = report_blocks_.begin();
+  sender_ssrcs_.clear();
   for (auto it = local_senders_.begin();
-       it != local_senders_.end() && sender_ssrcs.size() < max_sender_reports;
+       it != local_senders_.end() && sender_ssrcs_.size() < max_sender_reports;
        ++it) {
     LocalSenderState& rtp_sender = *it;
     RtpStreamRtcpHandler::RtpStats stats = rtp_sender.handler->SentStats();
@@ -706,27 +711,24 @@ std::vector<uint32_t> RtcpTransceiverImpl::FillReports(
     rtp_sender.last_num_sent_bytes = stats.num_sent_bytes();
 
     last_handled_sender_it = it;
-    rtcp::SenderReport sender_report;
-    sender_report.SetSenderSsrc(rtp_sender.ssrc);
-    sender_report.SetPacketCount(stats.num_sent_packets());
-    sender_report.SetOctetCount(stats.num_sent_bytes());
-    sender_report.SetNtp(config_.clock->ConvertTimestampToNtpTime(now));
+    sender_report_.SetSenderSsrc(rtp_sender.ssrc);
+    sender_report_.SetPacketCount(stats.num_sent_packets());
+    sender_report_.SetOctetCount(stats.num_sent_bytes());
+    sender_report_.SetNtp(config_.clock->ConvertTimestampToNtpTime(now));
     RTC_DCHECK_GE(now, stats.last_capture_time());
-    sender_report.SetRtpTimestamp(
+    sender_report_.SetRtpTimestamp(
         stats.last_rtp_timestamp() +
         ((now - stats.last_capture_time()) * stats.last_clock_rate())
             .seconds());
-    if (report_block_it != report_blocks.end()) {
-      size_t num_blocks =
-          std::min<size_t>(rtcp::SenderReport::kMaxNumberOfReportBlocks,
-                           report_blocks.end() - report_block_it);
-      std::vector<rtcp::ReportBlock> sub_blocks(report_block_it,
-                                                report_block_it + num_blocks);
-      sender_report.SetReportBlocks(std::move(sub_blocks));
-      report_block_it += num_blocks;
+    sender_report_.ClearReportBlocks();
+    size_t num_blocks =
+        std::min<size_t>(rtcp::SenderReport::kMaxNumberOfReportBlocks,
+                         report_blocks_.end() - report_block_it);
+    for (size_t i = 0; i < num_blocks; ++i) {
+      sender_report_.AddReportBlock(*report_block_it++);
     }
-    rtcp_sender.AppendPacket(sender_report);
-    sender_ssrcs.push_back(rtp_sender.ssrc);
+    rtcp_sender.AppendPacket(sender_report_);
+    sender_ssrcs_.push_back(rtp_sender.ssrc);
   }
   if (last_handled_sender_it != local_senders_.end()) {
     // Rotate `local_senders_` so that the 1st unhandled sender become first in
@@ -739,33 +741,31 @@ std::vector<uint32_t> RtcpTransceiverImpl::FillReports(
 
   // Calculcate number of receiver reports to attach remaining report blocks to.
   size_t num_receiver_reports =
-      DivideRoundUp(report_blocks.end() - report_block_it,
+      DivideRoundUp(report_blocks_.end() - report_block_it,
                     rtcp::ReceiverReport::kMaxNumberOfReportBlocks);
 
   // In compound mode each RTCP packet has to start with a sender or receiver
   // report.
-  if (config_.rtcp_mode == RtcpMode::kCompound && sender_ssrcs.empty() &&
+  if (config_.rtcp_mode == RtcpMode::kCompound && sender_ssrcs_.empty() &&
       num_receiver_reports == 0) {
     num_receiver_reports = 1;
   }
 
-  uint32_t sender_ssrc =
-      sender_ssrcs.empty() ? config_.feedback_ssrc : sender_ssrcs.front();
+  receiver_report_.SetSenderSsrc(
+      sender_ssrcs_.empty() ? config_.feedback_ssrc : sender_ssrcs_.front());
   for (size_t i = 0; i < num_receiver_reports; ++i) {
-    rtcp::ReceiverReport receiver_report;
-    receiver_report.SetSenderSsrc(sender_ssrc);
+    receiver_report_.ClearReportBlocks();
     size_t num_blocks =
         std::min<size_t>(rtcp::ReceiverReport::kMaxNumberOfReportBlocks,
-                         report_blocks.end() - report_block_it);
-    std::vector<rtcp::ReportBlock> sub_blocks(report_block_it,
-                                              report_block_it + num_blocks);
-    receiver_report.SetReportBlocks(std::move(sub_blocks));
-    report_block_it += num_blocks;
-    rtcp_sender.AppendPacket(receiver_report);
+                         report_blocks_.end() - report_block_it);
+    for (size_t j = 0; j < num_blocks; ++j) {
+      receiver_report_.AddReportBlock(*report_block_it++);
+    }
+    rtcp_sender.AppendPacket(receiver_report_);
   }
   // All report blocks should be attached at this point.
-  RTC_DCHECK_EQ(report_blocks.end() - report_block_it, 0);
-  return sender_ssrcs;
+  RTC_DCHECK_EQ(report_blocks_.end() - report_block_it, 0);
+  return sender_ssrcs_;
 }
 
 void RtcpTransceiverImpl::CreateCompoundPacket(Timestamp now,
@@ -773,13 +773,8 @@ void RtcpTransceiverImpl::CreateCompoundPacket(Timestamp now,
                                                PacketSender& sender) {
   RTC_DCHECK(sender.IsEmpty());
   ReservedBytes reserved = {.per_packet = reserved_bytes};
-  std::optional<rtcp::Sdes> sdes;
-  if (!config_.cname.empty()) {
-    sdes.emplace();
-    bool added = sdes->AddCName(config_.feedback_ssrc, config_.cname);
-    RTC_DCHECK(added) << "Failed to add CNAME " << config_.cname
-                      << " to RTCP SDES packet.";
-    reserved.per_packet += sdes->BlockLength();
+  if (sdes_.has_value()) {
+    reserved.per_packet += sdes_->BlockLength();
   }
   if (remb_.has_value()) {
     reserved.per_packet += remb_->BlockLength();
@@ -815,13 +810,13 @@ void RtcpTransceiverImpl::CreateCompoundPacket(Timestamp now,
     reserved.per_packet += (4 + 4 + rtcp::Rrtr::kLength);
   }
 
-  std::vector<uint32_t> sender_ssrcs = FillReports(now, reserved, sender);
+  ArrayView<const uint32_t> sender_ssrcs = FillReports(now, reserved, sender);
   bool has_sender_report = !sender_ssrcs.empty();
   uint32_t sender_ssrc =
-      has_sender_report ? sender_ssrcs.front() : config_.feedback_ssrc;
+      has_sender_report ? sender_ssrcs[0] : config_.feedback_ssrc;
 
-  if (sdes.has_value() && !sender.IsEmpty()) {
-    sender.AppendPacket(*sdes);
+  if (sdes_.has_value() && !sender.IsEmpty()) {
+    sender.AppendPacket(*sdes_);
   }
   if (remb_.has_value()) {
     remb_->SetSenderSsrc(sender_ssrc);
@@ -886,16 +881,16 @@ void RtcpTransceiverImpl::SendImmediateFeedback(
     ReschedulePeriodicCompoundPackets();
 }
 
-std::vector<rtcp::ReportBlock> RtcpTransceiverImpl::CreateReportBlocks(
-    Timestamp now,
-    size_t num_max_blocks) {
+void RtcpTransceiverImpl::CreateReportBlocks(Timestamp now,
+                                             size_t num_max_blocks) {
+  report_blocks_.clear();
   if (!config_.receive_statistics)
-    return {};
-  std::vector<rtcp::ReportBlock> report_blocks =
-      config_.receive_statistics->RtcpReportBlocks(num_max_blocks);
+    return;
+  config_.receive_statistics->AppendRtcpReportBlocks(num_max_blocks,
+                                                     report_blocks_);
   uint32_t last_sr = 0;
   uint32_t last_delay = 0;
-  for (rtcp::ReportBlock& report_block : report_blocks) {
+  for (rtcp::ReportBlock& report_block : report_blocks_) {
     auto it = remote_senders_.find(report_block.source_ssrc());
     if (it == remote_senders_.end() ||
         !it->second.last_received_sender_report) {
@@ -909,7 +904,6 @@ std::vector<rtcp::ReportBlock> RtcpTransceiverImpl::CreateReportBlocks(
     report_block.SetLastSr(last_sr);
     report_block.SetDelayLastSr(last_delay);
   }
-  return report_blocks;
 }
 
 }  // namespace webrtc
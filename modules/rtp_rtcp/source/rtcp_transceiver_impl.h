@@ -26,8 +26,11 @@
 #include "modules/rtp_rtcp/source/rtcp_packet.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/common_header.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/dlrr.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/receiver_report.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/remb.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/sdes.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/sender_report.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/target_bitrate.h"
 #include "modules/rtp_rtcp/source/rtcp_transceiver_config.h"
 #include "rtc_base/containers/flat_map.h"
@@ -133,14 +136,15 @@ class RtcpTransceiverImpl {
   // Appends RTCP sender and receiver reports to the `sender`.
   // Both sender and receiver reports may have attached report blocks.
   // Uses up to `config_.max_packet_size - reserved_bytes.per_packet`
-  // Returns list of sender ssrc in sender reports.
+  // Returns list of sender ssrc in sender reports, which stays valid until the
+  // next call.
   struct ReservedBytes {
     size_t per_packet = 0;
     size_t per_sender = 0;
   };
-  std::vector<uint32_t> FillReports(Timestamp now,
-                                    ReservedBytes reserved_bytes,
-                                    PacketSender& rtcp_sender);
+  ArrayView<const uint32_t> FillReports(Timestamp now,
+                                        ReservedBytes reserved_bytes,
+                                        PacketSender& rtcp_sender);
 
   // Creates compound RTCP packet, as defined in
   // https://tools.ietf.org/html/rfc5506#section-2
@@ -151,14 +155,15 @@ class RtcpTransceiverImpl {
   // Sends RTCP packets.
   void SendPeriodicCompoundPacket();
   void SendImmediateFeedback(const rtcp::RtcpPacket& rtcp_packet);
-  // Generate Report Blocks to be send in Sender or Receiver Reports.
-  std::vector<rtcp::ReportBlock> CreateReportBlocks(Timestamp now,
-                                                    size_t num_max_blocks);
+  // Generate Report Blocks to be send in Sender or Receiver Reports into
+  // `report_blocks_`.
+  void CreateReportBlocks(Timestamp now, size_t num_max_blocks);
 
   const RtcpTransceiverConfig config_;
   std::function<void(ArrayView<const uint8_t>)> rtcp_transport_;
 
   bool ready_to_send_;
+  std::optional<rtcp::Sdes> sdes_;
   std::optional<rtcp::Remb> remb_;
   // TODO(bugs.webrtc.org/8239): Remove entries from remote_senders_ that are no
   // longer needed.
@@ -168,6 +173,13 @@ class RtcpTransceiverImpl {
       local_senders_by_ssrc_;
   flat_map<uint32_t, RrtrTimes> received_rrtrs_;
   RepeatingTaskHandle periodic_task_handle_;
+
+  // Reused by every compound packet, so that building the reports does not
+  // allocate once their capacity has grown to fit all streams.
+  std::vector<rtcp::ReportBlock> report_blocks_;
+  std::vector<uint32_t> sender_ssrcs_;
+  rtcp::SenderReport sender_report_;
+  rtcp::ReceiverReport receiver_report_;
 };
 
 }  // namespace webrtc
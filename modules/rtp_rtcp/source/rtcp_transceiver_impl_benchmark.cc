@@ -0,0 +1,119 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "modules/rtp_rtcp/include/receive_statistics.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
+#include "modules/rtp_rtcp/source/rtcp_transceiver_config.h"
+#include "modules/rtp_rtcp/source/rtcp_transceiver_impl.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+namespace {
+
+// Reports on a fixed set of remote streams, like a server receiving from many
+// participants over one transport.
+class FakeReceiveStatistics : public ReceiveStatisticsProvider {
+ public:
+  explicit FakeReceiveStatistics(int num_streams) {
+    for (int i = 0; i < num_streams; ++i) {
+      rtcp::ReportBlock report_block;
+      report_block.SetMediaSsrc(0x10000 + i);
+      report_block.SetExtHighestSeqNum(1000 + i);
+      report_block.SetJitter(i);
+      report_blocks_.push_back(report_block);
+    }
+  }
+
+  std::vector<rtcp::ReportBlock> RtcpReportBlocks(size_t max_blocks) override {
+    std::vector<rtcp::ReportBlock> report_blocks;
+    AppendRtcpReportBlocks(max_blocks, report_blocks);
+    return report_blocks;
+  }
+  void AppendRtcpReportBlocks(
+      size_t max_blocks,
+      std::vector<rtcp::ReportBlock>& report_blocks) override {
+    for (size_t i = 0; i < report_blocks_.size() && i < max_blocks; ++i) {
+      report_blocks.push_back(report_blocks_[next_++ % report_blocks_.size()]);
+    }
+  }
+
+ private:
+  std::vector<rtcp::ReportBlock> report_blocks_;
+  size_t next_ = 0;
+};
+
+class FakeRtpStreamRtcpHandler : public RtpStreamRtcpHandler {
+ public:
+  RtpStats SentStats() override {
+    // Sender reports are only generated for streams that sent media since the
+    // previous report.
+    stats_.set_num_sent_packets(stats_.num_sent_packets() + 1);
+    stats_.set_num_sent_bytes(stats_.num_sent_bytes() + 1200);
+    return stats_;
+  }
+
+ private:
+  RtpStats stats_;
+};
+
+// Sends periodic compound packets with reports on `state.range(0)` remote
+// streams and sender reports for `state.range(1)` local streams. Streams that
+// do not fit into one packet are reported on in the following ones.
+void BM_SendCompoundPacket(benchmark::State& state) {
+  const int num_remote_streams = state.range(0);
+  const int num_local_streams = state.range(1);
+  SimulatedClock clock(Timestamp::Seconds(1000));
+  FakeReceiveStatistics receive_statistics(num_remote_streams);
+  size_t num_packets = 0;
+  size_t num_bytes = 0;
+
+  RtcpTransceiverConfig config;
+  config.feedback_ssrc = 0x1234;
+  config.cname = "benchmark";
+  config.clock = &clock;
+  config.receive_statistics = &receive_statistics;
+  config.schedule_periodic_compound_packets = false;
+  config.rtcp_transport = [&](ArrayView<const uint8_t> packet) {
+    ++num_packets;
+    num_bytes += packet.size();
+  };
+  RtcpTransceiverImpl rtcp_transceiver(config);
+  std::vector<std::unique_ptr<FakeRtpStreamRtcpHandler>> handlers;
+  for (int i = 0; i < num_local_streams; ++i) {
+    handlers.push_back(std::make_unique<FakeRtpStreamRtcpHandler>());
+    rtcp_transceiver.AddMediaSender(0x20000 + i, handlers.back().get());
+  }
+
+  for (auto _ : state) {
+    rtcp_transceiver.SendCompoundPacket();
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(num_bytes);
+  state.counters["packets_per_report"] =
+      static_cast<double>(num_packets) / state.iterations();
+}
+
+// Number of remote and local streams.
+BENCHMARK(BM_SendCompoundPacket)
+    ->Args({1, 1})
+    ->Args({31, 0})
+    ->Args({100, 20})
+    ->Args({1000, 100});
+
+}  // namespace
+}  // namespace webrtc
@@ -104,7 +104,8 @@ NackRequester::NackInfo::NackInfo()
       send_at_seq_num(0),
       created_at_time(Timestamp::MinusInfinity()),
       sent_at_time(Timestamp::MinusInfinity()),
-      retries(0) {}
+      retries(0),
+      removed(false) {}
 
 NackRequester::NackInfo::NackInfo(uint16_t seq_num,
                                   uint16_t send_at_seq_num,
@@ -113,7 +114,8 @@ NackRequester::NackInfo::NackInfo(uint16_t seq_num,
       send_at_seq_num(send_at_seq_num),
       created_at_time(created_at_time),
       sent_at_time(Timestamp::MinusInfinity()),
-      retries(0) {}
+      retries(0),
+      removed(false) {}
 
 NackRequester::NackRequester(TaskQueueBase* current_queue,
                              NackPeriodicProcessor* periodic_processor,
@@ -178,11 +180,11 @@ int NackRequester::OnReceivedPacket(uint16_t seq_num, bool is_recovered) {
 
   if (AheadOf(newest_seq_num_, seq_num)) {
     // An out of order packet has been received.
-    auto nack_list_it = nack_list_.find(seq_num);
+    NackInfo* nack_info = FindNack(seq_num);
     int nacks_sent_for_packet = 0;
-    if (nack_list_it != nack_list_.end()) {
-      nacks_sent_for_packet = nack_list_it->second.retries;
-      nack_list_.erase(nack_list_it);
+    if (nack_info != nullptr) {
+      nacks_sent_for_packet = nack_info->retries;
+      RemoveNack(*nack_info);
     }
     if (!is_retransmitted)
       UpdateReorderingStatistics(seq_num);
@@ -222,7 +224,7 @@ void NackRequester::ClearUpTo(uint16_t seq_num) {
   // needs to be posted to the worker thread if callers migrate to the network
   // thread.
   RTC_DCHECK_RUN_ON(worker_thread_);
-  nack_list_.erase(nack_list_.begin(), nack_list_.lower_bound(seq_num));
+  RemoveNacksOlderThan(seq_num);
   recovered_list_.erase(recovered_list_.begin(),
                         recovered_list_.lower_bound(seq_num));
 }
@@ -236,12 +238,11 @@ void NackRequester::AddPacketsToNack(uint16_t seq_num_start,
                                      uint16_t seq_num_end) {
   // Called on worker_thread_.
   // Remove old packets.
-  auto it = nack_list_.lower_bound(seq_num_end - kMaxPacketAge);
-  nack_list_.erase(nack_list_.begin(), it);
+  RemoveNacksOlderThan(static_cast<uint16_t>(seq_num_end - kMaxPacketAge));
 
   uint16_t num_new_nacks = ForwardDiff(seq_num_start, seq_num_end);
-  if (nack_list_.size() + num_new_nacks > kMaxNackPackets) {
-    nack_list_.clear();
+  if (num_nacks_ + num_new_nacks > kMaxNackPackets) {
+    ClearNackList();
     RTC_LOG(LS_WARNING) << "NACK list full, clearing NACK"
                            " list and requesting keyframe.";
     keyframe_request_sender_->RequestKeyFrame();
@@ -252,11 +253,83 @@ void NackRequester::AddPacketsToNack(uint16_t seq_num_start,
     // Do not send nack for packets that are already recovered by FEC or RTX
     if (recovered_list_.find(seq_num) != recovered_list_.end())
       continue;
-    NackInfo nack_info(seq_num, seq_num + WaitNumberOfPackets(0.5),
-                       clock_->CurrentTime());
-    RTC_DCHECK(nack_list_.find(seq_num) == nack_list_.end());
-    nack_list_[seq_num] = nack_info;
+    RTC_DCHECK(nack_list_.empty() ||
+               AheadOf(seq_num, nack_list_.back().seq_num));
+    const uint16_t send_at_seq_num = seq_num + WaitNumberOfPackets(0.5);
+    if (!nack_list_.empty() &&
+        AheadOf(nack_list_.back().send_at_seq_num, send_at_seq_num)) {
+      last_reordered_position_ = nack_list_front_position_ + nack_list_.size();
+    }
+    nack_list_.emplace_back(seq_num, send_at_seq_num, clock_->CurrentTime());
+    ++num_nacks_;
+  }
+}
+
+NackRequester::NackInfo* NackRequester::FindNack(uint16_t seq_num) {
+  auto it = std::lower_bound(nack_list_.begin(), nack_list_.end(), seq_num,
+                             [](const NackInfo& nack_info, uint16_t seq_num) {
+                               return AheadOf(seq_num, nack_info.seq_num);
+                             });
+  if (it == nack_list_.end() || it->seq_num != seq_num || it->removed)
+    return nullptr;
+  return &*it;
+}
+
+NackRequester::NackInfo* NackRequester::NackAtPosition(size_t position) {
+  if (position < nack_list_front_position_)
+    return nullptr;
+  RTC_DCHECK_LT(position - nack_list_front_position_, nack_list_.size());
+  NackInfo& nack_info = nack_list_[position - nack_list_front_position_];
+  return nack_info.removed ? nullptr : &nack_info;
+}
+
+void NackRequester::RemoveNack(NackInfo& nack_info) {
+  RTC_DCHECK(!nack_info.removed);
+  nack_info.removed = true;
+  --num_nacks_;
+  PopRemovedNacks();
+}
+
+void NackRequester::RemoveNacksOlderThan(uint16_t seq_num) {
+  while (!nack_list_.empty() && AheadOf(seq_num, nack_list_.front().seq_num)) {
+    if (!nack_list_.front().removed)
+      --num_nacks_;
+    nack_list_.pop_front();
+    ++nack_list_front_position_;
+  }
+  PopRemovedNacks();
+}
+
+void NackRequester::ClearNackList() {
+  nack_list_front_position_ += nack_list_.size();
+  nack_list_.clear();
+  num_nacks_ = 0;
+  first_unsent_position_ = nack_list_front_position_;
+  resend_queue_.clear();
+}
+
+void NackRequester::PopRemovedNacks() {
+  while (!nack_list_.empty() && nack_list_.front().removed) {
+    nack_list_.pop_front();
+    ++nack_list_front_position_;
   }
+  first_unsent_position_ =
+      std::max(first_unsent_position_, nack_list_front_position_);
+}
+
+bool NackRequester::SendNack(NackInfo& nack_info,
+                             Timestamp now,
+                             std::vector<uint16_t>& nack_batch) {
+  nack_batch.push_back(nack_info.seq_num);
+  ++nack_info.retries;
+  nack_info.sent_at_time = now;
+  if (nack_info.retries >= kMaxNackRetries) {
+    RTC_LOG(LS_WARNING) << "Sequence number " << nack_info.seq_num
+                        << " removed from NACK list due to max retries.";
+    RemoveNack(nack_info);
+    return false;
+  }
+  return true;
 }
 
 std::vector<uint16_t> NackRequester::GetNackBatch(NackFilterOptions options) {
@@ -266,28 +339,61 @@ std::vector<uint16_t> NackRequester::GetNackBatch(NackFilterOptions options) {
   bool consider_timestamp = options != kSeqNumOnly;
   Timestamp now = clock_->CurrentTime();
   std::vector<uint16_t> nack_batch;
-  auto it = nack_list_.begin();
-  while (it != nack_list_.end()) {
-    bool delay_timed_out = now - it->second.created_at_time >= send_nack_delay_;
-    bool nack_on_rtt_passed = now - it->second.sent_at_time >= rtt_;
+
+  if (consider_timestamp) {
+    // `resend_queue_` is ordered by the time the packets were last nacked, so
+    // the ones that are due to be nacked again are at the front. The packets
+    // nacked here are added back at the end, and are not looked at again.
+    for (size_t n = resend_queue_.size(); n > 0; --n) {
+      const size_t position = resend_queue_.front();
+      NackInfo* nack_info = NackAtPosition(position);
+      if (nack_info != nullptr && now - nack_info->sent_at_time < rtt_)
+        break;
+      resend_queue_.pop_front();
+      if (nack_info != nullptr && SendNack(*nack_info, now, nack_batch))
+        resend_queue_.push_back(position);
+    }
+  }
+
+  // Packets are nacked the first time in the order they were added to the
+  // list, which is also the order in which their send delay expires. The
+  // sequence number they wait for is increasing as well, except across a
+  // change of the reordering statistics. Up to `last_reordered_position_`, a
+  // packet may be due before the ones added before it, so the scan continues
+  // past packets that are still waiting for their sequence number.
+  const bool has_resends = !nack_batch.empty();
+  const size_t end_position = nack_list_front_position_ + nack_list_.size();
+  bool all_sent_before = true;
+  for (size_t position = first_unsent_position_; position < end_position;
+       ++position) {
+    NackInfo& nack_info = nack_list_[position - nack_list_front_position_];
+    // Entries past `first_unsent_position_` may have been nacked ahead of an
+    // entry before them.
+    if (nack_info.removed || nack_info.retries > 0) {
+      if (all_sent_before)
+        first_unsent_position_ = position + 1;
+      continue;
+    }
+    if (now - nack_info.created_at_time < send_nack_delay_)
+      break;
     bool nack_on_seq_num_passed =
-        it->second.sent_at_time.IsInfinite() &&
-        AheadOrAt(newest_seq_num_, it->second.send_at_seq_num);
-    if (delay_timed_out && ((consider_seq_num && nack_on_seq_num_passed) ||
-                            (consider_timestamp && nack_on_rtt_passed))) {
-      nack_batch.emplace_back(it->second.seq_num);
-      ++it->second.retries;
-      it->second.sent_at_time = now;
-      if (it->second.retries >= kMaxNackRetries) {
-        RTC_LOG(LS_WARNING) << "Sequence number " << it->second.seq_num
-                            << " removed from NACK list due to max retries.";
-        it = nack_list_.erase(it);
-      } else {
-        ++it;
-      }
+        AheadOrAt(newest_seq_num_, nack_info.send_at_seq_num);
+    if ((consider_seq_num && nack_on_seq_num_passed) || consider_timestamp) {
+      if (all_sent_before)
+        first_unsent_position_ = position + 1;
+      if (SendNack(nack_info, now, nack_batch))
+        resend_queue_.push_back(position);
       continue;
     }
-    ++it;
+    all_sent_before = false;
+    if (position >= last_reordered_position_)
+      break;
+  }
+
+  if (has_resends) {
+    // Keep the batch in sequence number order.
+    std::sort(nack_batch.begin(), nack_batch.end(),
+              DescendingSeqNumComp<uint16_t>());
   }
   return nack_batch;
 }
@@ -13,7 +13,8 @@
 
 #include <stdint.h>
 
-#include <map>
+#include <cstddef>
+#include <deque>
 #include <set>
 #include <vector>
 
@@ -104,11 +105,35 @@ class NackRequester final : public NackRequesterBase {
     Timestamp created_at_time;
     Timestamp sent_at_time;
     int retries;
+    // Set when the packet is received or given up on. The entry is then left
+    // in `nack_list_` until it reaches the front.
+    bool removed;
   };
 
   void AddPacketsToNack(uint16_t seq_num_start, uint16_t seq_num_end)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
 
+  // Returns the entry of `seq_num` if it is in the nack list, else nullptr.
+  NackInfo* FindNack(uint16_t seq_num)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
+  // Returns the entry at `position`, or nullptr if it has been removed.
+  NackInfo* NackAtPosition(size_t position)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
+  void RemoveNack(NackInfo& nack_info)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
+  // Removes all entries for sequence numbers older than `seq_num`.
+  void RemoveNacksOlderThan(uint16_t seq_num)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
+  void ClearNackList() RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
+  void PopRemovedNacks() RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
+  // Marks `nack_info` as nacked at `now` and adds it to `nack_batch`.
+  // Returns false if the packet has now been nacked the maximum number of
+  // times and has been removed from the nack list.
+  bool SendNack(NackInfo& nack_info,
+                Timestamp now,
+                std::vector<uint16_t>& nack_batch)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
+
   std::vector<uint16_t> GetNackBatch(NackFilterOptions options)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(worker_thread_);
 
@@ -129,8 +154,28 @@ class NackRequester final : public NackRequesterBase {
   // TODO(philipel): Some of the variables below are consistently used on a
   // known thread (e.g. see `initialized_`). Those probably do not need
   // synchronized access.
-  std::map<uint16_t, NackInfo, DescendingSeqNumComp<uint16_t>> nack_list_
-      RTC_GUARDED_BY(worker_thread_);
+  // Missing packets in ascending sequence number order. New packets are only
+  // ever added at the back, since they are newer than all packets already in
+  // the list, and removed entries are dropped once they reach the front.
+  // Entries are identified by their position, which is their index plus the
+  // number of entries ever dropped from the front.
+  std::deque<NackInfo> nack_list_ RTC_GUARDED_BY(worker_thread_);
+  size_t nack_list_front_position_ RTC_GUARDED_BY(worker_thread_) = 0;
+  // Number of entries in `nack_list_` that have not been removed.
+  size_t num_nacks_ RTC_GUARDED_BY(worker_thread_) = 0;
+  // Position of the oldest entry that has not been nacked yet. Entries are
+  // mostly nacked the first time in the order they were added, so entries
+  // from this position on have only been nacked if they were due before an
+  // entry ahead of them.
+  size_t first_unsent_position_ RTC_GUARDED_BY(worker_thread_) = 0;
+  // Position of the last entry added with an earlier `send_at_seq_num` than
+  // the entry before it, which happens when the reordering statistics change.
+  // From this position on, `send_at_seq_num` is increasing.
+  size_t last_reordered_position_ RTC_GUARDED_BY(worker_thread_) = 0;
+  // Positions of the nacked entries, in the order they were last nacked,
+  // which is also the order in which they are due to be nacked again.
+  // Positions of removed entries are skipped when they reach the front.
+  std::deque<size_t> resend_queue_ RTC_GUARDED_BY(worker_thread_);
   std::set<uint16_t, DescendingSeqNumComp<uint16_t>> recovered_list_
       RTC_GUARDED_BY(worker_thread_);
   video_coding::Histogram reordering_histogram_ RTC_GUARDED_BY(worker_thread_);
@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "api/field_trials.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "modules/include/module_common_types.h"
+#include "modules/video_coding/nack_requester.h"
+#include "rtc_base/random.h"
+#include "rtc_base/thread.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+namespace {
+
+// Number of packets replayed through a fresh NackRequester per iteration, one
+// packet per millisecond.
+constexpr int kNumPackets = 20'000;
+constexpr TimeDelta kPacketInterval = TimeDelta::Millis(1);
+constexpr TimeDelta kRtt = TimeDelta::Millis(100);
+// Lost packets are retransmitted and arrive this many packets late, unless
+// the retransmission is lost as well.
+constexpr int kRetransmissionDelayPackets = 150;
+// Mean length of a loss burst in packets.
+constexpr int kMeanBurstLength = 4;
+
+class CountingNackSender : public NackSender, public KeyFrameRequestSender {
+ public:
+  void SendNack(const std::vector<uint16_t>& sequence_numbers,
+                bool /* buffering_allowed */) override {
+    num_nacked_packets += sequence_numbers.size();
+  }
+  void RequestKeyFrame() override { ++num_keyframe_requests; }
+
+  size_t num_nacked_packets = 0;
+  int num_keyframe_requests = 0;
+};
+
+// Replays a stream with bursty loss, where every lost packet is retransmitted
+// until it arrives. `state.range(0)` is the loss rate in percent.
+void BM_ReplayLossyStream(benchmark::State& state) {
+  AutoThread main_thread;
+  FieldTrials field_trials("");
+  const int loss_percent = state.range(0);
+  // Probability of a burst starting such that the stationary loss rate of the
+  // Gilbert-Elliott model is `loss_percent`.
+  const double burst_start_probability =
+      loss_percent / ((100.0 - loss_percent) * kMeanBurstLength);
+  CountingNackSender sender;
+  for (auto _ : state) {
+    SimulatedClock clock(Timestamp::Seconds(1000));
+    // Nacks are processed manually below, in step with the simulated clock.
+    NackPeriodicProcessor processor(TimeDelta::Seconds(3600));
+    NackRequester nack_requester(TaskQueueBase::Current(), &processor, &clock,
+                                 &sender, &sender, field_trials);
+    nack_requester.UpdateRtt(kRtt.ms());
+    Random random(0x1234);
+    bool in_burst = false;
+    // Retransmissions in the order they arrive, as (arrival index, sequence
+    // number).
+    std::deque<std::pair<int, uint16_t>> retransmissions;
+    uint16_t seq_num = 0;
+    for (int i = 0; i < kNumPackets; ++i) {
+      clock.AdvanceTime(kPacketInterval);
+      in_burst = in_burst ? random.Rand<double>() > 1.0 / kMeanBurstLength
+                          : random.Rand<double>() < burst_start_probability;
+      if (in_burst) {
+        retransmissions.emplace_back(i + kRetransmissionDelayPackets, seq_num);
+      } else {
+        nack_requester.OnReceivedPacket(seq_num, /*is_recovered=*/false);
+      }
+      ++seq_num;
+      while (!retransmissions.empty() && retransmissions.front().first == i) {
+        uint16_t retransmitted = retransmissions.front().second;
+        retransmissions.pop_front();
+        if (random.Rand(0, 99) < loss_percent) {
+          retransmissions.emplace_back(i + kRetransmissionDelayPackets,
+                                       retransmitted);
+        } else {
+          nack_requester.OnReceivedPacket(retransmitted,
+                                          /*is_recovered=*/false);
+        }
+      }
+      if (i % 20 == 0)
+        nack_requester.ProcessNacks();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumPackets);
+  state.counters["nacks_per_iteration"] =
+      static_cast<double>(sender.num_nacked_packets) / state.iterations();
+  state.counters["keyframe_requests"] = sender.num_keyframe_requests;
+}
+
+// Loss rates in percent.
+BENCHMARK(BM_ReplayLossyStream)->Arg(1)->Arg(10)->Arg(30);
+
+}  // namespace
+}  // namespace webrtc
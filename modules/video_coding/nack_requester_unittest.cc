@@ -23,10 +23,14 @@
 #include "rtc_base/thread.h"
 #include "system_wrappers/include/clock.h"
 #include "test/create_test_field_trials.h"
+#include "test/gmock.h"
 #include "test/gtest.h"
 #include "test/run_loop.h"
 
 namespace webrtc {
+
+using ::testing::ElementsAre;
+
 // TODO(bugs.webrtc.org/11594): Use the use the GlobalSimulatedTimeController
 // instead of RunLoop. At the moment we mix use of the Clock and the underlying
 // implementation of RunLoop, which is realtime.
@@ -226,6 +230,56 @@ TEST_F(TestNackRequester, ClearUpToWrap) {
   EXPECT_EQ(0, sent_nacks_[0]);
 }
 
+TEST_F(TestNackRequester, DoesNotResendReceivedPackets) {
+  NackRequester& nack_module = CreateNackModule(TimeDelta::Millis(1));
+  nack_module.OnReceivedPacket(0);
+  nack_module.OnReceivedPacket(10);
+  EXPECT_EQ(9u, sent_nacks_.size());
+  // Packets received from the middle and the front of the nack list.
+  EXPECT_EQ(1, nack_module.OnReceivedPacket(5));
+  EXPECT_EQ(1, nack_module.OnReceivedPacket(1));
+  EXPECT_EQ(1, nack_module.OnReceivedPacket(2));
+
+  sent_nacks_.clear();
+  clock_->AdvanceTimeMilliseconds(kDefaultRttMs);
+  WaitForSendNack();
+  EXPECT_THAT(sent_nacks_, ElementsAre(3, 4, 6, 7, 8, 9));
+}
+
+TEST_F(TestNackRequester, ClearUpToWithReceivedPackets) {
+  NackRequester& nack_module = CreateNackModule(TimeDelta::Millis(1));
+  nack_module.OnReceivedPacket(0);
+  nack_module.OnReceivedPacket(10);
+  nack_module.OnReceivedPacket(8);
+  nack_module.ClearUpTo(7);
+  // Packets lost after clearing are nacked after the remaining ones.
+  nack_module.OnReceivedPacket(13);
+
+  sent_nacks_.clear();
+  clock_->AdvanceTimeMilliseconds(kDefaultRttMs);
+  WaitForSendNack();
+  EXPECT_THAT(sent_nacks_, ElementsAre(7, 9, 11, 12));
+}
+
+TEST_F(TestNackRequester, ResendsPacketsOneRttAfterTheirLastNack) {
+  NackRequester& nack_module = CreateNackModule(TimeDelta::Millis(1));
+  nack_module.OnReceivedPacket(0);
+  nack_module.OnReceivedPacket(3);
+  clock_->AdvanceTimeMilliseconds(kDefaultRttMs / 2);
+  nack_module.OnReceivedPacket(6);
+  EXPECT_THAT(sent_nacks_, ElementsAre(1, 2, 4, 5));
+
+  sent_nacks_.clear();
+  clock_->AdvanceTimeMilliseconds(kDefaultRttMs / 2);
+  WaitForSendNack();
+  EXPECT_THAT(sent_nacks_, ElementsAre(1, 2));
+
+  sent_nacks_.clear();
+  clock_->AdvanceTimeMilliseconds(kDefaultRttMs / 2);
+  WaitForSendNack();
+  EXPECT_THAT(sent_nacks_, ElementsAre(4, 5));
+}
+
 TEST_F(TestNackRequester, PacketNackCount) {
   NackRequester& nack_module = CreateNackModule(TimeDelta::Millis(1));
   EXPECT_EQ(0, nack_module.OnReceivedPacket(0));
@@ -0,0 +1,205 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "api/rtp_packet_infos.h"
+#include "api/video/encoded_image.h"
+#include "api/video/video_codec_type.h"
+#include "api/video/video_content_type.h"
+#include "api/video/video_frame_type.h"
+#include "api/video/video_rotation.h"
+#include "api/video/video_timing.h"
+#include "benchmark/benchmark.h"
+#include "modules/rtp_rtcp/source/frame_object.h"
+#include "modules/rtp_rtcp/source/rtp_video_header.h"
+#include "modules/video_coding/codecs/vp8/include/vp8_globals.h"
+#include "modules/video_coding/codecs/vp9/include/vp9_globals.h"
+#include "modules/video_coding/rtp_frame_reference_finder.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+// Number of frames replayed through a fresh reference finder per iteration.
+constexpr int kNumFrames = 3000;
+// Lost frames are recovered by retransmission and arrive this many frames
+// late.
+constexpr int kRetransmissionDelayFrames = 10;
+constexpr int kNumSpatialLayers = 3;
+// Temporal layer pattern of a VP8 stream with three temporal layers.
+constexpr int kVp8TemporalPattern[] = {0, 2, 1, 2};
+
+std::unique_ptr<RtpFrameObject> CreateFrame(
+    uint16_t seq_num,
+    VideoCodecType codec_type,
+    const RTPVideoHeader& video_header) {
+  // clang-format off
+  return std::make_unique<RtpFrameObject>(
+      seq_num,
+      seq_num,
+      /*markerBit=*/true,
+      /*times_nacked=*/0,
+      /*first_packet_received_time=*/0,
+      /*last_packet_received_time=*/0,
+      /*rtp_timestamp=*/0,
+      /*ntp_time_ms=*/0,
+      VideoSendTiming(),
+      /*payload_type=*/0,
+      codec_type,
+      kVideoRotation_0,
+      VideoContentType::UNSPECIFIED,
+      video_header,
+      /*color_space=*/std::nullopt,
+      /*frame_instrumentation_data=*/std::nullopt,
+      RtpPacketInfos(),
+      EncodedImageBuffer::Create(/*size=*/0));
+  // clang-format on
+}
+
+std::vector<RTPVideoHeader> CreateVp8Stream() {
+  std::vector<RTPVideoHeader> stream;
+  uint8_t tl0_pic_idx = 0;
+  for (int i = 0; i < kNumFrames; ++i) {
+    const int temporal_idx = kVp8TemporalPattern[i % 4];
+    if (i > 0 && temporal_idx == 0)
+      ++tl0_pic_idx;
+
+    RTPVideoHeaderVP8 vp8_header;
+    vp8_header.InitRTPVideoHeaderVP8();
+    vp8_header.pictureId = i & 0x7FFF;
+    vp8_header.tl0PicIdx = tl0_pic_idx;
+    vp8_header.temporalIdx = temporal_idx;
+    // The first frame of each upper temporal layer only references the base
+    // layer.
+    vp8_header.layerSync = i < 4 && temporal_idx > 0;
+
+    RTPVideoHeader video_header;
+    video_header.frame_type = i == 0 ? VideoFrameType::kVideoFrameKey
+                                     : VideoFrameType::kVideoFrameDelta;
+    video_header.video_type_header = vp8_header;
+    stream.push_back(video_header);
+  }
+  return stream;
+}
+
+// Non-flexible mode VP9 SVC stream, with a scalability structure sent on the
+// keyframe and on every base layer frame.
+std::vector<RTPVideoHeader> CreateVp9SvcStream() {
+  GofInfoVP9 gof;
+  gof.SetGofInfoVP9(kTemporalStructureMode3);
+
+  std::vector<RTPVideoHeader> stream;
+  uint8_t tl0_pic_idx = 0;
+  for (int picture_id = 0; stream.size() < size_t{kNumFrames}; ++picture_id) {
+    const int gof_idx = picture_id % gof.num_frames_in_gof;
+    const int temporal_idx = gof.temporal_idx[gof_idx];
+    if (picture_id > 0 && temporal_idx == 0)
+      ++tl0_pic_idx;
+
+    for (int spatial_idx = 0; spatial_idx < kNumSpatialLayers; ++spatial_idx) {
+      RTPVideoHeaderVP9 vp9_header;
+      vp9_header.InitRTPVideoHeaderVP9();
+      vp9_header.flexible_mode = false;
+      vp9_header.picture_id = picture_id & 0x7FFF;
+      vp9_header.tl0_pic_idx = tl0_pic_idx;
+      vp9_header.temporal_idx = temporal_idx;
+      vp9_header.spatial_idx = spatial_idx;
+      vp9_header.temporal_up_switch = gof.temporal_up_switch[gof_idx];
+      vp9_header.inter_layer_predicted = spatial_idx > 0;
+      vp9_header.inter_pic_predicted = picture_id > 0;
+      if (spatial_idx == 0 && temporal_idx == 0) {
+        vp9_header.ss_data_available = true;
+        vp9_header.gof = gof;
+      }
+
+      RTPVideoHeader video_header;
+      video_header.frame_type = picture_id == 0 && spatial_idx == 0
+                                    ? VideoFrameType::kVideoFrameKey
+                                    : VideoFrameType::kVideoFrameDelta;
+      video_header.video_type_header = vp9_header;
+      stream.push_back(video_header);
+    }
+  }
+  return stream;
+}
+
+// Returns the order in which the frames of the stream are received, given
+// that `loss_percent` percent of the frames are lost and later recovered by
+// retransmission.
+std::vector<int> CreateReceiveOrder(int loss_percent) {
+  Random random(/*seed=*/1234);
+  std::vector<int> order;
+  std::vector<std::pair<int, int>> retransmissions;
+  for (int i = 0; i < kNumFrames; ++i) {
+    for (auto it = retransmissions.begin(); it != retransmissions.end();) {
+      if (it->first <= i) {
+        order.push_back(it->second);
+        it = retransmissions.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    if (i > 0 && static_cast<int>(random.Rand(99)) < loss_percent) {
+      retransmissions.emplace_back(i + kRetransmissionDelayFrames, i);
+    } else {
+      order.push_back(i);
+    }
+  }
+  for (const auto& retransmission : retransmissions)
+    order.push_back(retransmission.second);
+  return order;
+}
+
+void ReplayStream(benchmark::State& state,
+                  VideoCodecType codec_type,
+                  const std::vector<RTPVideoHeader>& stream) {
+  const std::vector<int> order = CreateReceiveOrder(state.range(0));
+  std::vector<std::unique_ptr<RtpFrameObject>> frames(order.size());
+  size_t frames_out = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (size_t i = 0; i < order.size(); ++i) {
+      frames[i] = CreateFrame(order[i], codec_type, stream[order[i]]);
+    }
+    RtpFrameReferenceFinder reference_finder;
+    state.ResumeTiming();
+
+    for (std::unique_ptr<RtpFrameObject>& frame : frames) {
+      RtpFrameReferenceFinder::ReturnVector complete_frames =
+          reference_finder.ManageFrame(std::move(frame));
+      frames_out += complete_frames.size();
+      benchmark::DoNotOptimize(complete_frames);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * order.size());
+  state.counters["frames_out_per_iteration"] =
+      static_cast<double>(frames_out) / state.iterations();
+}
+
+void BM_ManageFrameVp8(benchmark::State& state) {
+  ReplayStream(state, kVideoCodecVP8, CreateVp8Stream());
+}
+
+void BM_ManageFrameVp9Svc(benchmark::State& state) {
+  ReplayStream(state, kVideoCodecVP9, CreateVp9SvcStream());
+}
+
+// Loss rates of 0%, 5%, 20% and 40%.
+BENCHMARK(BM_ManageFrameVp8)->Arg(0)->Arg(5)->Arg(20)->Arg(40);
+BENCHMARK(BM_ManageFrameVp9Svc)->Arg(0)->Arg(5)->Arg(20)->Arg(40);
+
+}  // namespace
+}  // namespace webrtc
@@ -199,8 +199,10 @@ void RtpVp8RefFinder::UpdateLayerInfoVp8(RtpFrameObject* frame,
                                          uint8_t temporal_idx) {
   auto layer_info_it = layer_info_.find(unwrapped_tl0);
 
-  // Update this layer info and newer.
-  while (layer_info_it != layer_info_.end()) {
+  // Update this layer info and newer. `layer_info_` is sorted, so the info
+  // for the following Tl0 picture index, if any, is the next element.
+  while (layer_info_it != layer_info_.end() &&
+         layer_info_it->first == unwrapped_tl0) {
     if (layer_info_it->second[temporal_idx] != -1 &&
         AheadOf<uint16_t, kFrameIdLength>(layer_info_it->second[temporal_idx],
                                           frame->Id())) {
@@ -211,7 +213,7 @@ void RtpVp8RefFinder::UpdateLayerInfoVp8(RtpFrameObject* frame,
 
     layer_info_it->second[temporal_idx] = frame->Id();
     ++unwrapped_tl0;
-    layer_info_it = layer_info_.find(unwrapped_tl0);
+    ++layer_info_it;
   }
   not_yet_received_frames_.erase(frame->Id());
 
@@ -223,7 +225,12 @@ void RtpVp8RefFinder::RetryStashedFrames(
   bool complete_frame = false;
   do {
     complete_frame = false;
-    for (auto it = stashed_frames_.begin(); it != stashed_frames_.end();) {
+    // Frames that are still stashed are compacted towards the front in a
+    // single pass, rather than erasing handed off and dropped frames one by
+    // one from the middle of the deque.
+    auto keep_it = stashed_frames_.begin();
+    for (auto it = stashed_frames_.begin(); it != stashed_frames_.end();
+         ++it) {
       const RTPVideoHeaderVP8& codec_header = std::get<RTPVideoHeaderVP8>(
           it->frame->GetRtpVideoHeader().video_type_header);
       FrameDecision decision =
@@ -231,16 +238,19 @@ void RtpVp8RefFinder::RetryStashedFrames(
 
       switch (decision) {
         case kStash:
-          ++it;
+          if (keep_it != it)
+            *keep_it = std::move(*it);
+          ++keep_it;
           break;
         case kHandOff:
           complete_frame = true;
           res.push_back(std::move(it->frame));
-          [[fallthrough]];
+          break;
         case kDrop:
-          it = stashed_frames_.erase(it);
+          break;
       }
     }
+    stashed_frames_.erase(keep_it, stashed_frames_.end());
   } while (complete_frame);
 }
 
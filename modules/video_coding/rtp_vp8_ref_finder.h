@@ -14,13 +14,13 @@
 #include <array>
 #include <cstdint>
 #include <deque>
-#include <map>
 #include <memory>
-#include <set>
 
 #include "modules/rtp_rtcp/source/frame_object.h"
 #include "modules/video_coding/codecs/vp8/include/vp8_globals.h"
 #include "modules/video_coding/rtp_frame_reference_finder.h"
+#include "rtc_base/containers/flat_map.h"
+#include "rtc_base/containers/flat_set.h"
 #include "rtc_base/numerics/sequence_number_unwrapper.h"
 #include "rtc_base/numerics/sequence_number_util.h"
 
@@ -62,8 +62,10 @@ class RtpVp8RefFinder {
   int last_picture_id_ = -1;
 
   // Frames earlier than the last received frame that have not yet been
-  // fully received.
-  std::set<uint16_t, DescendingSeqNumComp<uint16_t, kFrameIdLength>>
+  // fully received. At most `kMaxNotYetReceivedFrames` picture ids are kept,
+  // so a sorted vector is cheaper than a node based set here and doesn't
+  // allocate once it has reached its steady state size.
+  flat_set<uint16_t, DescendingSeqNumComp<uint16_t, kFrameIdLength>>
       not_yet_received_frames_;
 
   // Frames that have been fully received but didn't have all the information
@@ -71,8 +73,9 @@ class RtpVp8RefFinder {
   std::deque<UnwrappedTl0Frame> stashed_frames_;
 
   // Holds the information about the last completed frame for a given temporal
-  // layer given an unwrapped Tl0 picture index.
-  std::map<int64_t, std::array<int64_t, kMaxTemporalLayers>> layer_info_;
+  // layer given an unwrapped Tl0 picture index. Bounded to the last
+  // `kMaxLayerInfo` Tl0 picture indices.
+  flat_map<int64_t, std::array<int64_t, kMaxTemporalLayers>> layer_info_;
 
   // Unwrapper used to unwrap VP8/VP9 streams which have their picture id
   // specified.
@@ -103,6 +103,7 @@ RtpVp9RefFinder::FrameDecision RtpVp9RefFinder::ManageFrameGof(
     const RTPVideoHeaderVP9& codec_header,
     int64_t unwrapped_tl0) {
   GofInfo* info;
+  int64_t info_tl0;
   if (codec_header.ss_data_available) {
     if (codec_header.temporal_idx != 0) {
       RTC_LOG(LS_WARNING) << "Received scalability structure on a non base "
@@ -137,6 +138,7 @@ RtpVp9RefFinder::FrameDecision RtpVp9RefFinder::ManageFrameGof(
     if (gof_info_it == gof_info_.end())
       return kStash;
 
+    info_tl0 = gof_info_it->first;
     info = &gof_info_it->second;
 
     if (frame->frame_type() == VideoFrameType::kVideoFrameKey) {
@@ -171,13 +173,18 @@ RtpVp9RefFinder::FrameDecision RtpVp9RefFinder::ManageFrameGof(
                         .first;
     }
 
+    info_tl0 = gof_info_it->first;
     info = &gof_info_it->second;
   }
 
-  // Clean up info for base layers that are too old.
+  // Clean up info for base layers that are too old. Erasing from `gof_info_`
+  // moves the remaining elements, so `info` has to be looked up again.
   int64_t old_tl0_pic_idx = unwrapped_tl0 - kMaxGofSaved;
   auto clean_gof_info_to = gof_info_.lower_bound(old_tl0_pic_idx);
-  gof_info_.erase(gof_info_.begin(), clean_gof_info_to);
+  if (clean_gof_info_to != gof_info_.begin()) {
+    gof_info_.erase(gof_info_.begin(), clean_gof_info_to);
+    info = &gof_info_.find(info_tl0)->second;
+  }
 
   FrameReceivedVp9(frame->Id(), info);
 
@@ -323,7 +330,9 @@ void RtpVp9RefFinder::RetryStashedFrames(
   bool complete_frame = false;
   do {
     complete_frame = false;
-    for (auto it = stashed_frames_.begin(); it != stashed_frames_.end();) {
+    auto keep_it = stashed_frames_.begin();
+    for (auto it = stashed_frames_.begin(); it != stashed_frames_.end();
+         ++it) {
       const RTPVideoHeaderVP9& codec_header = std::get<RTPVideoHeaderVP9>(
           it->frame->GetRtpVideoHeader().video_type_header);
       RTC_DCHECK(!codec_header.flexible_mode);
@@ -332,16 +341,19 @@ void RtpVp9RefFinder::RetryStashedFrames(
 
       switch (decision) {
         case kStash:
-          ++it;
+          if (keep_it != it)
+            *keep_it = std::move(*it);
+          ++keep_it;
           break;
         case kHandOff:
           complete_frame = true;
           res.push_back(std::move(it->frame));
-          [[fallthrough]];
+          break;
         case kDrop:
-          it = stashed_frames_.erase(it);
+          break;
       }
     }
+    stashed_frames_.erase(keep_it, stashed_frames_.end());
   } while (complete_frame);
 }
 
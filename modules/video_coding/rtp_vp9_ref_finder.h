@@ -14,13 +14,13 @@
 #include <array>
 #include <cstdint>
 #include <deque>
-#include <map>
 #include <memory>
-#include <set>
 
 #include "modules/rtp_rtcp/source/frame_object.h"
 #include "modules/video_coding/codecs/vp9/include/vp9_globals.h"
 #include "modules/video_coding/rtp_frame_reference_finder.h"
+#include "rtc_base/containers/flat_map.h"
+#include "rtc_base/containers/flat_set.h"
 #include "rtc_base/numerics/sequence_number_unwrapper.h"
 #include "rtc_base/numerics/sequence_number_util.h"
 
@@ -84,15 +84,18 @@ class RtpVp9RefFinder {
   std::array<GofInfoVP9, kMaxGofSaved> scalability_structures_;
 
   // Holds the the Gof information for a given unwrapped TL0 picture index.
-  std::map<int64_t, GofInfo> gof_info_;
+  // Bounded to the last `kMaxGofSaved` TL0 picture indices. Like the other
+  // containers below it is a sorted vector, so inserting or erasing elements
+  // invalidates pointers into it.
+  flat_map<int64_t, GofInfo> gof_info_;
 
   // Keep track of which picture id and which temporal layer that had the
   // up switch flag set.
-  std::map<uint16_t, uint8_t, DescendingSeqNumComp<uint16_t, kFrameIdLength>>
+  flat_map<uint16_t, uint8_t, DescendingSeqNumComp<uint16_t, kFrameIdLength>>
       up_switch_;
 
   // For every temporal layer, keep a set of which frames that are missing.
-  std::array<std::set<uint16_t, DescendingSeqNumComp<uint16_t, kFrameIdLength>>,
+  std::array<flat_set<uint16_t, DescendingSeqNumComp<uint16_t, kFrameIdLength>>,
              kMaxTemporalLayers>
       missing_frames_for_layer_;
 
@@ -10,12 +10,16 @@
 #ifndef NET_DCSCTP_PACKET_DATA_H_
 #define NET_DCSCTP_PACKET_DATA_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <initializer_list>
+#include <memory>
 #include <utility>
 #include <vector>
 
 #include "net/dcsctp/common/internal_types.h"
 #include "net/dcsctp/public/types.h"
+#include "rtc_base/checks.h"
 
 namespace dcsctp {
 
@@ -40,12 +44,70 @@ struct Data {
   // "end" flag in DATA/I-DATA chunk.
   using IsEnd = webrtc::StrongAlias<class IsEndTag, bool>;
 
+  // The payload of a chunk, which either owns its bytes, as for received
+  // chunks, or is a view of a buffer shared with other chunks, as for the
+  // fragments of a message that is sent. Copying a shared payload, e.g. when
+  // retaining a sent chunk for retransmission, doesn't copy its bytes.
+  class Payload {
+   public:
+    using value_type = uint8_t;
+    using const_iterator = const uint8_t*;
+    using iterator = const_iterator;
+
+    Payload() = default;
+    Payload(std::vector<uint8_t> bytes)  // NOLINT(runtime/explicit)
+        : owned_(std::move(bytes)) {}
+    Payload(std::initializer_list<uint8_t> bytes)  // NOLINT(runtime/explicit)
+        : owned_(bytes) {}
+
+    const uint8_t* data() const {
+      return shared_ != nullptr ? shared_->data() + offset_ : owned_.data();
+    }
+    size_t size() const { return shared_ != nullptr ? size_ : owned_.size(); }
+    bool empty() const { return size() == 0; }
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size(); }
+
+    // Returns a view of `size` bytes from `offset`, sharing the buffer of this
+    // payload. Payloads owning their bytes have them moved to a shared buffer
+    // on the first call, which doesn't copy them.
+    Payload Slice(size_t offset, size_t size) {
+      if (shared_ == nullptr) {
+        size_ = owned_.size();
+        shared_ =
+            std::make_shared<const std::vector<uint8_t>>(std::move(owned_));
+        owned_.clear();
+      }
+      RTC_DCHECK_LE(offset + size, size_);
+      Payload slice;
+      slice.shared_ = shared_;
+      slice.offset_ = offset_ + offset;
+      slice.size_ = size;
+      return slice;
+    }
+
+    // When destructing the payload, extracts its bytes. Only shared payloads
+    // are copied.
+    std::vector<uint8_t> Release() && {
+      if (shared_ != nullptr) {
+        return std::vector<uint8_t>(begin(), end());
+      }
+      return std::move(owned_);
+    }
+
+   private:
+    std::vector<uint8_t> owned_;
+    std::shared_ptr<const std::vector<uint8_t>> shared_;
+    size_t offset_ = 0;
+    size_t size_ = 0;
+  };
+
   Data(StreamID stream_id,
        SSN ssn,
        MID mid,
        FSN fsn,
        PPID ppid,
-       std::vector<uint8_t> payload,
+       Payload payload,
        IsBeginning is_beginning,
        IsEnd is_end,
        IsUnordered is_unordered)
@@ -63,7 +125,7 @@ struct Data {
   Data(Data&& other) = default;
   Data& operator=(Data&& other) = default;
 
-  // Creates a copy of this `Data` object.
+  // Creates a copy of this `Data` object, sharing the payload if it is shared.
   Data Clone() const {
     return Data(stream_id, ssn, mid, fsn, ppid, payload, is_beginning, is_end,
                 is_unordered);
@@ -90,7 +152,7 @@ struct Data {
   PPID ppid;
 
   // The actual data payload.
-  std::vector<uint8_t> payload;
+  Payload payload;
 
   // If this data represents the first, last or a middle chunk.
   IsBeginning is_beginning;
@@ -211,6 +211,13 @@ struct DcSctpOptions {
   // RFC3758 Partial Reliability Extension
   bool enable_partial_reliability = true;
 
+  // Enables time-based loss detection, inspired by RACK (RFC 8985), in
+  // addition to counting miss indications (RFC 9260, section 7.2.4). A DATA
+  // chunk reported missing in a SACK will be considered lost when a chunk that
+  // was sent more than a quarter of the minimum RTT later has been acked, which
+  // reacts faster to packet loss when a large amount of data is in flight.
+  bool enable_rack_loss_detection = false;
+
   // RFC8260 Stream Schedulers and User Message Interleaving
   bool enable_message_interleaving = false;
 
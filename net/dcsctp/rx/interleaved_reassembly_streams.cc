@@ -28,6 +28,7 @@
 #include "net/dcsctp/public/dcsctp_message.h"
 #include "net/dcsctp/public/types.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/containers/flat_map.h"
 #include "rtc_base/logging.h"
 
 namespace dcsctp {
@@ -39,7 +40,7 @@ InterleavedReassemblyStreams::InterleavedReassemblyStreams(
 
 size_t InterleavedReassemblyStreams::Stream::TryToAssembleMessage(
     UnwrappedMID mid) {
-  std::map<UnwrappedMID, ChunkMap>::iterator it = chunks_by_mid_.find(mid);
+  auto it = chunks_by_mid_.find(mid);
   if (it == chunks_by_mid_.end()) {
     RTC_DLOG(LS_VERBOSE) << parent_.log_prefix_ << "TryToAssembleMessage "
                          << *mid.Wrap() << " - no chunks";
@@ -66,7 +67,7 @@ size_t InterleavedReassemblyStreams::Stream::TryToAssembleMessage(
                        << *mid.Wrap() << " - succeeded and removed "
                        << removed_bytes;
 
-  chunks_by_mid_.erase(mid);
+  chunks_by_mid_.erase(it);
   return removed_bytes;
 }
 
@@ -74,7 +75,8 @@ size_t InterleavedReassemblyStreams::Stream::AssembleMessage(UnwrappedTSN tsn,
                                                              Data data) {
   size_t payload_size = data.size();
   UnwrappedTSN tsns[1] = {tsn};
-  DcSctpMessage message(data.stream_id, data.ppid, std::move(data.payload));
+  DcSctpMessage message(data.stream_id, data.ppid,
+                        std::move(data.payload).Release());
   parent_.on_assembled_message_(tsns, std::move(message));
   return payload_size;
 }
@@ -116,13 +118,13 @@ size_t InterleavedReassemblyStreams::Stream::EraseTo(MID mid) {
   UnwrappedMID unwrapped_mid = mid_unwrapper_.Unwrap(mid);
 
   size_t removed_bytes = 0;
-  auto it = chunks_by_mid_.begin();
-  while (it != chunks_by_mid_.end() && it->first <= unwrapped_mid) {
+  auto end_iter = chunks_by_mid_.upper_bound(unwrapped_mid);
+  for (auto it = chunks_by_mid_.begin(); it != end_iter; ++it) {
     removed_bytes += absl::c_accumulate(
         it->second, 0,
         [](size_t r2, const auto& q) { return r2 + q.second.second.size(); });
-    it = chunks_by_mid_.erase(it);
   }
+  chunks_by_mid_.erase(chunks_by_mid_.begin(), end_iter);
 
   if (!stream_id_.unordered) {
     // For ordered streams, erasing a message might suddenly unblock that queue
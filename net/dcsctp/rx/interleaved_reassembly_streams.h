@@ -21,6 +21,7 @@
 #include "net/dcsctp/packet/chunk/forward_tsn_common.h"
 #include "net/dcsctp/packet/data.h"
 #include "net/dcsctp/rx/reassembly_streams.h"
+#include "rtc_base/containers/flat_map.h"
 
 namespace dcsctp {
 
@@ -76,7 +77,10 @@ class InterleavedReassemblyStreams : public ReassemblyStreams {
     void AddHandoverState(DcSctpSocketHandoverState& state) const;
 
    private:
-    using ChunkMap = std::map<FSN, std::pair<UnwrappedTSN, Data>>;
+    // Fragments are mostly received in order, which makes a sorted vector
+    // cheaper than a tree, as they are appended and all removed at once when
+    // the message is assembled.
+    using ChunkMap = webrtc::flat_map<FSN, std::pair<UnwrappedTSN, Data>>;
 
     // Try to assemble one message identified by `mid`.
     // Returns the number of bytes assembled if a message was assembled.
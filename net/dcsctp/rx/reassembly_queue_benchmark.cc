@@ -0,0 +1,140 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "net/dcsctp/common/internal_types.h"
+#include "net/dcsctp/packet/data.h"
+#include "net/dcsctp/public/types.h"
+#include "net/dcsctp/rx/reassembly_queue.h"
+
+namespace dcsctp {
+namespace {
+
+// Bulk transfer of 4 MB, sent in chunks that fit in a typical packet.
+constexpr size_t kTransferSize = 4 * 1024 * 1024;
+constexpr size_t kChunkSize = 1180;
+// Every `kLossInterval`:th chunk is lost and its retransmission arrives
+// `kRetransmissionDelay` chunks later.
+constexpr int kLossInterval = 100;
+constexpr int kRetransmissionDelay = 64;
+
+// Returns the chunks of the transfer, split into messages of `message_size`
+// bytes, in the order they are received.
+std::vector<std::pair<TSN, Data>> CreateReceivedChunks(size_t message_size,
+                                                       bool is_unordered) {
+  std::vector<std::pair<TSN, Data>> chunks;
+  std::vector<std::pair<TSN, Data>> lost_chunks;
+  uint32_t tsn = 10;
+  uint16_t ssn = 0;
+  uint32_t mid = 0;
+  for (size_t offset = 0; offset < kTransferSize; offset += message_size) {
+    uint32_t fsn = 0;
+    for (size_t message_offset = 0; message_offset < message_size;
+         message_offset += kChunkSize) {
+      size_t chunk_size = std::min(kChunkSize, message_size - message_offset);
+      Data data(StreamID(1), SSN(ssn), MID(mid), FSN(fsn++), PPID(53),
+                std::vector<uint8_t>(chunk_size),
+                Data::IsBeginning(message_offset == 0),
+                Data::IsEnd(message_offset + chunk_size == message_size),
+                IsUnordered(is_unordered));
+      if (tsn % kLossInterval == 0) {
+        lost_chunks.emplace_back(TSN(tsn), std::move(data));
+      } else {
+        chunks.emplace_back(TSN(tsn), std::move(data));
+      }
+      if (tsn % kLossInterval == kRetransmissionDelay && !lost_chunks.empty()) {
+        chunks.push_back(std::move(lost_chunks.front()));
+        lost_chunks.erase(lost_chunks.begin());
+      }
+      ++tsn;
+    }
+    ++ssn;
+    ++mid;
+  }
+  for (auto& lost_chunk : lost_chunks) {
+    chunks.push_back(std::move(lost_chunk));
+  }
+  return chunks;
+}
+
+// Receives the transfer in messages of `state.range(0)` bytes, which are
+// unordered if `state.range(1)` is 1, and sent with message interleaving
+// (I-DATA) if `state.range(2)` is 1. The payload is copied into each chunk, as
+// done when parsing received packets.
+void BM_ReceiveTransfer(benchmark::State& state) {
+  const size_t message_size = state.range(0);
+  const bool is_unordered = state.range(1) != 0;
+  const bool use_message_interleaving = state.range(2) != 0;
+  const std::vector<std::pair<TSN, Data>> chunks =
+      CreateReceivedChunks(message_size, is_unordered);
+  size_t num_messages = 0;
+  for (auto _ : state) {
+    ReassemblyQueue queue("", /*max_size_bytes=*/2 * kTransferSize,
+                          use_message_interleaving);
+    for (const auto& [tsn, data] : chunks) {
+      queue.Add(tsn, data.Clone());
+      while (queue.HasMessages()) {
+        benchmark::DoNotOptimize(queue.GetNextMessage());
+        ++num_messages;
+      }
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kTransferSize);
+  state.SetItemsProcessed(num_messages);
+}
+
+// Message size in bytes, 1 for unordered messages and 1 for I-DATA.
+BENCHMARK(BM_ReceiveTransfer)
+    ->ArgsProduct({{1024, 16 * 1024, 256 * 1024}, {0, 1}, {0, 1}});
+
+// Receives `state.range(0)` messages of two chunks each, which are unordered
+// if `state.range(1)` is 1, where the first chunk of every message is lost and
+// retransmitted once all second chunks have been received.
+void BM_ReceiveAfterBurstLoss(benchmark::State& state) {
+  const int num_messages = state.range(0);
+  const bool is_unordered = state.range(1) != 0;
+  std::vector<std::pair<TSN, Data>> chunks;
+  for (int i = 0; i < 2 * num_messages; ++i) {
+    // Second chunks are received first.
+    int message = i % num_messages;
+    bool is_beginning = i >= num_messages;
+    uint32_t tsn = 10 + 2 * message + (is_beginning ? 0 : 1);
+    chunks.emplace_back(
+        TSN(tsn),
+        Data(StreamID(1), SSN(message), MID(0), FSN(0), PPID(53),
+             std::vector<uint8_t>(kChunkSize), Data::IsBeginning(is_beginning),
+             Data::IsEnd(!is_beginning), IsUnordered(is_unordered)));
+  }
+  for (auto _ : state) {
+    ReassemblyQueue queue("", /*max_size_bytes=*/4 * num_messages * kChunkSize,
+                          /*use_message_interleaving=*/false);
+    for (const auto& [tsn, data] : chunks) {
+      queue.Add(tsn, data.Clone());
+    }
+    while (queue.HasMessages()) {
+      benchmark::DoNotOptimize(queue.GetNextMessage());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_messages);
+}
+
+// Number of messages, and 1 for unordered messages.
+BENCHMARK(BM_ReceiveAfterBurstLoss)
+    ->ArgsProduct({{1000, 10000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace dcsctp
@@ -30,6 +30,7 @@
 #include "net/dcsctp/public/dcsctp_message.h"
 #include "net/dcsctp/public/types.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/containers/flat_map.h"
 #include "rtc_base/logging.h"
 
 namespace dcsctp {
@@ -107,17 +108,21 @@ int TraditionalReassemblyStreams::UnorderedStream::Add(UnwrappedTSN tsn,
 }
 
 size_t TraditionalReassemblyStreams::UnorderedStream::TryToAssembleMessage(
-    ChunkMap::iterator iter) {
+    UnorderedChunkMap::iterator iter) {
   // TODO(boivie): This method is O(N) with the number of fragments in a
   // message, which can be inefficient for very large values of N. This could be
   // optimized by e.g. only trying to assemble a message once _any_ beginning
   // and _any_ end has been found.
-  std::optional<ChunkMap::iterator> start = FindBeginning(chunks_, iter);
-  if (!start.has_value()) {
+  //
+  // The end is looked for first, as it is usually not received yet, which
+  // makes this O(1) for fragments that are received in order.
+  std::optional<UnorderedChunkMap::iterator> end = FindEnd(chunks_, iter);
+  if (!end.has_value()) {
     return 0;
   }
-  std::optional<ChunkMap::iterator> end = FindEnd(chunks_, iter);
-  if (!end.has_value()) {
+  std::optional<UnorderedChunkMap::iterator> start =
+      FindBeginning(chunks_, iter);
+  if (!start.has_value()) {
     return 0;
   }
 
@@ -126,9 +131,10 @@ size_t TraditionalReassemblyStreams::UnorderedStream::TryToAssembleMessage(
   return bytes_assembled;
 }
 
+template <typename Iterator>
 size_t TraditionalReassemblyStreams::StreamBase::AssembleMessage(
-    const ChunkMap::iterator start,
-    const ChunkMap::iterator end) {
+    const Iterator start,
+    const Iterator end) {
   size_t count = std::distance(start, end);
 
   if (count == 1) {
@@ -165,7 +171,8 @@ size_t TraditionalReassemblyStreams::StreamBase::AssembleMessage(
   // Fast path - zero-copy
   size_t payload_size = data.size();
   UnwrappedTSN tsns[1] = {tsn};
-  DcSctpMessage message(data.stream_id, data.ppid, std::move(data.payload));
+  DcSctpMessage message(data.stream_id, data.ppid,
+                        std::move(data.payload).Release());
   parent_.on_assembled_message_(tsns, std::move(message));
   return payload_size;
 }
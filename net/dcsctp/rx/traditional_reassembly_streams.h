@@ -21,6 +21,7 @@
 #include "net/dcsctp/packet/chunk/forward_tsn_common.h"
 #include "net/dcsctp/packet/data.h"
 #include "net/dcsctp/rx/reassembly_streams.h"
+#include "rtc_base/containers/flat_map.h"
 
 namespace dcsctp {
 
@@ -46,7 +47,13 @@ class TraditionalReassemblyStreams : public ReassemblyStreams {
   void RestoreFromState(const DcSctpSocketHandoverState& state) override;
 
  private:
-  using ChunkMap = std::map<UnwrappedTSN, Data>;
+  // The chunks of one message are mostly received in order, which makes a
+  // sorted vector cheaper than a tree, as they are appended and all removed
+  // at once when the message is assembled.
+  using ChunkMap = webrtc::flat_map<UnwrappedTSN, Data>;
+  // Chunks of several messages, which are removed from anywhere in the map as
+  // messages are assembled.
+  using UnorderedChunkMap = std::map<UnwrappedTSN, Data>;
 
   // Base class for `UnorderedStream` and `OrderedStream`.
   class StreamBase {
@@ -54,7 +61,8 @@ class TraditionalReassemblyStreams : public ReassemblyStreams {
     explicit StreamBase(TraditionalReassemblyStreams* parent)
         : parent_(*parent) {}
 
-    size_t AssembleMessage(ChunkMap::iterator start, ChunkMap::iterator end);
+    template <typename Iterator>
+    size_t AssembleMessage(Iterator start, Iterator end);
     size_t AssembleMessage(UnwrappedTSN tsn, Data data);
     TraditionalReassemblyStreams& parent_;
   };
@@ -76,9 +84,9 @@ class TraditionalReassemblyStreams : public ReassemblyStreams {
     // those chunks from the stream chunks map.
     //
     // Returns the number of bytes that were assembled.
-    size_t TryToAssembleMessage(ChunkMap::iterator iter);
+    size_t TryToAssembleMessage(UnorderedChunkMap::iterator iter);
 
-    ChunkMap chunks_;
+    UnorderedChunkMap chunks_;
   };
 
   // Manages all received data for a specific ordered stream, and assembles
@@ -0,0 +1,312 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+#include "api/scoped_refptr.h"
+#include "api/task_queue/pending_task_safety_flag.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "net/dcsctp/public/dcsctp_message.h"
+#include "net/dcsctp/public/dcsctp_options.h"
+#include "net/dcsctp/public/dcsctp_socket.h"
+#include "net/dcsctp/public/timeout.h"
+#include "net/dcsctp/public/types.h"
+#include "net/dcsctp/socket/dcsctp_socket.h"
+#include "net/dcsctp/timer/task_queue_timeout.h"
+#include "rtc_base/random.h"
+#include "system_wrappers/include/clock.h"
+#include "test/time_controller/simulated_time_controller.h"
+
+namespace dcsctp {
+namespace {
+using ::webrtc::DataRate;
+using ::webrtc::DataSize;
+using ::webrtc::TimeDelta;
+using ::webrtc::Timestamp;
+
+constexpr StreamID kStreamId(1);
+constexpr PPID kPpid(53);
+// Amount of data transferred per benchmark iteration.
+constexpr size_t kTransferSize = 4 * 1024 * 1024;
+// The sender tops up the send buffer to `kMaxBufferedAmount` when it drops
+// below `kBufferedAmountLowThreshold`, like a data channel application would.
+constexpr size_t kBufferedAmountLowThreshold = 128 * 1024;
+constexpr size_t kMaxBufferedAmount = 256 * 1024;
+// Bails out of transfers that stall, e.g. if the association is aborted.
+constexpr TimeDelta kMaxTransferDuration = TimeDelta::Seconds(600);
+
+struct LinkConfig {
+  TimeDelta rtt;
+  DataRate bandwidth;
+  double loss_probability;
+  // Probability that a packet is delayed by `reordering_delay` more than other
+  // packets, and thereby received after packets that were sent after it.
+  double reordering_probability;
+  TimeDelta reordering_delay;
+};
+
+const LinkConfig kLinkConfigs[] = {
+    // Local network.
+    {TimeDelta::Millis(1), DataRate::KilobitsPerSec(1'000'000), 0, 0,
+     TimeDelta::Zero()},
+    // Typical internet path.
+    {TimeDelta::Millis(50), DataRate::KilobitsPerSec(50'000), 0.01, 0,
+     TimeDelta::Zero()},
+    // Lossy mobile network, with packets being reordered.
+    {TimeDelta::Millis(100), DataRate::KilobitsPerSec(10'000), 0.05, 0.05,
+     TimeDelta::Millis(20)},
+};
+
+// One direction of a link, which delivers packets to `receiver` after the
+// time it takes to serialize them at the link bandwidth, plus half the RTT.
+// Packets are queued without limit while the link is busy.
+class SimulatedLink {
+ public:
+  SimulatedLink(webrtc::TaskQueueBase* task_queue,
+                webrtc::Clock* clock,
+                const LinkConfig& config,
+                uint64_t seed)
+      : task_queue_(task_queue),
+        clock_(clock),
+        config_(config),
+        random_(seed) {}
+
+  void SetReceiver(
+      DcSctpSocketInterface* receiver,
+      webrtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> safety_flag) {
+    receiver_ = receiver;
+    safety_flag_ = std::move(safety_flag);
+  }
+
+  void SendPacket(webrtc::ArrayView<const uint8_t> data) {
+    if (random_.Rand<double>() < config_.loss_probability) {
+      return;
+    }
+    Timestamp now = clock_->CurrentTime();
+    link_busy_until_ = std::max(link_busy_until_, now) +
+                       DataSize::Bytes(data.size()) / config_.bandwidth;
+    TimeDelta delay = link_busy_until_ - now + config_.rtt / 2;
+    if (random_.Rand<double>() < config_.reordering_probability) {
+      delay += config_.reordering_delay;
+    }
+    task_queue_->PostDelayedHighPrecisionTask(
+        webrtc::SafeTask(safety_flag_,
+                         [receiver = receiver_,
+                          packet = std::vector<uint8_t>(data.begin(),
+                                                        data.end())] {
+                           receiver->ReceivePacket(packet);
+                         }),
+        delay);
+  }
+
+ private:
+  webrtc::TaskQueueBase* const task_queue_;
+  webrtc::Clock* const clock_;
+  const LinkConfig config_;
+  webrtc::Random random_;
+  DcSctpSocketInterface* receiver_ = nullptr;
+  webrtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> safety_flag_;
+  Timestamp link_busy_until_ = Timestamp::MinusInfinity();
+};
+
+// A socket, and its link to the peer.
+class Endpoint : public DcSctpSocketCallbacks {
+ public:
+  Endpoint(absl::string_view name,
+           webrtc::TaskQueueBase* task_queue,
+           webrtc::Clock* clock,
+           const LinkConfig& link_config,
+           const DcSctpOptions& options,
+           uint64_t seed)
+      : clock_(clock),
+        link_(task_queue, clock, link_config, seed),
+        random_(seed),
+        timeout_factory_(
+            *task_queue,
+            [clock] { return TimeMs(clock->TimeInMilliseconds()); },
+            [this](TimeoutID timeout_id) {
+              socket_.HandleTimeout(timeout_id);
+            }),
+        socket_(name, *this, nullptr, options) {}
+
+  void ConnectTo(Endpoint& peer) {
+    link_.SetReceiver(&peer.socket_, peer.safety_.flag());
+  }
+
+  DcSctpSocket& socket() { return socket_; }
+
+  std::function<void(DcSctpMessage)> on_message_received =
+      [](DcSctpMessage /* message */) {};
+  std::function<void()> on_buffered_amount_low = [] {};
+
+  // Implementation of `DcSctpSocketCallbacks`.
+  SendPacketStatus SendPacketWithStatus(
+      webrtc::ArrayView<const uint8_t> data) override {
+    link_.SendPacket(data);
+    return SendPacketStatus::kSuccess;
+  }
+  std::unique_ptr<Timeout> CreateTimeout(
+      webrtc::TaskQueueBase::DelayPrecision precision) override {
+    return timeout_factory_.CreateTimeout(precision);
+  }
+  Timestamp Now() override { return clock_->CurrentTime(); }
+  uint32_t GetRandomInt(uint32_t low, uint32_t high) override {
+    return random_.Rand(low, high);
+  }
+  void OnMessageReceived(DcSctpMessage message) override {
+    on_message_received(std::move(message));
+  }
+  void OnBufferedAmountLow(StreamID /* stream_id */) override {
+    on_buffered_amount_low();
+  }
+  void OnError(ErrorKind /* error */,
+               absl::string_view /* message */) override {}
+  void OnAborted(ErrorKind /* error */,
+                 absl::string_view /* message */) override {}
+  void OnConnected() override {}
+  void OnClosed() override {}
+  void OnConnectionRestarted() override {}
+  void OnStreamsResetFailed(
+      webrtc::ArrayView<const StreamID> /* outgoing_streams */,
+      absl::string_view /* reason */) override {}
+  void OnStreamsResetPerformed(
+      webrtc::ArrayView<const StreamID> /* outgoing_streams */) override {}
+  void OnIncomingStreamsReset(
+      webrtc::ArrayView<const StreamID> /* incoming_streams */) override {}
+
+ private:
+  webrtc::Clock* const clock_;
+  SimulatedLink link_;
+  webrtc::Random random_;
+  TaskQueueTimeoutFactory timeout_factory_;
+  DcSctpSocket socket_;
+  webrtc::ScopedTaskSafety safety_;
+};
+
+double Percentile(std::vector<TimeDelta>& values, double percentile) {
+  size_t index = static_cast<size_t>(percentile * (values.size() - 1));
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index].ms<double>();
+}
+
+// Transfers `kTransferSize` bytes per iteration in messages of `state.range(0)`
+// bytes, which are unordered if `state.range(1)` is 1, and sent with message
+// interleaving (I-DATA) if `state.range(2)` is 1, over the link given by
+// `kLinkConfigs[state.range(3)]` in simulated time.
+void BM_Transfer(benchmark::State& state) {
+  const size_t message_size = state.range(0);
+  const size_t num_messages = (kTransferSize + message_size - 1) / message_size;
+  SendOptions send_options;
+  send_options.unordered = IsUnordered(state.range(1) != 0);
+  DcSctpOptions options;
+  options.mtu = 1200;
+  options.enable_message_interleaving = state.range(2) != 0;
+  // No timers should be running when the transfer is done.
+  options.heartbeat_interval = DurationMs(0);
+  const LinkConfig& link_config = kLinkConfigs[state.range(3)];
+
+  TimeDelta total_duration = TimeDelta::Zero();
+  size_t total_received_messages = 0;
+  std::vector<TimeDelta> latencies;
+  uint64_t seed = 1;
+  for (auto _ : state) {
+    webrtc::GlobalSimulatedTimeController time_controller(
+        Timestamp::Seconds(1000));
+    webrtc::Clock* clock = time_controller.GetClock();
+    webrtc::TaskQueueBase* task_queue = time_controller.GetMainThread();
+    Endpoint sender("A", task_queue, clock, link_config, options, seed++);
+    Endpoint receiver("Z", task_queue, clock, link_config, options, seed++);
+    sender.ConnectTo(receiver);
+    receiver.ConnectTo(sender);
+    sender.socket().SetBufferedAmountLowThreshold(kStreamId,
+                                                  kBufferedAmountLowThreshold);
+    sender.socket().Connect();
+    time_controller.AdvanceTime(TimeDelta::Zero());
+
+    // The time a message is given to the socket, by message index. The index
+    // is sent at the start of the payload.
+    std::vector<Timestamp> sent_times;
+    sent_times.reserve(num_messages);
+    sender.on_buffered_amount_low = [&] {
+      while (sent_times.size() < num_messages &&
+             sender.socket().buffered_amount(kStreamId) < kMaxBufferedAmount) {
+        uint32_t index = sent_times.size();
+        std::vector<uint8_t> payload(std::max(message_size, sizeof(index)));
+        std::memcpy(payload.data(), &index, sizeof(index));
+        sent_times.push_back(clock->CurrentTime());
+        sender.socket().Send(
+            DcSctpMessage(kStreamId, kPpid, std::move(payload)), send_options);
+      }
+    };
+    size_t received_messages = 0;
+    Timestamp last_received_time = clock->CurrentTime();
+    receiver.on_message_received = [&](DcSctpMessage message) {
+      uint32_t index;
+      std::memcpy(&index, message.payload().data(), sizeof(index));
+      last_received_time = clock->CurrentTime();
+      latencies.push_back(last_received_time - sent_times[index]);
+      ++received_messages;
+    };
+
+    const Timestamp start_time = clock->CurrentTime();
+    sender.on_buffered_amount_low();
+    while (received_messages < num_messages &&
+           clock->CurrentTime() - start_time < kMaxTransferDuration) {
+      time_controller.AdvanceTime(TimeDelta::Millis(10));
+    }
+    if (received_messages < num_messages) {
+      state.SkipWithError("The transfer did not complete");
+      break;
+    }
+    total_duration += last_received_time - start_time;
+    total_received_messages += received_messages;
+  }
+  if (latencies.empty() || total_duration <= TimeDelta::Zero()) {
+    return;
+  }
+
+  const double received_bytes =
+      static_cast<double>(total_received_messages) * message_size;
+  state.SetBytesProcessed(received_bytes);
+  state.SetItemsProcessed(total_received_messages);
+  // Rates are in simulated time, while the benchmark time is CPU time.
+  state.counters["messages_per_second"] =
+      total_received_messages / total_duration.seconds<double>();
+  state.counters["goodput_mbps"] =
+      received_bytes * 8 / total_duration.seconds<double>() / 1'000'000;
+  state.counters["latency_p50_ms"] = Percentile(latencies, 0.5);
+  state.counters["latency_p99_ms"] = Percentile(latencies, 0.99);
+  state.counters["cpu_us_per_MB"] = benchmark::Counter(
+      received_bytes / (1024 * 1024) / 1'000'000,
+      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+// Message size in bytes, 1 for unordered messages, 1 for I-DATA, and the index
+// of the link in `kLinkConfigs`.
+BENCHMARK(BM_Transfer)
+    ->ArgsProduct({{1000, 16 * 1024, 256 * 1024}, {0, 1}, {0, 1}, {0, 1, 2}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace dcsctp
@@ -124,6 +124,9 @@ void OutstandingData::AckChunk(AckInfo& ack_info,
                  to_be_fast_retransmitted_.end());
       to_be_retransmitted_.erase(tsn);
     }
+    if (!item.has_been_retransmitted()) {
+      rack_time_sent_ = std::max(rack_time_sent_, item.time_sent());
+    }
     item.Ack();
     ack_info.highest_tsn_acked = std::max(ack_info.highest_tsn_acked, tsn);
   }
@@ -198,17 +201,46 @@ void OutstandingData::AckGapBlocks(
   // "SCTP considers the information carried in the Gap Ack Blocks in the
   // SACK chunk as advisory.". Note that when NR-SACK is supported, this can be
   // handled differently.
-
+  //
+  // With a large congestion window and packet loss, the gap ack blocks can
+  // cover thousands of chunks, which mostly have been acked by previous SACKs.
+  // Those are skipped by walking `acked_gap_ranges_` in parallel.
+  std::vector<std::pair<UnwrappedTSN, UnwrappedTSN>> acked_ranges;
+  acked_ranges.reserve(gap_ack_blocks.size());
+  bool is_well_formed = true;
+  auto previously_acked = acked_gap_ranges_.begin();
   for (auto& block : gap_ack_blocks) {
     UnwrappedTSN start = UnwrappedTSN::AddTo(cumulative_tsn_ack, block.start);
     UnwrappedTSN end = UnwrappedTSN::AddTo(cumulative_tsn_ack, block.end);
-    for (UnwrappedTSN tsn = start; tsn <= end; tsn = tsn.next_value()) {
-      if (tsn > last_cumulative_tsn_ack_ && tsn < next_tsn()) {
-        Item& item = GetItem(tsn);
-        AckChunk(ack_info, tsn, item);
+    if (start > end ||
+        (!acked_ranges.empty() && start <= acked_ranges.back().second)) {
+      is_well_formed = false;
+    }
+    UnwrappedTSN first = std::max(start, last_cumulative_tsn_ack_.next_value());
+    UnwrappedTSN last = std::min(end, highest_outstanding_tsn());
+    for (UnwrappedTSN tsn = first; tsn <= last; tsn = tsn.next_value()) {
+      while (previously_acked != acked_gap_ranges_.end() &&
+             previously_acked->second < tsn) {
+        ++previously_acked;
+      }
+      if (previously_acked != acked_gap_ranges_.end() &&
+          previously_acked->first <= tsn) {
+        tsn = std::min(previously_acked->second, last);
+        continue;
       }
+      AckChunk(ack_info, tsn, GetItem(tsn));
     }
+    if (first <= last) {
+      acked_ranges.emplace_back(first, last);
+    }
+  }
+
+  // Malformed gap ack blocks may nack chunks that were just acked, so they
+  // can't be used to skip chunks when processing the next SACK.
+  if (!is_well_formed) {
+    acked_ranges.clear();
   }
+  acked_gap_ranges_ = std::move(acked_ranges);
 }
 
 void OutstandingData::NackBetweenAckBlocks(
@@ -245,7 +277,7 @@ void OutstandingData::NackBetweenAckBlocks(
          tsn < cur_block_first_acked && tsn <= max_tsn_to_nack;
          tsn = tsn.next_value()) {
       ack_info.has_packet_loss |=
-          NackItem(tsn, /*retransmit_now=*/false,
+          NackItem(tsn, /*retransmit_now=*/IsLostByRack(tsn),
                    /*do_fast_retransmit=*/!is_in_fast_recovery);
     }
     prev_block_last_acked = UnwrappedTSN::AddTo(cumulative_tsn_ack, block.end);
@@ -257,6 +289,19 @@ void OutstandingData::NackBetweenAckBlocks(
   // NACKing.
 }
 
+bool OutstandingData::IsLostByRack(UnwrappedTSN tsn) const {
+  if (!rack_reorder_window_.has_value()) {
+    return false;
+  }
+  // https://datatracker.ietf.org/doc/html/rfc8985#section-6.2
+  // "A segment is marked as lost if it was sent before the most recently
+  // delivered segment by more than the reordering window". Retransmitted chunks
+  // are excluded, as their latest send time isn't known.
+  const Item& item = GetItem(tsn);
+  return !item.has_been_retransmitted() &&
+         item.time_sent() + *rack_reorder_window_ < rack_time_sent_;
+}
+
 bool OutstandingData::NackItem(UnwrappedTSN tsn,
                                bool retransmit_now,
                                bool do_fast_retransmit) {
@@ -576,6 +621,7 @@ IForwardTsnChunk OutstandingData::CreateIForwardTsn() const {
 void OutstandingData::ResetSequenceNumbers(UnwrappedTSN last_cumulative_tsn) {
   RTC_DCHECK(outstanding_data_.empty());
   last_cumulative_tsn_ack_ = last_cumulative_tsn;
+  acked_gap_ranges_.clear();
 }
 
 void OutstandingData::BeginResetStreams() {
@@ -17,6 +17,7 @@
 #include <utility>
 #include <vector>
 
+#include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "net/dcsctp/common/internal_types.h"
 #include "net/dcsctp/common/sequence_numbers.h"
@@ -167,6 +168,14 @@ class OutstandingData {
   // abandoned, which means that a FORWARD-TSN should be sent.
   bool ShouldSendForwardTsn() const;
 
+  // Enables time-based loss detection, inspired by RACK (RFC 8985). When set,
+  // a chunk that is reported missing is considered lost as soon as a chunk that
+  // was sent more than `reorder_window` after it has been acked, instead of
+  // only after having been reported missing three times.
+  void set_rack_reorder_window(webrtc::TimeDelta reorder_window) {
+    rack_reorder_window_ = reorder_window;
+  }
+
   // Sets the next TSN to be used. This is used in handover.
   void ResetSequenceNumbers(UnwrappedTSN last_cumulative_tsn);
 
@@ -307,7 +316,10 @@ class OutstandingData {
   void RemoveAcked(UnwrappedTSN cumulative_tsn_ack, AckInfo& ack_info);
 
   // Will mark the chunks covered by the `gap_ack_blocks` from an incoming SACK
-  // as "acked" and update `ack_info` by adding new TSNs to `added_tsns`.
+  // as "acked" and update `ack_info` by adding new TSNs to `added_tsns`. Chunks
+  // covered by the gap ack blocks of the previous SACK are skipped, as they are
+  // already acked, which makes this proportional to the number of newly acked
+  // chunks rather than to the number of outstanding chunks.
   void AckGapBlocks(
       UnwrappedTSN cumulative_tsn_ack,
       webrtc::ArrayView<const SackChunk::GapAckBlock> gap_ack_blocks,
@@ -323,6 +335,10 @@ class OutstandingData {
       bool is_in_fast_recovery,
       OutstandingData::AckInfo& ack_info);
 
+  // Indicates if the chunk with `tsn` is considered lost as a chunk sent more
+  // than `rack_reorder_window_` after it has been acked.
+  bool IsLostByRack(UnwrappedTSN tsn) const;
+
   // Process the acknowledgement of the chunk referenced by `iter` and updates
   // state in `ack_info` and the object's state.
   void AckChunk(AckInfo& ack_info, UnwrappedTSN tsn, Item& item);
@@ -374,6 +390,15 @@ class OutstandingData {
   std::set<UnwrappedTSN> to_be_fast_retransmitted_;
   // Data chunks that are to be retransmitted.
   std::set<UnwrappedTSN> to_be_retransmitted_;
+  // The gap ack blocks of the last SACK as ranges of outstanding TSNs, sorted
+  // and non-overlapping. All chunks within these ranges are acked. Empty if the
+  // last SACK had malformed gap ack blocks.
+  std::vector<std::pair<UnwrappedTSN, UnwrappedTSN>> acked_gap_ranges_;
+  // If set, enables RACK-style loss detection. See `set_rack_reorder_window`.
+  std::optional<webrtc::TimeDelta> rack_reorder_window_;
+  // The latest time that an acked chunk, which was never retransmitted, was
+  // sent (RACK.xmit_ts in RFC 8985).
+  webrtc::Timestamp rack_time_sent_ = webrtc::Timestamp::MinusInfinity();
   // Wben a stream reset has begun, the "next TSN to assign" is added to this
   // set, and removed when the cum-ack TSN reaches it. This is used to limit a
   // FORWARD-TSN to reset streams past a "stream reset last assigned TSN".
@@ -0,0 +1,170 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "net/dcsctp/common/internal_types.h"
+#include "net/dcsctp/common/sequence_numbers.h"
+#include "net/dcsctp/packet/chunk/data_chunk.h"
+#include "net/dcsctp/packet/chunk/sack_chunk.h"
+#include "net/dcsctp/packet/data.h"
+#include "net/dcsctp/public/types.h"
+#include "net/dcsctp/tx/outstanding_data.h"
+
+namespace dcsctp {
+namespace {
+using ::webrtc::TimeDelta;
+using ::webrtc::Timestamp;
+
+constexpr uint32_t kInitialTsn = 10;
+constexpr size_t kPayloadSize = 1000;
+constexpr size_t kMtu = 1200;
+// Chunks are sent at 100 Mbps.
+constexpr TimeDelta kChunkInterval = TimeDelta::Micros(80);
+constexpr TimeDelta kReorderWindow = TimeDelta::Millis(1);
+// Same as the limit in DataTracker.
+constexpr size_t kMaxGapAckBlocks = 20;
+
+struct Sack {
+  TSN cumulative_tsn_ack;
+  std::vector<SackChunk::GapAckBlock> gap_ack_blocks;
+};
+
+// Returns the SACKs that the receiver sends when the first `window_size` chunks
+// are sent in one go, acking every second received chunk. Every
+// `loss_interval`:th chunk is lost, and its retransmission is received after a
+// fourth of the window.
+std::vector<Sack> CreateSacks(uint32_t window_size, uint32_t loss_interval) {
+  const uint32_t retransmission_delay = window_size / 4;
+  std::vector<uint32_t> received_order;
+  std::deque<std::pair<uint32_t, uint32_t>> lost;
+  for (uint32_t i = 0; i < window_size; ++i) {
+    if (i % loss_interval == loss_interval / 2) {
+      lost.emplace_back(i + retransmission_delay, i);
+    } else {
+      received_order.push_back(i);
+    }
+    while (!lost.empty() && lost.front().first == i) {
+      received_order.push_back(lost.front().second);
+      lost.pop_front();
+    }
+  }
+  for (const auto& [unused, i] : lost) {
+    received_order.push_back(i);
+  }
+
+  // Received chunks above the cumulative ack, as ranges of [first, last].
+  std::map<uint32_t, uint32_t> received;
+  uint32_t cumulative_ack = 0;
+  std::vector<Sack> sacks;
+  for (size_t n = 0; n < received_order.size(); ++n) {
+    uint32_t index = received_order[n] + 1;
+    auto next = received.find(index + 1);
+    uint32_t range_end = index;
+    if (next != received.end()) {
+      range_end = next->second;
+      received.erase(next);
+    }
+    auto prev = received.lower_bound(index);
+    if (prev != received.begin() && std::prev(prev)->second + 1 == index) {
+      std::prev(prev)->second = range_end;
+    } else {
+      received.emplace(index, range_end);
+    }
+    if (!received.empty() && received.begin()->first == cumulative_ack + 1) {
+      cumulative_ack = received.begin()->second;
+      received.erase(received.begin());
+    }
+
+    if (n % 2 == 1 || n == received_order.size() - 1) {
+      std::vector<SackChunk::GapAckBlock> gap_ack_blocks;
+      for (const auto& [first, last] : received) {
+        if (gap_ack_blocks.size() == kMaxGapAckBlocks) {
+          break;
+        }
+        gap_ack_blocks.emplace_back(first - cumulative_ack,
+                                    last - cumulative_ack);
+      }
+      sacks.push_back(
+          {.cumulative_tsn_ack = TSN(kInitialTsn - 1 + cumulative_ack),
+           .gap_ack_blocks = std::move(gap_ack_blocks)});
+    }
+  }
+  return sacks;
+}
+
+// Handles the SACKs of a window of `state.range(0)` outstanding chunks, where
+// every `state.range(1)`:th chunk is lost, with RACK-style loss detection if
+// `state.range(2)` is 1. Retransmissions are requested after every SACK, as
+// done by the RetransmissionQueue.
+void BM_HandleSack(benchmark::State& state) {
+  const uint32_t window_size = state.range(0);
+  const uint32_t loss_interval = state.range(1);
+  const bool use_rack = state.range(2) != 0;
+  const std::vector<Sack> sacks = CreateSacks(window_size, loss_interval);
+  const Data data(StreamID(1), SSN(0), MID(0), FSN(0), PPID(53),
+                  std::vector<uint8_t>(kPayloadSize), Data::IsBeginning(true),
+                  Data::IsEnd(true), IsUnordered(false));
+  size_t num_retransmissions = 0;
+  std::unique_ptr<OutstandingData> outstanding_data;
+  for (auto _ : state) {
+    state.PauseTiming();
+    UnwrappedTSN::Unwrapper unwrapper;
+    outstanding_data = std::make_unique<OutstandingData>(
+        DataChunk::kHeaderSize, unwrapper.Unwrap(TSN(kInitialTsn - 1)),
+        [](StreamID, OutgoingMessageId) { return false; });
+    if (use_rack) {
+      outstanding_data->set_rack_reorder_window(kReorderWindow);
+    }
+    Timestamp time_sent = Timestamp::Seconds(1000);
+    for (uint32_t i = 0; i < window_size; ++i) {
+      outstanding_data->Insert(OutgoingMessageId(i), data, time_sent);
+      time_sent += kChunkInterval;
+    }
+    state.ResumeTiming();
+
+    for (const Sack& sack : sacks) {
+      outstanding_data->HandleSack(unwrapper.Unwrap(sack.cumulative_tsn_ack),
+                                   sack.gap_ack_blocks,
+                                   /*is_in_fast_recovery=*/false);
+      if (outstanding_data->has_data_to_be_fast_retransmitted()) {
+        num_retransmissions +=
+            outstanding_data->GetChunksToBeFastRetransmitted(kMtu).size();
+      }
+      if (outstanding_data->has_data_to_be_retransmitted()) {
+        num_retransmissions +=
+            outstanding_data->GetChunksToBeRetransmitted(window_size * kMtu)
+                .size();
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * sacks.size());
+  state.counters["retransmissions"] =
+      static_cast<double>(num_retransmissions) / state.iterations();
+}
+
+// Number of outstanding chunks, loss interval in chunks and 1 for RACK-style
+// loss detection.
+BENCHMARK(BM_HandleSack)
+    ->ArgsProduct({{1000, 10000, 100000}, {100, 5000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace dcsctp
@@ -205,6 +205,77 @@ TEST_F(OutstandingDataTest, NacksThreeTimesResultsInRetransmission) {
   EXPECT_THAT(buf_.GetChunksToBeRetransmitted(1000), IsEmpty());
 }
 
+TEST_F(OutstandingDataTest, OnlyAcksNewlyAckedChunksInGrowingGapAckBlocks) {
+  buf_.Insert(kMessageId, gen_.Ordered({1}, "B"), kNow);
+  buf_.Insert(kMessageId, gen_.Ordered({1}, ""), kNow);
+  buf_.Insert(kMessageId, gen_.Ordered({1}, ""), kNow);
+  buf_.Insert(kMessageId, gen_.Ordered({1}, ""), kNow);
+  buf_.Insert(kMessageId, gen_.Ordered({1}, ""), kNow);
+  buf_.Insert(kMessageId, gen_.Ordered({1}, "E"), kNow);
+  const size_t kChunkSize = DataChunk::kHeaderSize + RoundUpTo4(1);
+
+  std::vector<SackChunk::GapAckBlock> gab1 = {SackChunk::GapAckBlock(2, 3)};
+  EXPECT_EQ(buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab1, false).bytes_acked,
+            2 * kChunkSize);
+
+  std::vector<SackChunk::GapAckBlock> gab2 = {SackChunk::GapAckBlock(2, 5)};
+  OutstandingData::AckInfo ack =
+      buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab2, false);
+  EXPECT_EQ(ack.bytes_acked, 2 * kChunkSize);
+  EXPECT_EQ(ack.highest_tsn_acked.Wrap(), TSN(14));
+
+  // TSN 13 is no longer reported as received, which nacks it.
+  std::vector<SackChunk::GapAckBlock> gab3 = {SackChunk::GapAckBlock(2, 3),
+                                              SackChunk::GapAckBlock(5, 6)};
+  EXPECT_EQ(buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab3, false).bytes_acked,
+            kChunkSize);
+  EXPECT_THAT(buf_.GetChunkStatesForTesting(),
+              ElementsAre(Pair(TSN(9), State::kAcked),               //
+                          Pair(TSN(10), State::kToBeRetransmitted),  //
+                          Pair(TSN(11), State::kAcked),              //
+                          Pair(TSN(12), State::kAcked),              //
+                          Pair(TSN(13), State::kNacked),             //
+                          Pair(TSN(14), State::kAcked),              //
+                          Pair(TSN(15), State::kAcked)));
+
+  std::vector<SackChunk::GapAckBlock> gab4 = {SackChunk::GapAckBlock(2, 6)};
+  EXPECT_EQ(buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab4, false).bytes_acked,
+            kChunkSize);
+  EXPECT_THAT(buf_.GetChunkStatesForTesting(),
+              ElementsAre(Pair(TSN(9), State::kAcked),               //
+                          Pair(TSN(10), State::kToBeRetransmitted),  //
+                          Pair(TSN(11), State::kAcked),              //
+                          Pair(TSN(12), State::kAcked),              //
+                          Pair(TSN(13), State::kAcked),              //
+                          Pair(TSN(14), State::kAcked),              //
+                          Pair(TSN(15), State::kAcked)));
+}
+
+TEST_F(OutstandingDataTest, RackRetransmitsWhenLaterSentChunkIsAcked) {
+  buf_.set_rack_reorder_window(TimeDelta::Millis(10));
+  buf_.Insert(kMessageId, gen_.Ordered({1}, "B"), kNow);
+  buf_.Insert(kMessageId, gen_.Ordered({1}, ""), kNow + TimeDelta::Millis(5));
+  buf_.Insert(kMessageId, gen_.Ordered({1}, "E"), kNow + TimeDelta::Millis(20));
+
+  // TSN 11 was sent within the reordering window of TSN 10.
+  std::vector<SackChunk::GapAckBlock> gab1 = {SackChunk::GapAckBlock(2, 2)};
+  EXPECT_FALSE(
+      buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab1, false).has_packet_loss);
+  EXPECT_FALSE(buf_.has_data_to_be_retransmitted());
+
+  // TSN 12 wasn't, which makes TSN 10 lost after being nacked only twice.
+  std::vector<SackChunk::GapAckBlock> gab2 = {SackChunk::GapAckBlock(2, 3)};
+  EXPECT_TRUE(
+      buf_.HandleSack(unwrapper_.Unwrap(TSN(9)), gab2, false).has_packet_loss);
+  EXPECT_THAT(buf_.GetChunkStatesForTesting(),
+              ElementsAre(Pair(TSN(9), State::kAcked),               //
+                          Pair(TSN(10), State::kToBeRetransmitted),  //
+                          Pair(TSN(11), State::kAcked),              //
+                          Pair(TSN(12), State::kAcked)));
+  EXPECT_THAT(buf_.GetChunksToBeFastRetransmitted(1000),
+              ElementsAre(Pair(TSN(10), _)));
+}
+
 TEST_F(OutstandingDataTest, NacksThreeTimesResultsInAbandoning) {
   static constexpr MaxRetransmits kMaxRetransmissions(0);
   buf_.Insert(kMessageId, gen_.Ordered({1}, "B"), kNow, kMaxRetransmissions);
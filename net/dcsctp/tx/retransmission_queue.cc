@@ -347,6 +347,12 @@ void RetransmissionQueue::UpdateRTT(Timestamp now,
 
   if (rtt.IsFinite()) {
     on_new_rtt_(rtt);
+    if (options_.enable_rack_loss_detection && rtt < min_rtt_) {
+      // https://datatracker.ietf.org/doc/html/rfc8985#section-6.2
+      // "RACK.reo_wnd = RACK.min_RTT / 4"
+      min_rtt_ = rtt;
+      outstanding_data_.set_rack_reorder_window(min_rtt_ / 4);
+    }
   }
 }
 
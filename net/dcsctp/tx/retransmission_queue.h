@@ -21,6 +21,7 @@
 
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
+#include "api/units/time_delta.h"
 #include "net/dcsctp/common/sequence_numbers.h"
 #include "net/dcsctp/packet/chunk/forward_tsn_chunk.h"
 #include "net/dcsctp/packet/chunk/iforward_tsn_chunk.h"
@@ -234,6 +235,8 @@ class RetransmissionQueue {
   size_t ssthresh_;
   // Partial Bytes Acked. See RFC4960.
   size_t partial_bytes_acked_;
+  // The smallest measured RTT, used for RACK-style loss detection.
+  webrtc::TimeDelta min_rtt_ = webrtc::TimeDelta::PlusInfinity();
 
   // See `dcsctp::Metrics`.
   size_t rtx_packets_count_ = 0;
@@ -9,6 +9,8 @@
  */
 #include "net/dcsctp/tx/rr_send_queue.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <limits>
@@ -145,7 +147,6 @@ std::optional<SendQueue::DataToSend> RRSendQueue::OutgoingStream::Produce(
 
   while (!items_.empty()) {
     Item& item = items_.front();
-    DcSctpMessage& message = item.message;
 
     // Allocate Message ID and SSN when the first fragment is sent.
     if (!item.mid.has_value()) {
@@ -167,22 +168,15 @@ std::optional<SendQueue::DataToSend> RRSendQueue::OutgoingStream::Produce(
     }
 
     // Grab the next `max_size` fragment from this message and calculate flags.
-    webrtc::ArrayView<const uint8_t> chunk_payload =
-        item.message.payload().subview(item.remaining_offset, max_size);
-    webrtc::ArrayView<const uint8_t> message_payload = message.payload();
-    Data::IsBeginning is_beginning(chunk_payload.data() ==
-                                   message_payload.data());
-    Data::IsEnd is_end((chunk_payload.data() + chunk_payload.size()) ==
-                       (message_payload.data() + message_payload.size()));
-
-    StreamID stream_id = message.stream_id();
-    PPID ppid = message.ppid();
-
-    // Zero-copy the payload if the message fits in a single chunk.
-    std::vector<uint8_t> payload =
-        is_beginning && is_end
-            ? std::move(message).ReleasePayload()
-            : std::vector<uint8_t>(chunk_payload.begin(), chunk_payload.end());
+    size_t chunk_size = std::min(item.remaining_size, max_size);
+    Data::IsBeginning is_beginning(item.remaining_offset == 0);
+    Data::IsEnd is_end(chunk_size == item.remaining_size);
+
+    // The fragment shares the message payload, so the payload is not copied
+    // here nor when the chunk is retained for retransmission.
+    Data::Payload payload =
+        item.payload.Slice(item.remaining_offset, chunk_size);
+    StreamID stream_id = item.stream_id;
 
     FSN fsn(item.current_fsn);
     item.current_fsn = FSN(*item.current_fsn + 1);
@@ -191,7 +185,7 @@ std::optional<SendQueue::DataToSend> RRSendQueue::OutgoingStream::Produce(
 
     SendQueue::DataToSend chunk(
         item.message_id, Data(stream_id, item.ssn.value_or(SSN(0)), *item.mid,
-                              fsn, ppid, std::move(payload), is_beginning,
+                              fsn, item.ppid, std::move(payload), is_beginning,
                               is_end, item.attributes.unordered));
     chunk.max_retransmissions = item.attributes.max_retransmissions;
     chunk.expires_at = item.attributes.expires_at;
@@ -199,8 +193,8 @@ std::optional<SendQueue::DataToSend> RRSendQueue::OutgoingStream::Produce(
         is_end ? item.attributes.lifecycle_id : LifecycleId::NotSet();
 
     if (is_end) {
-      // The entire message has been sent, and its last data copied to `chunk`,
-      // so it can safely be discarded.
+      // The entire message has been sent, and `chunk` holds a reference to its
+      // payload, so it can safely be discarded.
       items_.pop_front();
 
       if (pause_state_ == PauseState::kPending) {
@@ -209,10 +203,10 @@ std::optional<SendQueue::DataToSend> RRSendQueue::OutgoingStream::Produce(
         pause_state_ = PauseState::kPaused;
       }
     } else {
-      item.remaining_offset += chunk_payload.size();
-      item.remaining_size -= chunk_payload.size();
+      item.remaining_offset += chunk_size;
+      item.remaining_size -= chunk_size;
       RTC_DCHECK(item.remaining_offset + item.remaining_size ==
-                 item.message.payload().size());
+                 item.payload.size());
       RTC_DCHECK(item.remaining_size > 0);
     }
     RTC_DCHECK(IsConsistent());
@@ -326,12 +320,11 @@ void RRSendQueue::OutgoingStream::Reset() {
     // If this message has been partially sent, reset it so that it will be
     // re-sent.
     auto& item = items_.front();
-    buffered_amount_.Increase(item.message.payload().size() -
-                              item.remaining_size);
-    parent_.total_buffered_amount_.Increase(item.message.payload().size() -
+    buffered_amount_.Increase(item.payload.size() - item.remaining_size);
+    parent_.total_buffered_amount_.Increase(item.payload.size() -
                                             item.remaining_size);
     item.remaining_offset = 0;
-    item.remaining_size = item.message.payload().size();
+    item.remaining_size = item.payload.size();
     item.mid = std::nullopt;
     item.ssn = std::nullopt;
     item.current_fsn = FSN(0);
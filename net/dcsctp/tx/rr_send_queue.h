@@ -23,6 +23,7 @@
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
 #include "net/dcsctp/common/internal_types.h"
+#include "net/dcsctp/packet/data.h"
 #include "net/dcsctp/public/dcsctp_message.h"
 #include "net/dcsctp/public/dcsctp_socket.h"
 #include "net/dcsctp/public/types.h"
@@ -222,12 +223,17 @@ class RRSendQueue : public SendQueue {
                     DcSctpMessage msg,
                     MessageAttributes attributes)
           : message_id(message_id),
-            message(std::move(msg)),
+            stream_id(msg.stream_id()),
+            ppid(msg.ppid()),
+            payload(std::move(msg).ReleasePayload()),
             attributes(std::move(attributes)),
             remaining_offset(0),
-            remaining_size(message.payload().size()) {}
+            remaining_size(payload.size()) {}
       OutgoingMessageId message_id;
-      DcSctpMessage message;
+      StreamID stream_id;
+      PPID ppid;
+      // The message payload, which the produced fragments are slices of.
+      Data::Payload payload;
       MessageAttributes attributes;
       // The remaining payload (offset and size) to be sent, when it has been
       // fragmented.
@@ -27,6 +27,7 @@
 
 namespace dcsctp {
 namespace {
+using ::testing::ElementsAreArray;
 using ::testing::SizeIs;
 using ::testing::UnorderedElementsAre;
 using ::webrtc::TimeDelta;
@@ -531,6 +532,32 @@ TEST(RRSendQueueTest, ReturnsAlsoSmallFragmentsBeforeMovingToNext) {
               SizeIs(kTwoFragmentPacketSize - kOneFragmentPacketSize));
 }
 
+TEST(RRSendQueueTest, FragmentsShareThePayloadOfTheMessage) {
+  testing::NiceMock<MockDcSctpSocketCallbacks> cb;
+  RRSendQueue q("", &cb, kMtu, kDefaultPriority, kBufferedAmountLowThreshold);
+  std::vector<uint8_t> payload(kTwoFragmentPacketSize);
+  for (size_t i = 0; i < payload.size(); ++i) {
+    payload[i] = static_cast<uint8_t>(i);
+  }
+  q.Add(kNow, DcSctpMessage(StreamID(1), kPPID, payload));
+
+  ASSERT_HAS_VALUE_AND_ASSIGN(SendQueue::DataToSend chunk1,
+                              q.Produce(kNow, kOneFragmentPacketSize));
+  ASSERT_HAS_VALUE_AND_ASSIGN(SendQueue::DataToSend chunk2,
+                              q.Produce(kNow, kOneFragmentPacketSize));
+  EXPECT_THAT(chunk1.data.payload,
+              ElementsAreArray(payload.data(), kOneFragmentPacketSize));
+  EXPECT_THAT(chunk2.data.payload,
+              ElementsAreArray(payload.data() + kOneFragmentPacketSize,
+                               payload.size() - kOneFragmentPacketSize));
+  EXPECT_EQ(chunk2.data.payload.data(),
+            chunk1.data.payload.data() + kOneFragmentPacketSize);
+
+  // Retaining a fragment for retransmission doesn't copy its payload.
+  Data retained = chunk2.data.Clone();
+  EXPECT_EQ(retained.payload.data(), chunk2.data.payload.data());
+}
+
 TEST(RRSendQueueTest, WillCycleInRoundRobinFashionBetweenStreams) {
   testing::NiceMock<MockDcSctpSocketCallbacks> cb;
   RRSendQueue q("", &cb, kMtu, kDefaultPriority, kBufferedAmountLowThreshold);
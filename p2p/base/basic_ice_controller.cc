@@ -104,12 +104,10 @@ void BasicIceController::SetSelectedConnection(
 
 void BasicIceController::AddConnection(const Connection* connection) {
   connections_.push_back(connection);
-  unpinged_connections_.insert(connection);
 }
 
 void BasicIceController::OnConnectionDestroyed(const Connection* connection) {
   pinged_connections_.erase(connection);
-  unpinged_connections_.erase(connection);
   connections_.erase(absl::c_find(connections_, connection));
   if (selected_connection_ == connection)
     selected_connection_ = nullptr;
@@ -145,8 +143,8 @@ IceControllerInterface::PingResult BasicIceController::SelectConnectionToPing(
 }
 
 void BasicIceController::MarkConnectionPinged(const Connection* conn) {
-  if (conn && pinged_connections_.insert(conn).second) {
-    unpinged_connections_.erase(conn);
+  if (conn) {
+    pinged_connections_.insert(conn);
   }
 }
 
@@ -197,40 +195,29 @@ const Connection* BasicIceController::FindNextPingableConnection() {
   }
 
   // Rule 4: Unpinged connections have priority over pinged ones.
-  RTC_CHECK(connections_.size() ==
-            pinged_connections_.size() + unpinged_connections_.size());
   // If there are unpinged and pingable connections, only ping those.
   // Otherwise, treat everything as unpinged.
-  // TODO(honghaiz): Instead of adding two separate vectors, we can add a state
-  // "pinged" to filter out unpinged connections.
-  if (absl::c_none_of(unpinged_connections_,
-                      [this, now](const Connection* conn) {
-                        return this->IsPingable(conn, now);
-                      })) {
-    unpinged_connections_.insert(pinged_connections_.begin(),
-                                 pinged_connections_.end());
-    pinged_connections_.clear();
-  }
-
-  // Among un-pinged pingable connections, "more pingable" takes precedence.
-  std::vector<const Connection*> pingable_connections;
-  absl::c_copy_if(
-      unpinged_connections_, std::back_inserter(pingable_connections),
-      [this, now](const Connection* conn) { return IsPingable(conn, now); });
-  auto iter = absl::c_max_element(
-      pingable_connections,
-      [this](const Connection* conn1, const Connection* conn2) {
-        // Some implementations of max_element
-        // compare an element with itself.
-        if (conn1 == conn2) {
-          return false;
-        }
-        return MorePingable(conn1, conn2) == conn2;
-      });
-  if (iter != pingable_connections.end()) {
-    return *iter;
+  // Among those, "more pingable" takes precedence. Both candidates are found
+  // in a single pass over `connections_`, in order, so that the first one in
+  // the ordered `connections_` is kept among equally pingable connections.
+  const Connection* most_pingable_unpinged = nullptr;
+  const Connection* most_pingable_pinged = nullptr;
+  for (const Connection* conn : connections_) {
+    if (!IsPingable(conn, now)) {
+      continue;
+    }
+    const Connection*& most_pingable = pinged_connections_.contains(conn)
+                                           ? most_pingable_pinged
+                                           : most_pingable_unpinged;
+    if (!most_pingable || MorePingable(most_pingable, conn) == conn) {
+      most_pingable = conn;
+    }
   }
-  return nullptr;
+  if (most_pingable_unpinged) {
+    return most_pingable_unpinged;
+  }
+  pinged_connections_.clear();
+  return most_pingable_pinged;
 }
 
 // Find "triggered checks".  We ping first those connections that have
@@ -369,13 +356,9 @@ const Connection* BasicIceController::MorePingable(const Connection* conn1,
     return least_recently_pinged_conn;
   }
 
-  // During the initial state when nothing has been pinged yet, return the first
-  // one in the ordered `connections_`.
-  auto connections = connections_;
-  return *(std::find_if(connections.begin(), connections.end(),
-                        [conn1, conn2](const Connection* conn) {
-                          return conn == conn1 || conn == conn2;
-                        }));
+  // During the initial state when nothing has been pinged yet, the caller
+  // picks the first one in the ordered `connections_`.
+  return nullptr;
 }
 
 const Connection* BasicIceController::MostLikelyToWork(
@@ -558,15 +541,19 @@ BasicIceController::SortAndSwitchConnection(IceSwitchReason reason) {
   // one whose estimated latency is lowest.  So it is the only one that we
   // need to consider switching to.
   // TODO(honghaiz): Don't sort;  Just use std::max_element in the right places.
-  absl::c_stable_sort(
-      connections_, [this](const Connection* a, const Connection* b) {
-        int cmp = CompareConnections(a, b, std::nullopt, nullptr);
-        if (cmp != 0) {
-          return cmp > 0;
-        }
-        // Otherwise, sort based on latency estimate.
-        return a->rtt() < b->rtt();
-      });
+  auto less = [this](const Connection* a, const Connection* b) {
+    int cmp = CompareConnections(a, b, std::nullopt, nullptr);
+    if (cmp != 0) {
+      return cmp > 0;
+    }
+    // Otherwise, sort based on latency estimate.
+    return a->rtt() < b->rtt();
+  };
+  // Most state changes don't change the order, which is cheaper to check than
+  // to sort again, as the comparisons are expensive.
+  if (!absl::c_is_sorted(connections_, less)) {
+    absl::c_stable_sort(connections_, less);
+  }
 
   RTC_LOG(LS_VERBOSE) << "Sorting " << connections_.size()
                       << " available connections due to: "
@@ -0,0 +1,178 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "api/candidate.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "benchmark/benchmark.h"
+#include "p2p/base/basic_ice_controller.h"
+#include "p2p/base/basic_packet_socket_factory.h"
+#include "p2p/base/connection.h"
+#include "p2p/base/ice_controller_factory_interface.h"
+#include "p2p/base/ice_controller_interface.h"
+#include "p2p/base/ice_switch_reason.h"
+#include "p2p/base/ice_transport_internal.h"
+#include "p2p/base/p2p_constants.h"
+#include "p2p/base/p2p_transport_channel_ice_field_trials.h"
+#include "p2p/base/port.h"
+#include "p2p/base/stun_port.h"
+#include "p2p/base/transport_description.h"
+#include "rtc_base/ip_address.h"
+#include "rtc_base/network.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/virtual_socket_server.h"
+
+namespace webrtc {
+namespace {
+
+// Local candidates are gathered on this many networks, and every remote
+// candidate is paired with each of them.
+constexpr int kNumNetworks = 4;
+constexpr char kLocalUfrag[] = "TESTICEUFRAG0001";
+constexpr char kLocalPwd[] = "TESTICEPWD00000000000001";
+constexpr char kRemoteUfrag[] = "TESTICEUFRAG0002";
+constexpr char kRemotePwd[] = "TESTICEPWD00000000000002";
+
+// Candidate pairs between the host candidates of a few local networks and
+// trickled remote candidates, with different priorities. If
+// `with_writable_pairs` is true, a fourth of the pairs are writable, with
+// different round trip times, and the rest are still being checked.
+class CandidatePairs {
+ public:
+  CandidatePairs(int num_connections, bool with_writable_pairs)
+      : thread_(&socket_server_),
+        env_(CreateEnvironment()),
+        socket_factory_(&socket_server_) {
+    for (int i = 0; i < kNumNetworks; ++i) {
+      const IPAddress ip(0x0b000001 + i);
+      auto network = std::make_unique<Network>(
+          "network" + std::to_string(i), "benchmark", ip, 32);
+      network->AddIP(ip);
+      std::unique_ptr<UDPPort> port =
+          UDPPort::Create({.env = env_,
+                           .network_thread = &thread_,
+                           .socket_factory = &socket_factory_,
+                           .network = network.get(),
+                           .ice_username_fragment = kLocalUfrag,
+                           .ice_password = kLocalPwd},
+                          0, 0, false, std::nullopt);
+      port->SetIceRole(ICEROLE_CONTROLLING);
+      port->PrepareAddress();
+      networks_.push_back(std::move(network));
+      ports_.push_back(std::move(port));
+    }
+    for (int i = 0; i < num_connections; ++i) {
+      Candidate remote_candidate(
+          ICE_CANDIDATE_COMPONENT_RTP, "udp",
+          SocketAddress(IPAddress(0x16000001 + i / kNumNetworks), 5000),
+          /*priority=*/i, kRemoteUfrag, kRemotePwd, IceCandidateType::kHost,
+          0, std::to_string(i));
+      Connection* connection = ports_[i % kNumNetworks]->CreateConnection(
+          remote_candidate, Port::ORIGIN_MESSAGE);
+      if (with_writable_pairs && i % 4 == 0) {
+        connection->ReceivedPingResponse(/*rtt=*/10 + i % 97, "");
+      }
+      connections_.push_back(connection);
+    }
+  }
+
+  const std::vector<Connection*>& connections() const { return connections_; }
+
+ private:
+  VirtualSocketServer socket_server_;
+  AutoSocketServerThread thread_;
+  const Environment env_;
+  BasicPacketSocketFactory socket_factory_;
+  std::vector<std::unique_ptr<Network>> networks_;
+  std::vector<std::unique_ptr<UDPPort>> ports_;
+  std::vector<Connection*> connections_;
+};
+
+std::unique_ptr<BasicIceController> CreateIceController(
+    const IceFieldTrials* field_trials,
+    const std::vector<Connection*>& connections) {
+  auto controller = std::make_unique<BasicIceController>(
+      IceControllerFactoryArgs{
+          .ice_transport_state_func =
+              [] { return IceTransportStateInternal::STATE_CONNECTING; },
+          .ice_role_func = [] { return ICEROLE_CONTROLLING; },
+          .is_connection_pruned_func = [](const Connection*) { return false; },
+          .ice_field_trials = field_trials});
+  controller->SetIceConfig(IceConfig());
+  for (const Connection* connection : connections) {
+    controller->AddConnection(connection);
+  }
+  controller->SortAndSwitchConnection(
+      IceSwitchReason::NEW_CONNECTION_FROM_REMOTE_CANDIDATE);
+  return controller;
+}
+
+// Selects the next of `state.range(0)` candidate pairs to ping, as done on
+// every ping tick while checks are in progress. The pairs are not actually
+// pinged, so that only the controller is measured.
+void BM_SelectConnectionToPing(benchmark::State& state) {
+  CandidatePairs pairs(state.range(0), /*with_writable_pairs=*/false);
+  IceFieldTrials field_trials;
+  std::unique_ptr<BasicIceController> controller =
+      CreateIceController(&field_trials, pairs.connections());
+  for (auto _ : state) {
+    IceControllerInterface::PingResult result =
+        controller->SelectConnectionToPing(/*last_ping_sent_ms=*/0);
+    if (!result.connection) {
+      state.SkipWithError("No connection to ping");
+      break;
+    }
+    controller->MarkConnectionPinged(*result.connection);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Number of candidate pairs.
+BENCHMARK(BM_SelectConnectionToPing)->RangeMultiplier(4)->Range(16, 1024);
+
+// Sorts `state.range(0)` candidate pairs and decides whether to switch, as
+// done on every state change. Every iteration, one of the writable pairs gets
+// a ping response with a new round trip time, which doesn't change the order
+// as the pairs have different priorities.
+void BM_SortAndSwitchConnection(benchmark::State& state) {
+  CandidatePairs pairs(state.range(0), /*with_writable_pairs=*/true);
+  IceFieldTrials field_trials;
+  std::unique_ptr<BasicIceController> controller =
+      CreateIceController(&field_trials, pairs.connections());
+  const std::vector<Connection*>& connections = pairs.connections();
+  size_t next = 0;
+  int rtt = 0;
+  for (auto _ : state) {
+    connections[next]->ReceivedPingResponse(10 + rtt, "");
+    next = (next + 4) % connections.size();
+    rtt = (rtt + 31) % 97;
+    IceControllerInterface::SwitchResult result =
+        controller->SortAndSwitchConnection(
+            IceSwitchReason::CONNECT_STATE_CHANGE);
+    if (result.connection) {
+      controller->SetSelectedConnection(*result.connection);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Number of candidate pairs.
+BENCHMARK(BM_SortAndSwitchConnection)->RangeMultiplier(4)->Range(16, 1024);
+
+}  // namespace
+}  // namespace webrtc
@@ -533,7 +533,7 @@ void Connection::OnReadPacket(const ReceivedIpPacket& packet) {
   } else if (IsStunSuccessResponseType(msg->type()) ||
              IsStunErrorResponseType(msg->type())) {
     RTC_DCHECK(msg->integrity() == StunMessage::IntegrityStatus::kNotSet);
-    if (msg->ValidateMessageIntegrity(remote_candidate().password()) !=
+    if (msg->ValidateMessageIntegrity(remote_password_integrity_key()) !=
         StunMessage::IntegrityStatus::kIntegrityOk) {
       // "silently" discard the response.
       RTC_LOG(LS_VERBOSE) << ToString() << ": Discarding "
@@ -1840,6 +1840,18 @@ bool Connection::ShouldSendGoogPing(const StunMessage* message) {
   return false;
 }
 
+StunMessageIntegrityKey& Connection::remote_password_integrity_key() {
+  // The remote password may be updated, e.g. on an ICE restart or when a peer
+  // reflexive candidate gets signaled, so the key is recreated when it no
+  // longer matches.
+  if (!remote_password_integrity_key_ ||
+      remote_password_integrity_key_->password() !=
+          remote_candidate_.password()) {
+    remote_password_integrity_key_.emplace(remote_candidate_.password());
+  }
+  return *remote_password_integrity_key_;
+}
+
 void Connection::ForgetLearnedState() {
   RTC_DCHECK_RUN_ON(network_thread_);
   RTC_LOG(LS_INFO) << ToString() << ": Connection forget learned state";
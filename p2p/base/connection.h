@@ -437,6 +437,11 @@ class RTC_EXPORT Connection : public CandidatePairInterface {
   bool ShouldSendGoogPing(const StunMessage* message)
       RTC_RUN_ON(network_thread_);
 
+  // Returns the key used to verify the MESSAGE-INTEGRITY of received STUN
+  // responses, which caches the HMAC key schedule of the remote password.
+  StunMessageIntegrityKey& remote_password_integrity_key()
+      RTC_RUN_ON(network_thread_);
+
   WriteState write_state_ RTC_GUARDED_BY(network_thread_);
   bool receiving_ RTC_GUARDED_BY(network_thread_);
   bool connected_ RTC_GUARDED_BY(network_thread_);
@@ -505,6 +510,8 @@ class RTC_EXPORT Connection : public CandidatePairInterface {
   std::optional<bool> remote_support_goog_ping_ RTC_GUARDED_BY(network_thread_);
   std::unique_ptr<StunMessage> cached_stun_binding_
       RTC_GUARDED_BY(network_thread_);
+  std::optional<StunMessageIntegrityKey> remote_password_integrity_key_
+      RTC_GUARDED_BY(network_thread_);
 
   const IceFieldTrials* field_trials_;
   EventBasedExponentialMovingAverage rtt_estimate_
@@ -458,7 +458,7 @@ bool Port::GetStunMessage(const char* data,
     }
 
     // If ICE, and the MESSAGE-INTEGRITY is bad, fail with a 401 Unauthorized
-    if (stun_msg->ValidateMessageIntegrity(password_) !=
+    if (stun_msg->ValidateMessageIntegrity(password_integrity_key()) !=
         StunMessage::IntegrityStatus::kIntegrityOk) {
       RTC_LOG(LS_ERROR) << ToString() << ": Received "
                         << StunMethodToString(stun_msg->type())
@@ -525,7 +525,7 @@ bool Port::GetStunMessage(const char* data,
     // No stun attributes will be verified, if it's stun indication message.
     // Returning from end of the this method.
   } else if (stun_msg->type() == GOOG_PING_REQUEST) {
-    if (stun_msg->ValidateMessageIntegrity(password_) !=
+    if (stun_msg->ValidateMessageIntegrity(password_integrity_key()) !=
         StunMessage::IntegrityStatus::kIntegrityOk) {
       RTC_LOG(LS_ERROR) << ToString() << ": Received "
                         << StunMethodToString(stun_msg->type())
@@ -559,6 +559,16 @@ bool Port::GetStunMessage(const char* data,
   return true;
 }
 
+StunMessageIntegrityKey& Port::password_integrity_key() {
+  // The password may change with SetIceParameters, so the key is recreated
+  // when it no longer matches.
+  if (!password_integrity_key_ ||
+      password_integrity_key_->password() != password_) {
+    password_integrity_key_.emplace(password_);
+  }
+  return *password_integrity_key_;
+}
+
 bool Port::IsCompatibleAddress(const SocketAddress& addr) {
   // Get a representative IP for the Network this port is configured to use.
   IPAddress ip = network_->GetBestIP();
@@ -451,6 +451,10 @@ class RTC_EXPORT Port : public PortInterface, public sigslot::has_slots<> {
   // distinct.
   void DestroyConnectionInternal(Connection* conn, bool async);
 
+  // Returns the key used to verify the MESSAGE-INTEGRITY of received STUN
+  // requests, which caches the HMAC key schedule of `password_`.
+  StunMessageIntegrityKey& password_integrity_key() RTC_RUN_ON(thread_);
+
   void OnNetworkTypeChanged(const ::webrtc::Network* network);
 
   const Environment env_;
@@ -470,6 +474,8 @@ class RTC_EXPORT Port : public PortInterface, public sigslot::has_slots<> {
   // PortAllocatorSession will provide these username_fragment and password.
   std::string ice_username_fragment_ RTC_GUARDED_BY(thread_);
   std::string password_ RTC_GUARDED_BY(thread_);
+  std::optional<StunMessageIntegrityKey> password_integrity_key_
+      RTC_GUARDED_BY(thread_);
   std::vector<Candidate> candidates_ RTC_GUARDED_BY(thread_);
   AddressMap connections_;
   int timeout_delay_;
@@ -1012,36 +1012,20 @@ void TurnPort::HandleDataIndication(const char* data,
                                     size_t size,
                                     int64_t packet_time_us) {
   // Read in the message, and process according to RFC5766, Section 10.4.
-  ByteBufferReader buf(
-      MakeArrayView(reinterpret_cast<const uint8_t*>(data), size));
-  TurnMessage msg;
-  if (!msg.Read(&buf)) {
+  // The payload is dispatched in place, as this is on the path of every
+  // relayed packet until a channel is bound.
+  SocketAddress ext_addr;
+  ArrayView<const uint8_t> payload;
+  if (!TurnMessage::ParseDataIndication(
+          MakeArrayView(reinterpret_cast<const uint8_t*>(data), size),
+          &ext_addr, &payload)) {
     RTC_LOG(LS_WARNING) << ToString()
                         << ": Received invalid TURN data indication";
     return;
   }
 
-  // Check mandatory attributes.
-  const StunAddressAttribute* addr_attr =
-      msg.GetAddress(STUN_ATTR_XOR_PEER_ADDRESS);
-  if (!addr_attr) {
-    RTC_LOG(LS_WARNING) << ToString()
-                        << ": Missing STUN_ATTR_XOR_PEER_ADDRESS attribute "
-                           "in data indication.";
-    return;
-  }
-
-  const StunByteStringAttribute* data_attr = msg.GetByteString(STUN_ATTR_DATA);
-  if (!data_attr) {
-    RTC_LOG(LS_WARNING) << ToString()
-                        << ": Missing STUN_ATTR_DATA attribute in "
-                           "data indication.";
-    return;
-  }
-
   // Log a warning if the data didn't come from an address that we think we have
   // a permission for.
-  SocketAddress ext_addr(addr_attr->GetAddress());
   if (!HasPermission(ext_addr.ipaddr())) {
     RTC_LOG(LS_WARNING) << ToString()
                         << ": Received TURN data indication with unknown "
@@ -1050,8 +1034,8 @@ void TurnPort::HandleDataIndication(const char* data,
   }
   // TODO(bugs.webrtc.org/14870): rebuild DispatchPacket to take an
   // ArrayView<uint8_t>
-  DispatchPacket(reinterpret_cast<const char*>(data_attr->array_view().data()),
-                 data_attr->length(), ext_addr, PROTO_UDP, packet_time_us);
+  DispatchPacket(reinterpret_cast<const char*>(payload.data()), payload.size(),
+                 ext_addr, PROTO_UDP, packet_time_us);
 }
 
 void TurnPort::HandleChannelData(uint16_t channel_id,
@@ -1786,7 +1770,8 @@ int TurnEntry::Send(const void* data,
                     size_t size,
                     bool payload,
                     const AsyncSocketPacketOptions& options) {
-  ByteBufferWriter buf;
+  ByteBufferWriter& buf = port_->send_buffer_;
+  buf.Clear();
   if (state_ != STATE_BOUND ||
       !port_->TurnCustomizerAllowChannelData(data, size, payload)) {
     // If we haven't bound the channel yet, we have to use a Send Indication.
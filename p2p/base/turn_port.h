@@ -33,6 +33,7 @@
 #include "p2p/base/stun_request.h"
 #include "p2p/client/relay_port_factory_interface.h"
 #include "rtc_base/async_packet_socket.h"
+#include "rtc_base/byte_buffer.h"
 #include "rtc_base/dscp.h"
 #include "rtc_base/ip_address.h"
 #include "rtc_base/logging.h"
@@ -330,6 +331,10 @@ class TurnPort : public Port {
   std::string realm_;  // From 401/438 response message.
   std::string nonce_;  // From 401/438 response message.
   std::string hash_;   // Digest of username:realm:password
+  // Packets sent to peers are framed in this buffer, which is reused, so
+  // that sending doesn't allocate memory once it has grown to the largest
+  // packet size.
+  ByteBufferWriter send_buffer_;
 
   int next_channel_number_;
   std::vector<std::unique_ptr<TurnEntry>> entries_;
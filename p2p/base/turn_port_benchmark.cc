@@ -0,0 +1,204 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "api/candidate.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/transport/stun.h"
+#include "api/turn_customizer.h"
+#include "benchmark/benchmark.h"
+#include "p2p/base/basic_packet_socket_factory.h"
+#include "p2p/base/connection.h"
+#include "p2p/base/p2p_constants.h"
+#include "p2p/base/port.h"
+#include "p2p/base/port_allocator.h"
+#include "p2p/base/port_interface.h"
+#include "p2p/base/turn_port.h"
+#include "p2p/client/relay_port_factory_interface.h"
+#include "p2p/test/test_turn_server.h"
+#include "p2p/test/turn_server.h"
+#include "rtc_base/async_packet_socket.h"
+#include "rtc_base/async_udp_socket.h"
+#include "rtc_base/ip_address.h"
+#include "rtc_base/network.h"
+#include "rtc_base/network/received_packet.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
+#include "rtc_base/virtual_socket_server.h"
+
+namespace webrtc {
+namespace {
+
+const SocketAddress kLocalAddress("11.11.11.11", 0);
+const SocketAddress kPeerAddress("22.22.22.22", 5000);
+const SocketAddress kTurnIntAddress("99.99.99.3", TURN_SERVER_PORT);
+const SocketAddress kTurnExtAddress("99.99.99.5", 0);
+const ProtocolAddress kTurnServerAddress(kTurnIntAddress, PROTO_UDP);
+// The test TURN server accepts passwords that are the same as the username.
+constexpr char kTurnUsername[] = "test";
+constexpr char kIceUfrag[] = "TESTICEUFRAG0001";
+constexpr char kIcePwd[] = "TESTICEPWD00000000000001";
+// Size of an audio packet.
+constexpr size_t kPayloadSize = 160;
+// Packets sent in each direction per iteration.
+constexpr int kBurstSize = 100;
+// The virtual network doesn't lose packets, so this is only hit on errors.
+constexpr int64_t kTimeoutMs = 10000;
+
+// Records when the permission for the peer is created, and when the channel
+// is bound, as ChannelData is only offered to the customizer then.
+class SetupObserver : public TurnCustomizer,
+                      public TurnPort::CallbacksForTest {
+ public:
+  void MaybeModifyOutgoingStunMessage(PortInterface* /* port */,
+                                      StunMessage* /* message */) override {}
+  bool AllowChannelData(PortInterface* /* port */,
+                        const void* /* data */,
+                        size_t /* size */,
+                        bool /* payload */) override {
+    channel_bound_ = true;
+    return true;
+  }
+
+  void OnTurnCreatePermissionResult(int code) override {
+    permission_created_ = code == 0;
+  }
+  void OnTurnRefreshResult(int /* code */) override {}
+  void OnTurnPortClosed() override {}
+
+  bool permission_created() const { return permission_created_; }
+  bool channel_bound() const { return channel_bound_; }
+
+ private:
+  bool permission_created_ = false;
+  bool channel_bound_ = false;
+};
+
+// Relays bursts of packets in both directions between a TurnPort and a peer,
+// through the test TURN server, with Send and Data indications if
+// `state.range(0)` is 0 and with ChannelData otherwise.
+void BM_RelayThroughTurnPort(benchmark::State& state) {
+  const bool use_channel = state.range(0) != 0;
+  VirtualSocketServer socket_server;
+  AutoSocketServerThread thread(&socket_server);
+  TestTurnServer turn_server(&thread, &socket_server, kTurnIntAddress,
+                             kTurnExtAddress);
+  BasicPacketSocketFactory socket_factory(&socket_server);
+  Network network("benchmark", "benchmark", kLocalAddress.ipaddr(), 32);
+  network.AddIP(kLocalAddress.ipaddr());
+  SetupObserver observer;
+
+  RelayServerConfig config;
+  config.credentials = RelayCredentials(kTurnUsername, kTurnUsername);
+  CreateRelayPortArgs args = {.env = CreateEnvironment()};
+  args.network_thread = &thread;
+  args.socket_factory = &socket_factory;
+  args.network = &network;
+  args.username = kIceUfrag;
+  args.password = kIcePwd;
+  args.server_address = &kTurnServerAddress;
+  args.config = &config;
+  args.turn_customizer = &observer;
+  std::unique_ptr<TurnPort> turn_port = TurnPort::Create(args, 0, 0);
+  turn_port->SetCallbacksForTest(&observer);
+
+  std::unique_ptr<AsyncPacketSocket> peer(
+      AsyncUDPSocket::Create(&socket_server, kPeerAddress));
+  int64_t num_peer_packets_received = 0;
+  peer->RegisterReceivedPacketCallback(
+      [&](AsyncPacketSocket* /* socket */,
+          const ReceivedIpPacket& /* packet */) {
+        ++num_peer_packets_received;
+      });
+
+  // Runs the thread until `done` returns true. Pending timers, like the ones
+  // refreshing the allocation, are not waited for.
+  auto process_until = [&](auto done) {
+    const int64_t deadline_ms = TimeAfter(kTimeoutMs);
+    while (!done()) {
+      if (TimeMillis() > deadline_ms) {
+        return false;
+      }
+      thread.ProcessMessages(0);
+    }
+    return true;
+  };
+
+  turn_port->PrepareAddress();
+  if (!process_until([&] { return turn_port->ready(); })) {
+    state.SkipWithError("Failed to allocate");
+    return;
+  }
+  const SocketAddress relayed_address = turn_port->Candidates()[0].address();
+  Candidate peer_candidate(ICE_CANDIDATE_COMPONENT_RTP, "udp", kPeerAddress,
+                           0, "", "", IceCandidateType::kHost, 0, "");
+  Connection* connection =
+      turn_port->CreateConnection(peer_candidate, Port::ORIGIN_MESSAGE);
+  if (!process_until([&] { return observer.permission_created(); })) {
+    state.SkipWithError("Failed to create permission");
+    return;
+  }
+
+  // Looks like RTP, so that it's not parsed as STUN.
+  const std::vector<uint8_t> payload(kPayloadSize, 0x80);
+  int64_t num_packets_sent = 0;
+  int64_t num_packets_received = 0;
+  int64_t num_peer_packets_sent = 0;
+  auto all_relayed = [&] {
+    return num_peer_packets_received == num_packets_sent &&
+           num_packets_received == num_peer_packets_sent;
+  };
+  // Sending with `payload` set requests a channel, which is used once bound.
+  auto send = [&] {
+    turn_port->SendTo(payload.data(), payload.size(), kPeerAddress,
+                      AsyncSocketPacketOptions(), use_channel);
+    ++num_packets_sent;
+  };
+  if (use_channel && !process_until([&] {
+        send();
+        return observer.channel_bound();
+      })) {
+    state.SkipWithError("Failed to bind channel");
+    return;
+  }
+
+  // Registered last, as it must be deregistered before the connection is
+  // destroyed.
+  connection->RegisterReceivedPacketCallback(
+      [&](Connection* /* connection */, const ReceivedIpPacket& /* packet */) {
+        ++num_packets_received;
+      });
+  for (auto _ : state) {
+    for (int i = 0; i < kBurstSize; ++i) {
+      send();
+      peer->SendTo(payload.data(), payload.size(), relayed_address,
+                   AsyncSocketPacketOptions());
+      ++num_peer_packets_sent;
+    }
+    if (!process_until(all_relayed)) {
+      state.SkipWithError("Packets were not relayed");
+      break;
+    }
+  }
+  connection->DeregisterReceivedPacketCallback();
+  state.SetItemsProcessed(2 * state.iterations() * kBurstSize);
+}
+
+// 0 for Send and Data indications, and 1 for ChannelData.
+BENCHMARK(BM_RelayThroughTurnPort)->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace webrtc
@@ -200,6 +200,8 @@ DtlsTransportInternalImpl::DtlsTransportInternalImpl(
       srtp_ciphers_(crypto_options.GetSupportedDtlsSrtpCryptoSuites()),
       ephemeral_key_exchange_cipher_groups_(
           crypto_options.ephemeral_key_exchange_cipher_groups.GetEnabled()),
+      enable_session_resumption_(
+          crypto_options.dtls.enable_session_resumption),
       ssl_max_version_(max_version),
       event_log_(event_log),
       dtls_stun_piggyback_controller_(
@@ -468,6 +470,7 @@ bool DtlsTransportInternalImpl::SetupDtls() {
   dtls_->SetIdentity(local_certificate_->identity()->Clone());
   dtls_->SetMaxProtocolVersion(ssl_max_version_);
   dtls_->SetServerRole(*dtls_role_);
+  dtls_->SetSessionResumptionEnabled(enable_session_resumption_);
   dtls_->SetEventCallback(
       [this](int events, int err) { OnDtlsEvent(events, err); });
   if (remote_fingerprint_value_.size() &&
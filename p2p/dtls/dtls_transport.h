@@ -283,6 +283,9 @@ class DtlsTransportInternalImpl : public DtlsTransportInternal {
   const std::vector<int> srtp_ciphers_;  // SRTP ciphers to use with DTLS.
   // Cipher groups used for DTLS handshake to establish ephemeral key.
   const std::vector<uint16_t> ephemeral_key_exchange_cipher_groups_;
+  // Whether DTLS sessions are resumed by new transports with the same
+  // certificates.
+  const bool enable_session_resumption_;
   bool dtls_active_ = false;
   scoped_refptr<RTCCertificate> local_certificate_;
   std::optional<SSLRole> dtls_role_;
@@ -18,7 +18,6 @@
 #include <tuple>  // for std::tie
 #include <utility>
 
-#include "absl/algorithm/container.h"
 #include "absl/memory/memory.h"
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
@@ -230,18 +229,12 @@ void TurnServer::HandleStunMessage(TurnServerConnection* conn,
     }
   }
 
-  // Look up the key that we'll use to validate the M-I. If we have an
-  // existing allocation, the key will already be cached.
+  // Look up the key that we'll use to validate the M-I, for the username of
+  // the request; only needed for requests.
   TurnServerAllocation* allocation = FindAllocation(conn);
   std::string key;
-  if (!allocation) {
-    GetKey(&msg, &key);
-  } else {
-    key = allocation->key();
-  }
-
-  // Ensure the message is authorized; only needed for requests.
   if (IsStunRequestType(msg.type())) {
+    GetKey(&msg, &key);
     if (!CheckAuthorization(conn, &msg, key)) {
       return;
     }
@@ -316,16 +309,21 @@ bool TurnServer::CheckAuthorization(TurnServerConnection* conn,
     return false;
   }
 
-  // Fail if bad MESSAGE_INTEGRITY.
-  if (key.empty() || msg->ValidateMessageIntegrity(std::string(key)) !=
-                         StunMessage::IntegrityStatus::kIntegrityOk) {
+  // Fail if bad MESSAGE_INTEGRITY. An existing allocation caches the
+  // integrity key of its credential, which is reused while the key of the
+  // request is unchanged.
+  TurnServerAllocation* allocation = FindAllocation(conn);
+  if (key.empty() ||
+      (allocation && key == allocation->key()
+           ? msg->ValidateMessageIntegrity(allocation->integrity_key())
+           : msg->ValidateMessageIntegrity(std::string(key))) !=
+          StunMessage::IntegrityStatus::kIntegrityOk) {
     SendErrorResponseWithRealmAndNonce(conn, msg, STUN_ERROR_UNAUTHORIZED,
                                        STUN_ERROR_REASON_UNAUTHORIZED);
     return false;
   }
 
   // Fail if one-time-use nonce feature is enabled.
-  TurnServerAllocation* allocation = FindAllocation(conn);
   if (enable_otu_nonce_ && allocation &&
       allocation->last_nonce() == nonce_attr->string_view()) {
     SendErrorResponseWithRealmAndNonce(conn, msg, STUN_ERROR_STALE_NONCE,
@@ -503,6 +501,16 @@ void TurnServer::Send(TurnServerConnection* conn, const ByteBufferWriter& buf) {
   conn->socket()->SendTo(buf.Data(), buf.Length(), conn->src(), options);
 }
 
+void TurnServer::SendChannelData(TurnServerConnection* conn,
+                                 uint16_t channel_id,
+                                 ArrayView<const uint8_t> payload) {
+  channel_data_buffer_.Clear();
+  channel_data_buffer_.WriteUInt16(channel_id);
+  channel_data_buffer_.WriteUInt16(static_cast<uint16_t>(payload.size()));
+  channel_data_buffer_.Write(payload);
+  Send(conn, channel_data_buffer_);
+}
+
 void TurnServer::DestroyAllocation(TurnServerAllocation* allocation) {
   // Removing the internal socket if the connection is not udp.
   AsyncPacketSocket* socket = allocation->conn()->socket();
@@ -567,7 +575,8 @@ TurnServerAllocation::TurnServerAllocation(TurnServer* server,
       thread_(thread),
       conn_(conn),
       external_socket_(socket),
-      key_(key) {
+      key_(key),
+      integrity_key_(key) {
   external_socket_->RegisterReceivedPacketCallback(
       [&](AsyncPacketSocket* socket, const ReceivedIpPacket& packet) {
         RTC_DCHECK_RUN_ON(thread_);
@@ -576,6 +585,7 @@ TurnServerAllocation::TurnServerAllocation(TurnServer* server,
 }
 
 TurnServerAllocation::~TurnServerAllocation() {
+  channel_ids_.clear();
   channels_.clear();
   perms_.clear();
   RTC_LOG(LS_INFO) << ToString() << ": Allocation destroyed";
@@ -747,23 +757,25 @@ void TurnServerAllocation::HandleChannelBindRequest(const TurnMessage* msg) {
 
   // Check that this channel id isn't bound to another transport address, and
   // that this transport address isn't bound to another channel id.
-  auto channel1 = FindChannel(channel_id);
-  auto channel2 = FindChannel(peer_attr->GetAddress());
-  if (channel1 != channel2) {
+  auto channel = channels_.find(channel_id);
+  auto peer_channel_id = channel_ids_.find(peer_attr->GetAddress());
+  if ((channel == channels_.end()) != (peer_channel_id == channel_ids_.end()) ||
+      (peer_channel_id != channel_ids_.end() &&
+       peer_channel_id->second != channel_id)) {
     SendBadRequestResponse(msg);
     return;
   }
 
   // Add or refresh this channel.
-  if (channel1 == channels_.end()) {
-    channel1 = channels_.insert(
-        channels_.end(), {.id = channel_id, .peer = peer_attr->GetAddress()});
+  if (channel == channels_.end()) {
+    channel = channels_.try_emplace(channel_id, peer_attr->GetAddress()).first;
+    channel_ids_.emplace(peer_attr->GetAddress(), channel_id);
   } else {
-    channel1->pending_delete.reset();
+    channel->second.pending_delete.reset();
   }
   thread_->PostDelayedTask(
-      SafeTask(channel1->pending_delete.flag(),
-               [this, channel1] { channels_.erase(channel1); }),
+      SafeTask(channel->second.pending_delete.flag(),
+               [this, channel_id] { RemoveChannel(channel_id); }),
       kChannelTimeout);
 
   // Channel binds also refresh permissions.
@@ -781,11 +793,12 @@ void TurnServerAllocation::HandleChannelBindRequest(const TurnMessage* msg) {
 void TurnServerAllocation::HandleChannelData(ArrayView<const uint8_t> payload) {
   // Extract the channel number from the data.
   uint16_t channel_id = GetBE16(payload.data());
-  auto channel = FindChannel(channel_id);
+  auto channel = channels_.find(channel_id);
   if (channel != channels_.end()) {
     // Send the data to the peer address.
     SendExternal(payload.data() + TURN_CHANNEL_HEADER_SIZE,
-                 payload.size() - TURN_CHANNEL_HEADER_SIZE, channel->peer);
+                 payload.size() - TURN_CHANNEL_HEADER_SIZE,
+                 channel->second.peer);
   } else {
     RTC_LOG(LS_WARNING) << ToString()
                         << ": Received channel data for invalid channel, id="
@@ -796,14 +809,11 @@ void TurnServerAllocation::HandleChannelData(ArrayView<const uint8_t> payload) {
 void TurnServerAllocation::OnExternalPacket(AsyncPacketSocket* socket,
                                             const ReceivedIpPacket& packet) {
   RTC_DCHECK(external_socket_.get() == socket);
-  auto channel = FindChannel(packet.source_address());
-  if (channel != channels_.end()) {
+  RTC_DCHECK_RUN_ON(server_->thread_);
+  auto channel_id = channel_ids_.find(packet.source_address());
+  if (channel_id != channel_ids_.end()) {
     // There is a channel bound to this address. Send as a channel message.
-    ByteBufferWriter buf;
-    buf.WriteUInt16(channel->id);
-    buf.WriteUInt16(static_cast<uint16_t>(packet.payload().size()));
-    buf.Write(ArrayView<const uint8_t>(packet.payload()));
-    server_->Send(&conn_, buf);
+    server_->SendChannelData(&conn_, channel_id->second, packet.payload());
   } else if (!server_->enable_permission_checks_ ||
              HasPermission(packet.source_address().ipaddr())) {
     // No channel, but a permission exists. Send as a data indication.
@@ -829,37 +839,24 @@ TimeDelta TurnServerAllocation::ComputeLifetime(const TurnMessage& msg) {
 }
 
 bool TurnServerAllocation::HasPermission(const IPAddress& addr) {
-  return FindPermission(addr) != perms_.end();
+  return perms_.contains(addr);
 }
 
 void TurnServerAllocation::AddPermission(const IPAddress& addr) {
-  auto perm = FindPermission(addr);
-  if (perm == perms_.end()) {
-    perm = perms_.insert(perms_.end(), {.peer = addr});
-  } else {
-    perm->pending_delete.reset();
+  auto [perm, inserted] = perms_.try_emplace(addr);
+  if (!inserted) {
+    perm->second.pending_delete.reset();
   }
-  thread_->PostDelayedTask(SafeTask(perm->pending_delete.flag(),
-                                    [this, perm] { perms_.erase(perm); }),
+  thread_->PostDelayedTask(SafeTask(perm->second.pending_delete.flag(),
+                                    [this, addr] { perms_.erase(addr); }),
                            kPermissionTimeout);
 }
 
-TurnServerAllocation::PermissionList::iterator
-TurnServerAllocation::FindPermission(const IPAddress& addr) {
-  return absl::c_find_if(perms_,
-                         [&](const Permission& p) { return p.peer == addr; });
-}
-
-TurnServerAllocation::ChannelList::iterator TurnServerAllocation::FindChannel(
-    int channel_id) {
-  return absl::c_find_if(channels_,
-                         [&](const Channel& c) { return c.id == channel_id; });
-}
-
-TurnServerAllocation::ChannelList::iterator TurnServerAllocation::FindChannel(
-    const SocketAddress& addr) {
-  return absl::c_find_if(channels_,
-                         [&](const Channel& c) { return c.peer == addr; });
+void TurnServerAllocation::RemoveChannel(uint16_t channel_id) {
+  auto channel = channels_.find(channel_id);
+  RTC_DCHECK(channel != channels_.end());
+  channel_ids_.erase(channel->second.peer);
+  channels_.erase(channel);
 }
 
 void TurnServerAllocation::SendResponse(TurnMessage* msg) {
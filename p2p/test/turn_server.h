@@ -13,12 +13,14 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <list>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/node_hash_map.h"
+#include "absl/hash/hash.h"
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
 #include "api/packet_socket_factory.h"
@@ -61,6 +63,11 @@ class TurnServerConnection {
   bool operator<(const TurnServerConnection& t) const;
   std::string ToString() const;
 
+  template <typename H>
+  friend H AbslHashValue(H h, const TurnServerConnection& c) {
+    return H::combine(std::move(h), c.src_.Hash(), c.dst_.Hash(), c.proto_);
+  }
+
  private:
   SocketAddress src_;
   SocketAddress dst_;
@@ -84,6 +91,9 @@ class TurnServerAllocation final {
 
   TurnServerConnection* conn() { return &conn_; }
   const std::string& key() const { return key_; }
+  // Caches the HMAC key schedule of `key()`, to validate the
+  // MESSAGE-INTEGRITY of requests for this allocation.
+  StunMessageIntegrityKey& integrity_key() { return integrity_key_; }
   const std::string& transaction_id() const { return transaction_id_; }
   const std::string& username() const { return username_; }
   const std::string& last_nonce() const { return last_nonce_; }
@@ -98,16 +108,28 @@ class TurnServerAllocation final {
 
  private:
   struct Channel {
+    explicit Channel(const SocketAddress& peer) : peer(peer) {}
+
     ScopedTaskSafety pending_delete;
-    const uint16_t id;
     const SocketAddress peer;
   };
   struct Permission {
     ScopedTaskSafety pending_delete;
-    IPAddress peer;
   };
-  using PermissionList = std::list<Permission>;
-  using ChannelList = std::list<Channel>;
+  struct IPAddressHash {
+    size_t operator()(const IPAddress& addr) const {
+      return absl::HashOf(HashIP(addr));
+    }
+  };
+  struct SocketAddressHash {
+    size_t operator()(const SocketAddress& addr) const {
+      return absl::HashOf(addr.Hash());
+    }
+  };
+  // Node based, as the pending delete tasks of the entries must not move.
+  using PermissionMap =
+      absl::node_hash_map<IPAddress, Permission, IPAddressHash>;
+  using ChannelMap = absl::node_hash_map<uint16_t, Channel>;
 
   void PostDeleteSelf(TimeDelta delay);
 
@@ -123,9 +145,7 @@ class TurnServerAllocation final {
   static TimeDelta ComputeLifetime(const TurnMessage& msg);
   bool HasPermission(const IPAddress& addr);
   void AddPermission(const IPAddress& addr);
-  PermissionList::iterator FindPermission(const IPAddress& addr);
-  ChannelList::iterator FindChannel(int channel_id);
-  ChannelList::iterator FindChannel(const SocketAddress& addr);
+  void RemoveChannel(uint16_t channel_id);
 
   void SendResponse(TurnMessage* msg);
   void SendBadRequestResponse(const TurnMessage* req);
@@ -139,11 +159,14 @@ class TurnServerAllocation final {
   TurnServerConnection conn_;
   std::unique_ptr<AsyncPacketSocket> external_socket_;
   std::string key_;
+  StunMessageIntegrityKey integrity_key_;
   std::string transaction_id_;
   std::string username_;
   std::string last_nonce_;
-  PermissionList perms_;
-  ChannelList channels_;
+  PermissionMap perms_;
+  ChannelMap channels_;
+  // Maps the peer address of each channel in `channels_` to its id.
+  absl::flat_hash_map<SocketAddress, uint16_t, SocketAddressHash> channel_ids_;
   ScopedTaskSafety safety_;
 };
 
@@ -180,7 +203,8 @@ class StunMessageObserver {
 // Not yet wired up: TCP support.
 class TurnServer : public sigslot::has_slots<> {
  public:
-  typedef std::map<TurnServerConnection, std::unique_ptr<TurnServerAllocation>>
+  typedef absl::flat_hash_map<TurnServerConnection,
+                              std::unique_ptr<TurnServerAllocation>>
       AllocationMap;
 
   explicit TurnServer(TaskQueueBase* thread);
@@ -321,6 +345,10 @@ class TurnServer : public sigslot::has_slots<> {
 
   void SendStun(TurnServerConnection* conn, StunMessage* msg);
   void Send(TurnServerConnection* conn, const ByteBufferWriter& buf);
+  // Sends `payload` to `conn` as ChannelData of `channel_id`.
+  void SendChannelData(TurnServerConnection* conn,
+                       uint16_t channel_id,
+                       ArrayView<const uint8_t> payload) RTC_RUN_ON(thread_);
 
   void DestroyAllocation(TurnServerAllocation* allocation) RTC_RUN_ON(thread_);
   void DestroyInternalSocket(AsyncPacketSocket* socket) RTC_RUN_ON(thread_);
@@ -354,6 +382,9 @@ class TurnServer : public sigslot::has_slots<> {
   SocketAddress external_addr_ RTC_GUARDED_BY(thread_);
 
   AllocationMap allocations_ RTC_GUARDED_BY(thread_);
+  // Reused for every ChannelData message relayed to a client, to not allocate
+  // memory per packet.
+  ByteBufferWriter channel_data_buffer_ RTC_GUARDED_BY(thread_);
 
   // For testing only. If this is non-zero, the next NONCE will be generated
   // from this value, and it will be reset to 0 after generating the NONCE.
@@ -0,0 +1,266 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+#include "api/async_dns_resolver.h"
+#include "api/packet_socket_factory.h"
+#include "api/transport/stun.h"
+#include "benchmark/benchmark.h"
+#include "p2p/base/port_interface.h"
+#include "p2p/test/turn_server.h"
+#include "rtc_base/async_packet_socket.h"
+#include "rtc_base/byte_buffer.h"
+#include "rtc_base/ip_address.h"
+#include "rtc_base/network/received_packet.h"
+#include "rtc_base/socket.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+namespace {
+
+constexpr char kRealm[] = "example.org";
+// Size of an audio packet.
+constexpr size_t kPayloadSize = 160;
+// Number of ports used per IP address, for clients and relayed addresses.
+constexpr int kPortsPerAddress = 50000;
+
+const SocketAddress kServerAddress("99.99.99.1", TURN_SERVER_PORT);
+const SocketAddress kServerExternalAddress("99.99.99.2", 0);
+
+// A UDP socket that packets are injected into, and that only keeps the last
+// packet sent, so that the TurnServer is measured rather than a network.
+class FakeUdpSocket : public AsyncPacketSocket {
+ public:
+  explicit FakeUdpSocket(const SocketAddress& local_address)
+      : local_address_(local_address) {}
+
+  void ReceivePacket(ArrayView<const uint8_t> payload,
+                     const SocketAddress& source_address) {
+    NotifyPacketReceived(ReceivedIpPacket(payload, source_address));
+  }
+
+  ArrayView<const uint8_t> last_packet_sent() const {
+    return last_packet_sent_;
+  }
+  int64_t num_packets_sent() const { return num_packets_sent_; }
+
+  SocketAddress GetLocalAddress() const override { return local_address_; }
+  SocketAddress GetRemoteAddress() const override { return SocketAddress(); }
+  int Send(const void* /* pv */,
+           size_t /* cb */,
+           const AsyncSocketPacketOptions& /* options */) override {
+    return -1;
+  }
+  int SendTo(const void* pv,
+             size_t cb,
+             const SocketAddress& /* addr */,
+             const AsyncSocketPacketOptions& /* options */) override {
+    const uint8_t* data = static_cast<const uint8_t*>(pv);
+    last_packet_sent_.assign(data, data + cb);
+    ++num_packets_sent_;
+    return static_cast<int>(cb);
+  }
+  int Close() override { return 0; }
+  State GetState() const override { return STATE_BOUND; }
+  int GetOption(Socket::Option /* opt */, int* /* value */) override {
+    return -1;
+  }
+  int SetOption(Socket::Option /* opt */, int /* value */) override {
+    return 0;
+  }
+  int GetError() const override { return 0; }
+  void SetError(int /* error */) override {}
+
+ private:
+  const SocketAddress local_address_;
+  std::vector<uint8_t> last_packet_sent_;
+  int64_t num_packets_sent_ = 0;
+};
+
+SocketAddress GetAddress(uint32_t base_ip, int index) {
+  return SocketAddress(IPAddress(base_ip + index / kPortsPerAddress),
+                       10000 + index % kPortsPerAddress);
+}
+
+// Creates the sockets of the relayed addresses, in allocation order.
+class FakeSocketFactory : public PacketSocketFactory {
+ public:
+  explicit FakeSocketFactory(std::vector<FakeUdpSocket*>* sockets)
+      : sockets_(sockets) {}
+
+  AsyncPacketSocket* CreateUdpSocket(const SocketAddress& address,
+                                     uint16_t /* min_port */,
+                                     uint16_t /* max_port */) override {
+    FakeUdpSocket* socket = new FakeUdpSocket(
+        GetAddress(address.ipaddr().v4AddressAsHostOrderInteger(),
+                   static_cast<int>(sockets_->size())));
+    sockets_->push_back(socket);
+    return socket;
+  }
+  AsyncListenSocket* CreateServerTcpSocket(
+      const SocketAddress& /* local_address */,
+      uint16_t /* min_port */,
+      uint16_t /* max_port */,
+      int /* opts */) override {
+    return nullptr;
+  }
+  AsyncPacketSocket* CreateClientTcpSocket(
+      const SocketAddress& /* local_address */,
+      const SocketAddress& /* remote_address */,
+      const PacketSocketTcpOptions& /* tcp_options */) override {
+    return nullptr;
+  }
+  std::unique_ptr<AsyncDnsResolverInterface> CreateAsyncDnsResolver()
+      override {
+    return nullptr;
+  }
+
+ private:
+  std::vector<FakeUdpSocket*>* const sockets_;
+};
+
+// Accepts every username with the username as password.
+class TestAuth : public TurnAuthInterface {
+ public:
+  bool GetKey(absl::string_view username,
+              absl::string_view realm,
+              std::string* key) override {
+    return ComputeStunCredentialHash(std::string(username), std::string(realm),
+                                     std::string(username), key);
+  }
+};
+
+SocketAddress GetClientAddress(int index) {
+  return GetAddress(0x0b000000, index);
+}
+
+SocketAddress GetPeerAddress(int index) {
+  return SocketAddress(IPAddress(0x16000000 + index), 5000);
+}
+
+// Sends an authenticated request from the client with `username` to the
+// server, and returns true if the server responded with success.
+bool SendRequest(FakeUdpSocket& server_socket,
+                 const SocketAddress& client_address,
+                 absl::string_view username,
+                 absl::string_view nonce,
+                 TurnMessage& request) {
+  std::string key;
+  ComputeStunCredentialHash(std::string(username), kRealm,
+                            std::string(username), &key);
+  request.AddAttribute(
+      std::make_unique<StunByteStringAttribute>(STUN_ATTR_USERNAME, username));
+  request.AddAttribute(
+      std::make_unique<StunByteStringAttribute>(STUN_ATTR_REALM, kRealm));
+  request.AddAttribute(
+      std::make_unique<StunByteStringAttribute>(STUN_ATTR_NONCE, nonce));
+  request.AddMessageIntegrity(key);
+  ByteBufferWriter request_buf;
+  request.Write(&request_buf);
+  server_socket.ReceivePacket(request_buf.DataView(), client_address);
+
+  TurnMessage response;
+  ByteBufferReader response_buf(server_socket.last_packet_sent());
+  return response.Read(&response_buf) &&
+         IsStunSuccessResponseType(response.type());
+}
+
+// Relays one packet in each direction per iteration, for each of the
+// `state.range(1)` peers of each of `state.range(0)` allocations: ChannelData
+// from the client to the peer, and a packet from the peer to the relayed
+// address, which is sent to the client as ChannelData.
+void BM_RelayChannelData(benchmark::State& state) {
+  const int num_allocations = state.range(0);
+  const int num_peers = state.range(1);
+  AutoThread thread;
+  TestAuth auth;
+  std::vector<FakeUdpSocket*> external_sockets;
+  TurnServer server(&thread);
+  server.set_realm(kRealm);
+  server.set_auth_hook(&auth);
+  FakeUdpSocket* server_socket = new FakeUdpSocket(kServerAddress);
+  server.AddInternalSocket(server_socket, PROTO_UDP);
+  server.SetExternalSocketFactory(new FakeSocketFactory(&external_sockets),
+                                  kServerExternalAddress);
+
+  // The nonce is valid for all clients, as one-time-use nonces are disabled.
+  const std::string nonce = server.SetTimestampForNextNonce(TimeMillis());
+  for (int i = 0; i < num_allocations; ++i) {
+    const std::string username = "user" + std::to_string(i);
+    TurnMessage allocate_request(STUN_ALLOCATE_REQUEST);
+    allocate_request.AddAttribute(std::make_unique<StunUInt32Attribute>(
+        STUN_ATTR_REQUESTED_TRANSPORT, IPPROTO_UDP << 24));
+    bool success = SendRequest(*server_socket, GetClientAddress(i), username,
+                               nonce, allocate_request);
+    for (int j = 0; success && j < num_peers; ++j) {
+      TurnMessage bind_request(TURN_CHANNEL_BIND_REQUEST);
+      bind_request.AddAttribute(std::make_unique<StunUInt32Attribute>(
+          STUN_ATTR_CHANNEL_NUMBER, (kMinTurnChannelNumber + j) << 16));
+      bind_request.AddAttribute(std::make_unique<StunXorAddressAttribute>(
+          STUN_ATTR_XOR_PEER_ADDRESS, GetPeerAddress(j)));
+      success = SendRequest(*server_socket, GetClientAddress(i), username,
+                            nonce, bind_request);
+    }
+    if (!success) {
+      state.SkipWithError("Failed to set up allocation");
+      return;
+    }
+  }
+
+  const std::vector<uint8_t> payload(kPayloadSize);
+  std::vector<std::vector<uint8_t>> channel_data;
+  for (int j = 0; j < num_peers; ++j) {
+    ByteBufferWriter buf;
+    buf.WriteUInt16(kMinTurnChannelNumber + j);
+    buf.WriteUInt16(kPayloadSize);
+    buf.Write(ArrayView<const uint8_t>(payload));
+    channel_data.emplace_back(buf.Data(), buf.Data() + buf.Length());
+  }
+
+  const int64_t num_responses = server_socket->num_packets_sent();
+  for (auto _ : state) {
+    for (int i = 0; i < num_allocations; ++i) {
+      const SocketAddress client_address = GetClientAddress(i);
+      for (int j = 0; j < num_peers; ++j) {
+        server_socket->ReceivePacket(channel_data[j], client_address);
+        external_sockets[i]->ReceivePacket(payload, GetPeerAddress(j));
+      }
+    }
+  }
+
+  int64_t num_packets_relayed =
+      server_socket->num_packets_sent() - num_responses;
+  for (const FakeUdpSocket* socket : external_sockets) {
+    num_packets_relayed += socket->num_packets_sent();
+  }
+  if (num_packets_relayed != 2 * state.iterations() * num_allocations *
+                                 num_peers) {
+    state.SkipWithError("Packets were not relayed");
+  }
+  state.SetItemsProcessed(num_packets_relayed);
+}
+
+// Number of allocations and number of peers, with a channel each, per
+// allocation.
+BENCHMARK(BM_RelayChannelData)
+    ->ArgsProduct({{100, 1000, 10000}, {1, 16}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace webrtc
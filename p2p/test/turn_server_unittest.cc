@@ -11,16 +11,24 @@
 #include "p2p/test/turn_server.h"
 
 #include <memory>
+#include <string>
+#include <utility>
 
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
+#include "api/transport/stun.h"
 #include "p2p/base/basic_packet_socket_factory.h"
 #include "p2p/base/port_interface.h"
 #include "rtc_base/async_packet_socket.h"
+#include "rtc_base/byte_buffer.h"
+#include "rtc_base/network/received_packet.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
 #include "rtc_base/virtual_socket_server.h"
 #include "test/gtest.h"
 
-// NOTE: This is a work in progress. Currently this file only has tests for
+// NOTE: This is a work in progress. Currently this file mostly has tests for
 // TurnServerConnection, a primitive class used by TurnServer.
 
 namespace webrtc {
@@ -32,6 +40,7 @@ class TurnServerConnectionTest : public ::testing::Test {
   void ExpectEqual(const TurnServerConnection& a,
                    const TurnServerConnection& b) {
     EXPECT_TRUE(a == b);
+    EXPECT_EQ(absl::HashOf(a), absl::HashOf(b));
     EXPECT_FALSE(a < b);
     EXPECT_FALSE(b < a);
   }
@@ -68,4 +77,104 @@ TEST_F(TurnServerConnectionTest, ComparisonOperators) {
   ExpectNotEqual(connection1, connection4);
 }
 
+namespace {
+
+constexpr char kRealm[] = "example.org";
+const SocketAddress kServerAddress("99.99.99.1", TURN_SERVER_PORT);
+const SocketAddress kServerExternalAddress("99.99.99.2", 0);
+const SocketAddress kClientAddress("11.11.11.11", 10000);
+
+// Accepts every username with the username as password.
+class TestAuth : public TurnAuthInterface {
+ public:
+  bool GetKey(absl::string_view username,
+              absl::string_view realm,
+              std::string* key) override {
+    return ComputeStunCredentialHash(std::string(username), std::string(realm),
+                                     std::string(username), key);
+  }
+};
+
+}  // namespace
+
+class TurnServerTest : public ::testing::Test {
+ public:
+  TurnServerTest()
+      : thread_(&vss_), socket_factory_(&vss_), server_(&thread_) {
+    server_.set_realm(kRealm);
+    server_.set_auth_hook(&auth_);
+    server_.AddInternalSocket(
+        socket_factory_.CreateUdpSocket(kServerAddress, 0, 0), PROTO_UDP);
+    server_.SetExternalSocketFactory(new BasicPacketSocketFactory(&vss_),
+                                     kServerExternalAddress);
+    client_socket_.reset(
+        socket_factory_.CreateUdpSocket(kClientAddress, 0, 0));
+    client_socket_->RegisterReceivedPacketCallback(
+        [&](AsyncPacketSocket* /* socket */, const ReceivedIpPacket& packet) {
+          response_ = std::make_unique<TurnMessage>();
+          ByteBufferReader buf(packet.payload());
+          EXPECT_TRUE(response_->Read(&buf));
+        });
+    nonce_ = server_.SetTimestampForNextNonce(TimeMillis());
+  }
+
+  // Sends `request` signed with the credentials of `username`, and returns
+  // the response of the server.
+  std::unique_ptr<TurnMessage> SendRequest(absl::string_view username,
+                                         TurnMessage& request) {
+    std::string key;
+    ComputeStunCredentialHash(std::string(username), kRealm,
+                              std::string(username), &key);
+    request.AddAttribute(std::make_unique<StunByteStringAttribute>(
+        STUN_ATTR_USERNAME, username));
+    request.AddAttribute(
+        std::make_unique<StunByteStringAttribute>(STUN_ATTR_REALM, kRealm));
+    request.AddAttribute(
+        std::make_unique<StunByteStringAttribute>(STUN_ATTR_NONCE, nonce_));
+    request.AddMessageIntegrity(key);
+    ByteBufferWriter buf;
+    request.Write(&buf);
+    response_.reset();
+    client_socket_->SendTo(buf.Data(), buf.Length(), kServerAddress,
+                           AsyncSocketPacketOptions());
+    for (int i = 0; i < 10 && !response_; ++i) {
+      thread_.ProcessMessages(0);
+    }
+    return std::move(response_);
+  }
+
+ protected:
+  VirtualSocketServer vss_;
+  AutoSocketServerThread thread_;
+  BasicPacketSocketFactory socket_factory_;
+  TestAuth auth_;
+  TurnServer server_;
+  std::unique_ptr<AsyncPacketSocket> client_socket_;
+  std::string nonce_;
+  std::unique_ptr<TurnMessage> response_;
+};
+
+TEST_F(TurnServerTest, RequestWithCredentialsOfAnotherUserIsRejected) {
+  TurnMessage allocate_request(STUN_ALLOCATE_REQUEST);
+  allocate_request.AddAttribute(std::make_unique<StunUInt32Attribute>(
+      STUN_ATTR_REQUESTED_TRANSPORT, IPPROTO_UDP << 24));
+  std::unique_ptr<TurnMessage> response =
+      SendRequest("alice", allocate_request);
+  ASSERT_TRUE(response);
+  EXPECT_EQ(response->type(), STUN_ALLOCATE_RESPONSE);
+
+  // The request has valid credentials, but not those of the allocation.
+  TurnMessage refresh_request(TURN_REFRESH_REQUEST);
+  response = SendRequest("bob", refresh_request);
+  ASSERT_TRUE(response);
+  EXPECT_EQ(response->type(), TURN_REFRESH_ERROR_RESPONSE);
+  ASSERT_TRUE(response->GetErrorCode());
+  EXPECT_EQ(response->GetErrorCode()->code(), STUN_ERROR_WRONG_CREDENTIALS);
+
+  TurnMessage other_refresh_request(TURN_REFRESH_REQUEST);
+  response = SendRequest("alice", other_refresh_request);
+  ASSERT_TRUE(response);
+  EXPECT_EQ(response->type(), TURN_REFRESH_RESPONSE);
+}
+
 }  // namespace webrtc
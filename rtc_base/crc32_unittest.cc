@@ -36,4 +36,20 @@ TEST(Crc32Test, TestMultipleUpdates) {
   EXPECT_EQ(0x171A3F5FU, c);
 }
 
+TEST(Crc32Test, TestUnalignedBuffersOfAllLengths) {
+  std::string input;
+  for (int i = 0; i < 100; ++i) {
+    input.push_back(static_cast<char>(i * 37));
+  }
+  for (size_t offset = 0; offset < 8; ++offset) {
+    for (size_t len = 0; offset + len <= input.size(); ++len) {
+      uint32_t expected = 0;
+      for (size_t i = offset; i < offset + len; ++i) {
+        expected = UpdateCrc32(expected, &input[i], 1);
+      }
+      EXPECT_EQ(expected, ComputeCrc32(input.data() + offset, len));
+    }
+  }
+}
+
 }  // namespace webrtc
@@ -13,6 +13,7 @@
 
 #include <stddef.h>
 
+#include <memory>
 #include <string>
 
 #include "absl/strings/string_view.h"
@@ -47,6 +48,31 @@ class MessageDigestFactory {
   static MessageDigest* Create(absl::string_view alg);
 };
 
+// A general class for computing RFC 2104 HMACs with a fixed key. The key
+// schedule, i.e. the hash state after hashing the padded key, is computed once,
+// which makes this cheaper than ComputeHmac when many inputs are authenticated
+// with the same key.
+class Hmac {
+ public:
+  virtual ~Hmac() {}
+  // Returns the HMAC output size (e.g. 20 bytes for SHA-1).
+  virtual size_t Size() const = 0;
+  // Updates the HMAC with `len` bytes from `buf`.
+  virtual void Update(const void* buf, size_t len) = 0;
+  // Outputs the HMAC value to `buf` with length `len`, and prepares for
+  // authenticating a new input with the same key. Returns the number of bytes
+  // written, i.e., Size(), or 0 if `len` was too small.
+  virtual size_t Finish(void* buf, size_t len) = 0;
+};
+
+// A factory class for creating HMAC objects.
+class HmacFactory {
+ public:
+  // Returns nullptr if there is no digest with the given name `alg`.
+  static std::unique_ptr<Hmac> Create(absl::string_view alg,
+                                      absl::string_view key);
+};
+
 // A check that an algorithm is in a list of approved digest algorithms
 // from RFC 4572 (FIPS 180).
 bool IsFips180DigestAlgorithm(absl::string_view alg);
@@ -142,6 +168,8 @@ using ::webrtc::DIGEST_SHA_224;
 using ::webrtc::DIGEST_SHA_256;
 using ::webrtc::DIGEST_SHA_384;
 using ::webrtc::DIGEST_SHA_512;
+using ::webrtc::Hmac;
+using ::webrtc::HmacFactory;
 using ::webrtc::IsFips180DigestAlgorithm;
 using ::webrtc::MD5;
 using ::webrtc::MessageDigest;
@@ -14,6 +14,7 @@
 #include <openssl/sha.h>
 
 #include <cstddef>
+#include <memory>
 #include <string>
 
 #include "absl/strings/string_view.h"
@@ -201,4 +202,44 @@ TEST(MessageDigestTest, TestBadHmac) {
   EXPECT_EQ("", ComputeHmac("sha-9000", "key", "abc"));
 }
 
+// Test vectors from RFC 2202, computed repeatedly with the same key.
+TEST(MessageDigestTest, TestSha1HmacWithFixedKey) {
+  std::unique_ptr<Hmac> hmac =
+      HmacFactory::Create(DIGEST_SHA_1, std::string(80, '\xaa'));
+  ASSERT_TRUE(hmac);
+  EXPECT_EQ(static_cast<size_t>(SHA_DIGEST_LENGTH), hmac->Size());
+
+  char output[EVP_MAX_MD_SIZE];
+  for (int i = 0; i < 2; ++i) {
+    std::string input("Test Using Larger Than Block-Size Key - Hash Key First");
+    hmac->Update(input.data(), input.size());
+    EXPECT_EQ(static_cast<size_t>(SHA_DIGEST_LENGTH),
+              hmac->Finish(output, SHA_DIGEST_LENGTH));
+    EXPECT_EQ("aa4ae5e15272d00e95705637ce8a3b55ed402112",
+              hex_encode(absl::string_view(output, SHA_DIGEST_LENGTH)));
+
+    // Split in two updates.
+    hmac->Update("Test Using Larger Than Block-Size Key and Larger ", 49);
+    hmac->Update("Than One Block-Size Data", 24);
+    EXPECT_EQ(static_cast<size_t>(SHA_DIGEST_LENGTH),
+              hmac->Finish(output, SHA_DIGEST_LENGTH));
+    EXPECT_EQ("e8e99d0f45237d786d6bbaa7965c7808bbff1a91",
+              hex_encode(absl::string_view(output, SHA_DIGEST_LENGTH)));
+  }
+
+  hmac = HmacFactory::Create(DIGEST_SHA_1, "Jefe");
+  ASSERT_TRUE(hmac);
+  std::string input("what do ya want for nothing?");
+  hmac->Update(input.data(), input.size());
+  EXPECT_EQ(0U, hmac->Finish(output, SHA_DIGEST_LENGTH - 1));
+  EXPECT_EQ(static_cast<size_t>(SHA_DIGEST_LENGTH),
+            hmac->Finish(output, SHA_DIGEST_LENGTH));
+  EXPECT_EQ("effcdf6ae5eb2fa2d27416d5f184df9c259a7c79",
+            hex_encode(absl::string_view(output, SHA_DIGEST_LENGTH)));
+}
+
+TEST(MessageDigestTest, TestBadHmacWithFixedKey) {
+  EXPECT_EQ(nullptr, HmacFactory::Create("sha-9000", "key"));
+}
+
 }  // namespace webrtc
@@ -11,6 +11,8 @@
 #include "rtc_base/openssl_digest.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <string>
 
 #include "absl/strings/string_view.h"
@@ -19,6 +21,10 @@
 #include "rtc_base/openssl.h"
 
 namespace webrtc {
+namespace {
+// The largest block size of the supported algorithms (SHA-384 and SHA-512).
+constexpr size_t kMaxBlockSize = 128;
+}  // namespace
 
 OpenSSLDigest::OpenSSLDigest(absl::string_view algorithm) {
   ctx_ = EVP_MD_CTX_new();
@@ -119,4 +125,81 @@ bool OpenSSLDigest::GetDigestSize(absl::string_view algorithm, size_t* length) {
   return true;
 }
 
+OpenSSLHmac::OpenSSLHmac(absl::string_view algorithm, absl::string_view key) {
+  if (!OpenSSLDigest::GetDigestEVP(algorithm, &md_)) {
+    md_ = nullptr;
+    return;
+  }
+  ctx_ = EVP_MD_CTX_new();
+  inner_ctx_ = EVP_MD_CTX_new();
+  outer_ctx_ = EVP_MD_CTX_new();
+  RTC_CHECK(ctx_ != nullptr && inner_ctx_ != nullptr && outer_ctx_ != nullptr);
+
+  // Copy the key to a block-sized buffer to simplify padding.
+  // If the key is longer than a block, hash it and use the result instead.
+  size_t block_size = EVP_MD_block_size(md_);
+  uint8_t padded_key[kMaxBlockSize] = {};
+  RTC_DCHECK_LE(block_size, sizeof(padded_key));
+  if (key.size() > block_size) {
+    unsigned int key_len;
+    EVP_DigestInit_ex(ctx_, md_, nullptr);
+    EVP_DigestUpdate(ctx_, key.data(), key.size());
+    EVP_DigestFinal_ex(ctx_, padded_key, &key_len);
+  } else {
+    memcpy(padded_key, key.data(), key.size());
+  }
+
+  // The inner hash starts with the key XOR ipad, and the outer hash with the
+  // key XOR opad.
+  uint8_t pad[kMaxBlockSize];
+  for (size_t i = 0; i < block_size; ++i) {
+    pad[i] = 0x36 ^ padded_key[i];
+  }
+  EVP_DigestInit_ex(inner_ctx_, md_, nullptr);
+  EVP_DigestUpdate(inner_ctx_, pad, block_size);
+  for (size_t i = 0; i < block_size; ++i) {
+    pad[i] = 0x5c ^ padded_key[i];
+  }
+  EVP_DigestInit_ex(outer_ctx_, md_, nullptr);
+  EVP_DigestUpdate(outer_ctx_, pad, block_size);
+
+  EVP_MD_CTX_copy_ex(ctx_, inner_ctx_);
+}
+
+OpenSSLHmac::~OpenSSLHmac() {
+  EVP_MD_CTX_free(ctx_);
+  EVP_MD_CTX_free(inner_ctx_);
+  EVP_MD_CTX_free(outer_ctx_);
+}
+
+size_t OpenSSLHmac::Size() const {
+  if (!md_) {
+    return 0;
+  }
+  return EVP_MD_size(md_);
+}
+
+void OpenSSLHmac::Update(const void* buf, size_t len) {
+  if (!md_) {
+    return;
+  }
+  EVP_DigestUpdate(ctx_, buf, len);
+}
+
+size_t OpenSSLHmac::Finish(void* buf, size_t len) {
+  if (!md_ || len < Size()) {
+    return 0;
+  }
+  uint8_t inner[EVP_MAX_MD_SIZE];
+  unsigned int inner_len;
+  EVP_DigestFinal_ex(ctx_, inner, &inner_len);
+  EVP_MD_CTX_copy_ex(ctx_, outer_ctx_);
+  EVP_DigestUpdate(ctx_, inner, inner_len);
+  unsigned int md_len;
+  EVP_DigestFinal_ex(ctx_, static_cast<unsigned char*>(buf), &md_len);
+  EVP_MD_CTX_copy_ex(ctx_, inner_ctx_);  // prepare for future Update()s
+  RTC_DCHECK(md_len == Size());
+  return md_len;
+}
+
 }  // namespace webrtc
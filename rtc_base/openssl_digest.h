@@ -46,6 +46,29 @@ class OpenSSLDigest final : public MessageDigest {
   const EVP_MD* md_;
 };
 
+// An implementation of the HMAC class that uses OpenSSL. The hash states after
+// hashing the inner and outer padded key are kept, and copied to start each
+// HMAC computation.
+class OpenSSLHmac final : public Hmac {
+ public:
+  // Creates an OpenSSLHmac with `algorithm` as the hash algorithm, keyed by
+  // `key`.
+  OpenSSLHmac(absl::string_view algorithm, absl::string_view key);
+  ~OpenSSLHmac() override;
+  // Returns the HMAC output size (e.g. 20 bytes for SHA-1).
+  size_t Size() const override;
+  // Updates the HMAC with `len` bytes from `buf`.
+  void Update(const void* buf, size_t len) override;
+  // Outputs the HMAC value to `buf` with length `len`.
+  size_t Finish(void* buf, size_t len) override;
+
+ private:
+  EVP_MD_CTX* ctx_ = nullptr;
+  EVP_MD_CTX* inner_ctx_ = nullptr;
+  EVP_MD_CTX* outer_ctx_ = nullptr;
+  const EVP_MD* md_ = nullptr;
+};
+
 }  //  namespace webrtc
 
 // Re-export symbols from the webrtc namespace for backwards compatibility.
@@ -53,6 +76,7 @@ class OpenSSLDigest final : public MessageDigest {
 #ifdef WEBRTC_ALLOW_DEPRECATED_NAMESPACES
 namespace rtc {
 using ::webrtc::OpenSSLDigest;
+using ::webrtc::OpenSSLHmac;
 }  // namespace rtc
 #endif  // WEBRTC_ALLOW_DEPRECATED_NAMESPACES
 
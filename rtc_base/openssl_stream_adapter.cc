@@ -12,6 +12,9 @@
 
 #include <openssl/bio.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
 #include <openssl/stack.h>
 #include <openssl/tls1.h>
@@ -19,6 +22,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <list>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -35,6 +40,7 @@
 #include "rtc_base/buffer.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/message_digest.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "rtc_base/openssl_adapter.h"
 #include "rtc_base/openssl_digest.h"
@@ -44,8 +50,10 @@
 #include "rtc_base/ssl_stream_adapter.h"
 #include "rtc_base/stream.h"
 #include "rtc_base/string_encode.h"
+#include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/task_utils/repeating_task.h"
 #include "rtc_base/thread.h"
+#include "rtc_base/thread_annotations.h"
 #include "rtc_base/time_utils.h"
 
 #ifdef OPENSSL_IS_BORINGSSL
@@ -65,6 +73,11 @@
 #error "webrtc requires at least OpenSSL version 1.1.0, to support DTLS-SRTP"
 #endif
 
+#if !defined(OPENSSL_IS_BORINGSSL) && (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#endif
+
 namespace {
 // Value specified in RFC 5764.
 constexpr absl::string_view kDtlsSrtpExporterLabel = "EXTRACTOR-dtls_srtp";
@@ -155,6 +168,202 @@ int GetForceDtls13(const FieldTrialsView* field_trials) {
   return kForceDtls13Off;
 }
 
+// Limits for how long the keys of a session, and the ticket keys, are used.
+constexpr int kSessionTimeoutSeconds = 10 * 60;
+// Limits the memory used by cached client sessions, which hold the peer
+// certificate.
+constexpr size_t kMaxCachedSessions = 1000;
+// Servers must set a session ID context for sessions with client certificates
+// to be resumed.
+constexpr uint8_t kSessionIdContext[] = {'W', 'e', 'b', 'R', 'T', 'C'};
+
+// Session tickets are encrypted with keys shared by all adapters in the
+// process, so that a server can resume sessions established by other adapters.
+// New tickets are encrypted with a key that is replaced every
+// kSessionTimeoutSeconds. The previous key is kept to decrypt tickets that
+// haven't expired yet.
+class TicketKeys {
+ public:
+  static constexpr size_t kNameSize = 16;
+
+  struct Key {
+    uint8_t name[kNameSize];
+    uint8_t aes_key[32];
+    uint8_t hmac_key[32];
+  };
+
+  // Returns the key to encrypt new tickets with.
+  Key GetEncryptionKey() {
+    MutexLock lock(&mutex_);
+    RotateIfNeeded();
+    return *current_;
+  }
+
+  // Returns the key named `name`, or nullopt if it is unknown or was rotated
+  // out. Sets `is_previous` if it is the previous key.
+  std::optional<Key> FindDecryptionKey(const uint8_t* name,
+                                       bool* is_previous) {
+    MutexLock lock(&mutex_);
+    RotateIfNeeded();
+    *is_previous = false;
+    if (std::memcmp(current_->name, name, kNameSize) == 0) {
+      return current_;
+    }
+    *is_previous = true;
+    if (previous_ && std::memcmp(previous_->name, name, kNameSize) == 0) {
+      return previous_;
+    }
+    return std::nullopt;
+  }
+
+ private:
+  // Ensures that `current_` is set and not older than the rotation interval.
+  void RotateIfNeeded() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    constexpr int64_t kRotationIntervalMs =
+        kSessionTimeoutSeconds * kNumMillisecsPerSec;
+    const int64_t now_ms = TimeMillis();
+    if (current_ && now_ms - current_created_ms_ < kRotationIntervalMs) {
+      return;
+    }
+    // Tickets of a key older than two intervals have all expired.
+    if (current_ && now_ms - current_created_ms_ < 2 * kRotationIntervalMs) {
+      previous_ = current_;
+    } else {
+      previous_ = std::nullopt;
+    }
+    current_.emplace();
+    RTC_CHECK_EQ(RAND_bytes(reinterpret_cast<uint8_t*>(&*current_),
+                            sizeof(Key)),
+                 1);
+    current_created_ms_ = now_ms;
+  }
+
+  Mutex mutex_;
+  std::optional<Key> current_ RTC_GUARDED_BY(mutex_);
+  std::optional<Key> previous_ RTC_GUARDED_BY(mutex_);
+  int64_t current_created_ms_ RTC_GUARDED_BY(mutex_) = 0;
+};
+
+TicketKeys& GetTicketKeys() {
+  static TicketKeys* const keys = new TicketKeys();
+  return *keys;
+}
+
+#if defined(OPENSSL_IS_BORINGSSL) || (OPENSSL_VERSION_NUMBER < 0x30000000L)
+using TicketMacContext = HMAC_CTX;
+
+bool InitTicketMac(HMAC_CTX* mac_ctx, const TicketKeys::Key& key) {
+  return HMAC_Init_ex(mac_ctx, key.hmac_key, sizeof(key.hmac_key),
+                      EVP_sha256(), nullptr) == 1;
+}
+#else
+using TicketMacContext = EVP_MAC_CTX;
+
+bool InitTicketMac(EVP_MAC_CTX* mac_ctx, const TicketKeys::Key& key) {
+  OSSL_PARAM params[] = {
+      OSSL_PARAM_construct_octet_string(
+          OSSL_MAC_PARAM_KEY, const_cast<uint8_t*>(key.hmac_key),
+          sizeof(key.hmac_key)),
+      OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                       const_cast<char*>("SHA256"), 0),
+      OSSL_PARAM_construct_end()};
+  return EVP_MAC_CTX_set_params(mac_ctx, params) == 1;
+}
+#endif
+
+// Sets up the encryption of a new session ticket with the current ticket key,
+// or the decryption of a ticket with the key named in it. See
+// SSL_CTX_set_tlsext_ticket_key_cb.
+int TicketKeyCallback(SSL* /* ssl */,
+                      uint8_t* key_name,
+                      uint8_t* iv,
+                      EVP_CIPHER_CTX* cipher_ctx,
+                      TicketMacContext* mac_ctx,
+                      int encrypt) {
+  const EVP_CIPHER* cipher = EVP_aes_256_cbc();
+  if (encrypt) {
+    const TicketKeys::Key key = GetTicketKeys().GetEncryptionKey();
+    std::memcpy(key_name, key.name, TicketKeys::kNameSize);
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(cipher)) != 1 ||
+        EVP_EncryptInit_ex(cipher_ctx, cipher, nullptr, key.aes_key, iv) != 1 ||
+        !InitTicketMac(mac_ctx, key)) {
+      return -1;
+    }
+    return 1;
+  }
+  bool is_previous = false;
+  std::optional<TicketKeys::Key> key =
+      GetTicketKeys().FindDecryptionKey(key_name, &is_previous);
+  if (!key) {
+    // Results in a full handshake.
+    return 0;
+  }
+  if (EVP_DecryptInit_ex(cipher_ctx, cipher, nullptr, key->aes_key, iv) != 1 ||
+      !InitTicketMac(mac_ctx, *key)) {
+    return -1;
+  }
+  // Clients with a ticket of the previous key get a new one of the current
+  // key.
+  return is_previous ? 2 : 1;
+}
+
+// Client sessions shared by all adapters in the process, keyed by the local
+// and peer certificate digests, with the least recently used session evicted.
+class DtlsSessionCache {
+ public:
+  // Returns a new reference to the session with `key`, or nullptr.
+  SSL_SESSION* Lookup(const std::string& key) {
+    MutexLock lock(&mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    sessions_.splice(sessions_.begin(), sessions_, it->second);
+    SSL_SESSION_up_ref(it->second->second);
+    return it->second->second;
+  }
+
+  // Adds `session`, taking over the reference to it.
+  void Add(const std::string& key, SSL_SESSION* session) {
+    MutexLock lock(&mutex_);
+    RemoveLocked(key);
+    sessions_.emplace_front(key, session);
+    index_.emplace(key, sessions_.begin());
+    if (sessions_.size() > kMaxCachedSessions) {
+      RemoveLocked(sessions_.back().first);
+    }
+  }
+
+  void Remove(const std::string& key) {
+    MutexLock lock(&mutex_);
+    RemoveLocked(key);
+  }
+
+ private:
+  using SessionList = std::list<std::pair<std::string, SSL_SESSION*>>;
+
+  void RemoveLocked(const std::string& key)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return;
+    }
+    SSL_SESSION_free(it->second->second);
+    sessions_.erase(it->second);
+    index_.erase(it);
+  }
+
+  Mutex mutex_;
+  // Most recently used first.
+  SessionList sessions_ RTC_GUARDED_BY(mutex_);
+  std::map<std::string, SessionList::iterator> index_ RTC_GUARDED_BY(mutex_);
+};
+
+DtlsSessionCache& GetDtlsSessionCache() {
+  static DtlsSessionCache* const cache = new DtlsSessionCache();
+  return *cache;
+}
+
 }  // namespace
 
 //////////////////////////////////////////////////////////////////////
@@ -911,6 +1120,18 @@ int OpenSSLStreamAdapter::BeginSSL() {
   SSL_set_mode(ssl_, SSL_MODE_ENABLE_PARTIAL_WRITE |
                          SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
 
+  session_resumed_ = false;
+  if (session_resumption_enabled_ && role_ == SSL_CLIENT) {
+    std::string key = GetSessionCacheKey();
+    if (SSL_SESSION* session =
+            key.empty() ? nullptr : GetDtlsSessionCache().Lookup(key)) {
+      // A session that can't be resumed, e.g. due to a different protocol
+      // version, results in a full handshake.
+      SSL_set_session(ssl_, session);
+      SSL_SESSION_free(session);
+    }
+  }
+
   // Do the connect
   return ContinueSSL();
 }
@@ -929,6 +1150,28 @@ int OpenSSLStreamAdapter::ContinueSSL() {
   switch (ssl_error) {
     case SSL_ERROR_NONE:
       RTC_DLOG(LS_INFO) << " -- success";
+      session_resumed_ = SSL_session_reused(ssl_);
+      if (session_resumed_ && !VerifyResumedSession()) {
+        RTC_LOG(LS_WARNING) << "Failed to verify the resumed session.";
+        if (role_ == SSL_CLIENT) {
+          GetDtlsSessionCache().Remove(GetSessionCacheKey());
+        }
+        if (handshake_error_) {
+          handshake_error_(SSLHandshakeError::UNKNOWN);
+        }
+        // Signaled here, as the DTLS timeout also completes handshakes and
+        // doesn't handle errors returned by ContinueSSL.
+        Error("VerifyResumedSession", -1, SSL_AD_BAD_CERTIFICATE, true);
+        return 0;
+      }
+      if (session_resumed_ && role_ == SSL_CLIENT &&
+          peer_certificate_verified_) {
+        // A ticket renewed by the server arrives before the resumed session
+        // is verified, so the session is cached here rather than in
+        // NewSessionCallback.
+        GetDtlsSessionCache().Add(GetSessionCacheKey(),
+                                  SSL_get1_session(ssl_));
+      }
       // By this point, OpenSSL should have given us a certificate, or errored
       // out if one was missing.
       RTC_DCHECK(peer_cert_chain_ || !GetClientAuthEnabled());
@@ -961,6 +1204,11 @@ int OpenSSLStreamAdapter::ContinueSSL() {
       }
       RTC_DLOG(LS_VERBOSE) << " -- error " << code << ", " << err_code << ", "
                            << ERR_GET_REASON(err_code);
+      // The cached session may be what the server rejected, so the next
+      // attempt starts with a full handshake.
+      if (session_resumption_enabled_ && role_ == SSL_CLIENT) {
+        GetDtlsSessionCache().Remove(GetSessionCacheKey());
+      }
       if (handshake_error_) {
         handshake_error_(ssl_handshake_err);
       }
@@ -1122,8 +1370,41 @@ SSL_CTX* OpenSSLStreamAdapter::SetupSSLContext() {
 #endif
 
 #if defined(OPENSSL_IS_BORINGSSL) || (OPENSSL_VERSION_NUMBER >= 0x30000000L)
-  SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+  if (!session_resumption_enabled_) {
+    SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+  }
+#endif
+
+  if (session_resumption_enabled_) {
+    SSL_CTX_set_timeout(ctx, kSessionTimeoutSeconds);
+    if (role_ == SSL_CLIENT) {
+      // Sessions are kept in the cache shared by all adapters rather than in
+      // the context, which only lives as long as this adapter.
+      SSL_CTX_set_session_cache_mode(
+          ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+      SSL_CTX_sess_set_new_cb(ctx, NewSessionCallback);
+    } else {
+      // Sessions are only resumed with tickets, so no server state is kept.
+      SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+#if defined(OPENSSL_IS_BORINGSSL) || (OPENSSL_VERSION_NUMBER < 0x30000000L)
+      SSL_CTX_set_tlsext_ticket_key_cb(ctx, TicketKeyCallback);
+#else
+      SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, TicketKeyCallback);
+#endif
+#if !defined(OPENSSL_IS_BORINGSSL) && (OPENSSL_VERSION_NUMBER >= 0x10101000L)
+      if (!SSL_CTX_set_session_ticket_cb(ctx, nullptr, DecryptTicketCallback,
+                                         nullptr)) {
+        SSL_CTX_free(ctx);
+        return nullptr;
+      }
 #endif
+      if (!SSL_CTX_set_session_id_context(ctx, kSessionIdContext,
+                                          sizeof(kSessionIdContext))) {
+        SSL_CTX_free(ctx);
+        return nullptr;
+      }
+    }
+  }
 
   return ctx;
 }
@@ -1135,9 +1416,22 @@ bool OpenSSLStreamAdapter::VerifyPeerCertificate() {
     return false;
   }
 
+  if (!MatchesPeerCertificateDigest(peer_cert_chain_->Get(0))) {
+    return false;
+  }
+  // Ignore any verification error if the digest matches, since there is no
+  // value in checking the validity of a self-signed cert issued by untrusted
+  // sources.
+  RTC_DLOG(LS_INFO) << "Accepted peer certificate.";
+  peer_certificate_verified_ = true;
+  return true;
+}
+
+bool OpenSSLStreamAdapter::MatchesPeerCertificateDigest(
+    const SSLCertificate& cert) const {
   Buffer computed_digest(0, EVP_MAX_MD_SIZE);
-  if (!peer_cert_chain_->Get(0).ComputeDigest(
-          peer_certificate_digest_algorithm_, computed_digest)) {
+  if (!cert.ComputeDigest(peer_certificate_digest_algorithm_,
+                          computed_digest)) {
     RTC_LOG(LS_WARNING) << "Failed to compute peer cert digest.";
     return false;
   }
@@ -1150,14 +1444,96 @@ bool OpenSSLStreamAdapter::VerifyPeerCertificate() {
         << " got " << hex_encode_with_delimiter(computed_digest, ':');
     return false;
   }
-  // Ignore any verification error if the digest matches, since there is no
-  // value in checking the validity of a self-signed cert issued by untrusted
-  // sources.
-  RTC_DLOG(LS_INFO) << "Accepted peer certificate.";
-  peer_certificate_verified_ = true;
   return true;
 }
 
+bool OpenSSLStreamAdapter::VerifyResumedSession() {
+#ifdef OPENSSL_IS_BORINGSSL
+  const STACK_OF(CRYPTO_BUFFER)* chain = SSL_get0_peer_certificates(ssl_);
+  if (chain == nullptr || sk_CRYPTO_BUFFER_num(chain) == 0) {
+    return !GetClientAuthEnabled();
+  }
+  std::vector<std::unique_ptr<SSLCertificate>> cert_chain;
+  for (CRYPTO_BUFFER* cert : chain) {
+    cert_chain.emplace_back(new BoringSSLCertificate(bssl::UpRef(cert)));
+  }
+  peer_cert_chain_.reset(new SSLCertChain(std::move(cert_chain)));
+#else
+  X509* cert = SSL_get_peer_certificate(ssl_);
+  if (cert == nullptr) {
+    return !GetClientAuthEnabled();
+  }
+  peer_cert_chain_.reset(
+      new SSLCertChain(std::make_unique<OpenSSLCertificate>(cert)));
+  X509_free(cert);
+#endif
+  // If the peer certificate digest isn't known yet, the certificate is
+  // verified once it is, like after a full handshake.
+  return !HasPeerCertificateDigest() || VerifyPeerCertificate();
+}
+
+std::string OpenSSLStreamAdapter::GetSessionCacheKey() const {
+  Buffer local_digest(0, EVP_MAX_MD_SIZE);
+  if (!identity_ || !HasPeerCertificateDigest() ||
+      !identity_->certificate().ComputeDigest(DIGEST_SHA_256, local_digest)) {
+    return "";
+  }
+  absl::string_view peer_digest(peer_certificate_digest_value_.data<char>(),
+                                peer_certificate_digest_value_.size());
+  absl::string_view own_digest(local_digest.data<char>(), local_digest.size());
+  return peer_certificate_digest_algorithm_ + " " + hex_encode(peer_digest) +
+         " " + hex_encode(own_digest);
+}
+
+#if !defined(OPENSSL_IS_BORINGSSL) && (OPENSSL_VERSION_NUMBER >= 0x10101000L)
+SSL_TICKET_RETURN OpenSSLStreamAdapter::DecryptTicketCallback(
+    SSL* ssl,
+    SSL_SESSION* session,
+    const unsigned char* /* key_name */,
+    size_t /* key_name_length */,
+    SSL_TICKET_STATUS status,
+    void* /* arg */) {
+  switch (status) {
+    case SSL_TICKET_EMPTY:
+    case SSL_TICKET_NO_DECRYPT:
+      return SSL_TICKET_RETURN_IGNORE_RENEW;
+    case SSL_TICKET_SUCCESS:
+    case SSL_TICKET_SUCCESS_RENEW:
+      break;
+    default:
+      return SSL_TICKET_RETURN_ABORT;
+  }
+  OpenSSLStreamAdapter* stream =
+      reinterpret_cast<OpenSSLStreamAdapter*>(SSL_get_app_data(ssl));
+  // If the peer certificate digest isn't known yet, the certificate is
+  // verified once it is, like after a full handshake.
+  X509* cert = SSL_SESSION_get0_peer(session);
+  if (cert != nullptr && stream->HasPeerCertificateDigest() &&
+      !stream->MatchesPeerCertificateDigest(OpenSSLCertificate(cert))) {
+    RTC_LOG(LS_WARNING) << "Rejected session ticket of another peer.";
+    return SSL_TICKET_RETURN_ABORT;
+  }
+  return status == SSL_TICKET_SUCCESS_RENEW ? SSL_TICKET_RETURN_USE_RENEW
+                                            : SSL_TICKET_RETURN_USE;
+}
+#endif
+
+int OpenSSLStreamAdapter::NewSessionCallback(SSL* ssl, SSL_SESSION* session) {
+  OpenSSLStreamAdapter* stream =
+      reinterpret_cast<OpenSSLStreamAdapter*>(SSL_get_app_data(ssl));
+  // Only sessions with a verified peer certificate are cached, under the
+  // digest that it was verified with.
+  if (!stream->peer_certificate_verified_) {
+    return 0;
+  }
+  std::string key = stream->GetSessionCacheKey();
+  if (key.empty()) {
+    return 0;
+  }
+  GetDtlsSessionCache().Add(key, session);
+  return 1;
+}
+
 std::unique_ptr<SSLCertChain> OpenSSLStreamAdapter::GetPeerSSLCertChain()
     const {
   return peer_cert_chain_ ? peer_cert_chain_->Clone() : nullptr;
@@ -1349,6 +1725,15 @@ SSLProtocolVersion OpenSSLStreamAdapter::GetMaxSupportedDTLSProtocolVersion() {
 #endif
 }
 
+void OpenSSLStreamAdapter::SetSessionResumptionEnabled(bool enabled) {
+  RTC_DCHECK(ssl_ctx_ == nullptr);
+  session_resumption_enabled_ = enabled;
+}
+
+bool OpenSSLStreamAdapter::IsSessionResumed() const {
+  return session_resumed_;
+}
+
 bool OpenSSLStreamAdapter::SetSslGroupIds(const std::vector<uint16_t>& groups) {
   if (state_ != SSL_NONE) {
     return false;
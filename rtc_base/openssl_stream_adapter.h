@@ -12,6 +12,7 @@
 #define RTC_BASE_OPENSSL_STREAM_ADAPTER_H_
 
 #include <openssl/ossl_typ.h>
+#include <openssl/ssl.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -144,6 +145,9 @@ class OpenSSLStreamAdapter final : public SSLStreamAdapter {
   // completed handshake, or 0 if not applicable (e.g. before the handshake).
   uint16_t GetSslGroupId() const override;
 
+  void SetSessionResumptionEnabled(bool enabled) override;
+  bool IsSessionResumed() const override;
+
  private:
   enum SSLState {
     // Before calling one of the StartSSL methods, data flows
@@ -190,6 +194,27 @@ class OpenSSLStreamAdapter final : public SSLStreamAdapter {
   SSL_CTX* SetupSSLContext();
   // Verify the peer certificate matches the signaled digest.
   bool VerifyPeerCertificate();
+  // Returns true if `cert` matches the signaled digest.
+  bool MatchesPeerCertificateDigest(const SSLCertificate& cert) const;
+  // Records the peer certificate of a resumed session, where no certificates
+  // are exchanged, and verifies it if the digest is known.
+  bool VerifyResumedSession();
+  // Returns the key of the client session cache for the current local identity
+  // and peer certificate digest, or an empty string if either is unknown.
+  std::string GetSessionCacheKey() const;
+  // Stores new client sessions in the session cache. See
+  // SSL_CTX_sess_set_new_cb.
+  static int NewSessionCallback(SSL* ssl, SSL_SESSION* session);
+#if !defined(OPENSSL_IS_BORINGSSL) && (OPENSSL_VERSION_NUMBER >= 0x10101000L)
+  // Fails the handshake if a session ticket has a peer certificate that
+  // doesn't match the signaled digest. See SSL_CTX_set_session_ticket_cb.
+  static SSL_TICKET_RETURN DecryptTicketCallback(SSL* ssl,
+                                                 SSL_SESSION* session,
+                                                 const unsigned char* key_name,
+                                                 size_t key_name_length,
+                                                 SSL_TICKET_STATUS status,
+                                                 void* arg);
+#endif
 
 #ifdef OPENSSL_IS_BORINGSSL
   // SSL certificate verification callback. See SSL_CTX_set_custom_verify.
@@ -268,6 +293,11 @@ class OpenSSLStreamAdapter final : public SSLStreamAdapter {
 
   int retransmission_count_ = 0;
 
+  // Whether sessions are resumed with session tickets, and whether the most
+  // recently completed handshake did.
+  bool session_resumption_enabled_ = false;
+  bool session_resumed_ = false;
+
   // Kill switch (from field-trial) flag to disable the use of
   // SSL_set_group_ids.
   const bool disable_ssl_group_ids_ = false;
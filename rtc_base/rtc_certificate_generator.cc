@@ -13,16 +13,21 @@
 #include <time.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <optional>
 #include <utility>
 
+#include "api/make_ref_counted.h"
+#include "api/ref_counted_base.h"
 #include "api/scoped_refptr.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/rtc_certificate.h"
 #include "rtc_base/ssl_identity.h"
 #include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
 
 namespace webrtc {
 
@@ -32,8 +37,73 @@ namespace {
 const char kIdentityName[] = "WebRTC";
 const uint64_t kYearInSeconds = 365 * 24 * 60 * 60;
 
+bool KeyParamsEqual(const KeyParams& a, const KeyParams& b) {
+  if (a.type() != b.type()) {
+    return false;
+  }
+  if (a.type() == KT_RSA) {
+    return a.rsa_params().mod_size == b.rsa_params().mod_size &&
+           a.rsa_params().pub_exp == b.rsa_params().pub_exp;
+  }
+  return a.ec_curve() == b.ec_curve();
+}
+
 }  // namespace
 
+// Certificates with the default expiration time, generated ahead of time.
+// Only accessed on the worker thread.
+class RTCCertificateGenerator::CertificatePool
+    : public RefCountedNonVirtual<CertificatePool> {
+ public:
+  CertificatePool(const KeyParams& key_params, size_t size)
+      : key_params_(key_params), size_(size) {}
+
+  const KeyParams& key_params() const { return key_params_; }
+
+  // Returns a pooled certificate that hasn't expired, or null if there is
+  // none.
+  scoped_refptr<RTCCertificate> Take() {
+    const uint64_t now = TimeUTCMillis();
+    while (!certificates_.empty()) {
+      scoped_refptr<RTCCertificate> certificate =
+          std::move(certificates_.front());
+      certificates_.pop_front();
+      if (!certificate->HasExpired(now)) {
+        return certificate;
+      }
+    }
+    return nullptr;
+  }
+
+  // Generates the missing certificates with one task per certificate, so that
+  // other tasks on the worker thread are delayed by one key generation at
+  // most.
+  static void Refill(scoped_refptr<CertificatePool> pool,
+                     Thread* worker_thread) {
+    RTC_DCHECK(worker_thread->IsCurrent());
+    if (pool->refilling_ || pool->certificates_.size() >= pool->size_) {
+      return;
+    }
+    pool->refilling_ = true;
+    worker_thread->PostTask([pool, worker_thread]() mutable {
+      pool->refilling_ = false;
+      scoped_refptr<RTCCertificate> certificate =
+          GenerateCertificate(pool->key_params_, std::nullopt);
+      if (!certificate) {
+        return;
+      }
+      pool->certificates_.push_back(std::move(certificate));
+      Refill(std::move(pool), worker_thread);
+    });
+  }
+
+ private:
+  const KeyParams key_params_;
+  const size_t size_;
+  std::deque<scoped_refptr<RTCCertificate>> certificates_;
+  bool refilling_ = false;
+};
+
 // static
 scoped_refptr<RTCCertificate> RTCCertificateGenerator::GenerateCertificate(
     const KeyParams& key_params,
@@ -71,6 +141,20 @@ RTCCertificateGenerator::RTCCertificateGenerator(Thread* signaling_thread,
   RTC_DCHECK(worker_thread_);
 }
 
+RTCCertificateGenerator::~RTCCertificateGenerator() = default;
+
+void RTCCertificateGenerator::EnableCertificatePool(const KeyParams& key_params,
+                                                    int pool_size) {
+  RTC_DCHECK(signaling_thread_->IsCurrent());
+  RTC_DCHECK(key_params.IsValid());
+  RTC_DCHECK_GT(pool_size, 0);
+  certificate_pool_ = make_ref_counted<CertificatePool>(key_params, pool_size);
+  worker_thread_->PostTask(
+      [pool = certificate_pool_, worker_thread = worker_thread_]() mutable {
+        CertificatePool::Refill(std::move(pool), worker_thread);
+      });
+}
+
 void RTCCertificateGenerator::GenerateCertificateAsync(
     const KeyParams& key_params,
     const std::optional<uint64_t>& expires_ms,
@@ -79,10 +163,19 @@ void RTCCertificateGenerator::GenerateCertificateAsync(
   RTC_DCHECK(callback);
 
   worker_thread_->PostTask([key_params, expires_ms,
+                            worker_thread = worker_thread_,
                             signaling_thread = signaling_thread_,
+                            pool = certificate_pool_,
                             cb = std::move(callback)]() mutable {
-    scoped_refptr<RTCCertificate> certificate =
-        RTCCertificateGenerator::GenerateCertificate(key_params, expires_ms);
+    scoped_refptr<RTCCertificate> certificate;
+    if (pool && !expires_ms && KeyParamsEqual(key_params, pool->key_params())) {
+      certificate = pool->Take();
+      CertificatePool::Refill(std::move(pool), worker_thread);
+    }
+    if (!certificate) {
+      certificate =
+          RTCCertificateGenerator::GenerateCertificate(key_params, expires_ms);
+    }
     signaling_thread->PostTask(
         [cert = std::move(certificate), cb = std::move(cb)]() mutable {
           std::move(cb)(std::move(cert));
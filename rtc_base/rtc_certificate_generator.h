@@ -62,7 +62,14 @@ class RTC_EXPORT RTCCertificateGenerator
       const std::optional<uint64_t>& expires_ms);
 
   RTCCertificateGenerator(Thread* signaling_thread, Thread* worker_thread);
-  ~RTCCertificateGenerator() override {}
+  ~RTCCertificateGenerator() override;
+
+  // Keeps `pool_size` certificates with `key_params` and the default
+  // expiration time generated ahead of time on the worker thread, so that
+  // requests for such certificates are served without waiting for the key
+  // generation. A certificate taken from the pool is replaced in the
+  // background. Must be called on the signaling thread.
+  void EnableCertificatePool(const KeyParams& key_params, int pool_size);
 
   // `RTCCertificateGeneratorInterface` overrides.
   // If `expires_ms` is specified, the certificate will expire in approximately
@@ -74,8 +81,13 @@ class RTC_EXPORT RTCCertificateGenerator
                                 Callback callback) override;
 
  private:
+  class CertificatePool;
+
   Thread* const signaling_thread_;
   Thread* const worker_thread_;
+  // Set on the signaling thread, but the pooled certificates are only
+  // accessed on the worker thread.
+  scoped_refptr<CertificatePool> certificate_pool_;
 };
 
 }  //  namespace webrtc
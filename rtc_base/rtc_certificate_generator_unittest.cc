@@ -22,6 +22,7 @@
 #include "rtc_base/rtc_certificate.h"
 #include "rtc_base/ssl_identity.h"
 #include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
 #include "test/wait_until.h"
@@ -103,6 +104,40 @@ TEST_F(RTCCertificateGeneratorTest, GenerateAsyncECDSA) {
   EXPECT_TRUE(fixture_.certificate());
 }
 
+TEST_F(RTCCertificateGeneratorTest, GenerateAsyncWithCertificatePool) {
+  fixture_.generator()->EnableCertificatePool(KeyParams::ECDSA(), 1);
+
+  // Every request gets its own certificate, whether it was pooled or not.
+  scoped_refptr<RTCCertificate> certificates[3];
+  for (scoped_refptr<RTCCertificate>& certificate : certificates) {
+    fixture_.generator()->GenerateCertificateAsync(
+        KeyParams::ECDSA(), std::nullopt, fixture_.OnGenerated());
+    EXPECT_THAT(
+        WaitUntil([&] { return fixture_.GenerateAsyncCompleted(); },
+                  ::testing::IsTrue(), {.timeout = kGenerationTimeoutMs}),
+        IsRtcOk());
+    certificate = scoped_refptr<RTCCertificate>(fixture_.certificate());
+    ASSERT_TRUE(certificate);
+  }
+  EXPECT_NE(certificates[0]->ToPEM().certificate(),
+            certificates[1]->ToPEM().certificate());
+  EXPECT_NE(certificates[1]->ToPEM().certificate(),
+            certificates[2]->ToPEM().certificate());
+
+  // Certificates with a custom expiration time are not taken from the pool.
+  const uint64_t kExpiresMs = 60000;
+  const uint64_t now = TimeUTCMillis();
+  fixture_.generator()->GenerateCertificateAsync(KeyParams::ECDSA(),
+                                                 kExpiresMs,
+                                                 fixture_.OnGenerated());
+  EXPECT_THAT(WaitUntil([&] { return fixture_.GenerateAsyncCompleted(); },
+                        ::testing::IsTrue(), {.timeout = kGenerationTimeoutMs}),
+              IsRtcOk());
+  ASSERT_TRUE(fixture_.certificate());
+  EXPECT_LE(fixture_.certificate()->Expires(),
+            now + kExpiresMs + kGenerationTimeoutMs.ms() + 1000);
+}
+
 TEST_F(RTCCertificateGeneratorTest, GenerateWithExpires) {
   // By generating two certificates with different expiration we can compare the
   // two expiration times relative to each other without knowing the current
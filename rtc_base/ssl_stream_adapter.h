@@ -284,6 +284,17 @@ class SSLStreamAdapter : public StreamInterface {
   // completed handshake, or 0 if not applicable (e.g. before the handshake).
   virtual uint16_t GetSslGroupId() const = 0;
 
+  // Enables resumption of sessions with peers that a session was established
+  // with before, using session tickets, which skips the key exchange and the
+  // certificate signatures. A client resumes a session if the peer certificate
+  // digest is set before the handshake starts, and the peer certificate of a
+  // resumed session is verified against the digest like for a full handshake.
+  // This should only be called before StartSSL().
+  virtual void SetSessionResumptionEnabled(bool enabled) = 0;
+
+  // Returns true if the most recently completed handshake resumed a session.
+  virtual bool IsSessionResumed() const = 0;
+
  private:
   // If true (default), the client is required to provide a certificate during
   // handshake. If no certificate is given, handshake fails. This applies to
@@ -0,0 +1,183 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <utility>
+
+#include "api/array_view.h"
+#include "api/sequence_checker.h"
+#include "benchmark/benchmark.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/message_digest.h"
+#include "rtc_base/ssl_identity.h"
+#include "rtc_base/ssl_stream_adapter.h"
+#include "rtc_base/stream.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+namespace {
+
+// The link doesn't lose packets, so this is only hit on errors.
+constexpr int64_t kTimeoutMs = 10000;
+
+using DatagramQueue = std::deque<Buffer>;
+
+// One end of an in-memory datagram link. The queues are owned by the
+// benchmark, so that either end can be destroyed first.
+class DatagramStream final : public StreamInterface {
+ public:
+  DatagramStream(DatagramQueue* in, DatagramQueue* out) : in_(in), out_(out) {}
+
+  // Signals the owning adapter if there are datagrams to read. Returns true
+  // if it was signaled.
+  bool NotifyIfReadable() {
+    RTC_DCHECK_RUN_ON(&callback_sequence_);
+    if (in_->empty()) {
+      return false;
+    }
+    FireEvent(SE_READ, 0);
+    return true;
+  }
+
+  StreamState GetState() const override { return SS_OPEN; }
+
+  StreamResult Read(ArrayView<uint8_t> buffer,
+                    size_t& read,
+                    int& /* error */) override {
+    if (in_->empty()) {
+      return SR_BLOCK;
+    }
+    read = std::min(buffer.size(), in_->front().size());
+    std::copy_n(in_->front().data(), read, buffer.data());
+    in_->pop_front();
+    return SR_SUCCESS;
+  }
+
+  StreamResult Write(ArrayView<const uint8_t> data,
+                     size_t& written,
+                     int& /* error */) override {
+    out_->emplace_back(data.data(), data.size());
+    written = data.size();
+    return SR_SUCCESS;
+  }
+
+  void Close() override {}
+
+ private:
+  DatagramQueue* const in_;
+  DatagramQueue* const out_;
+};
+
+// An identity generated ahead of time, so that only the handshakes are
+// measured, and the digest of its certificate, as signaled to the peer.
+struct Peer {
+  Peer() : identity(SSLIdentity::Create("benchmark", KeyParams::ECDSA())) {
+    digest.EnsureCapacity(MessageDigest::kMaxSize);
+    identity->certificate().ComputeDigest(DIGEST_SHA_256, digest);
+  }
+
+  std::unique_ptr<SSLIdentity> identity;
+  Buffer digest;
+};
+
+std::unique_ptr<SSLStreamAdapter> CreateAdapter(
+    std::unique_ptr<DatagramStream> stream,
+    const Peer& local,
+    const Peer& remote,
+    SSLRole role,
+    bool enable_session_resumption) {
+  std::unique_ptr<SSLStreamAdapter> adapter =
+      SSLStreamAdapter::Create(std::move(stream));
+  adapter->SetIdentity(local.identity->Clone());
+  adapter->SetServerRole(role);
+  adapter->SetSessionResumptionEnabled(enable_session_resumption);
+  adapter->SetPeerCertificateDigest(DIGEST_SHA_256, remote.digest);
+  return adapter;
+}
+
+// Runs a DTLS handshake between new adapters on the current thread, as done
+// by a new transport with the same certificates. Returns true if it
+// succeeded, and sets `resumed` if the session was resumed.
+bool Handshake(Thread& thread,
+               const Peer& client,
+               const Peer& server,
+               bool enable_session_resumption,
+               bool& resumed) {
+  DatagramQueue to_client;
+  DatagramQueue to_server;
+  auto client_stream = std::make_unique<DatagramStream>(&to_client, &to_server);
+  auto server_stream = std::make_unique<DatagramStream>(&to_server, &to_client);
+  DatagramStream* client_stream_ptr = client_stream.get();
+  DatagramStream* server_stream_ptr = server_stream.get();
+  std::unique_ptr<SSLStreamAdapter> client_ssl =
+      CreateAdapter(std::move(client_stream), client, server, SSL_CLIENT,
+                    enable_session_resumption);
+  std::unique_ptr<SSLStreamAdapter> server_ssl =
+      CreateAdapter(std::move(server_stream), server, client, SSL_SERVER,
+                    enable_session_resumption);
+  if (server_ssl->StartSSL() != 0 || client_ssl->StartSSL() != 0) {
+    return false;
+  }
+
+  const int64_t deadline_ms = TimeAfter(kTimeoutMs);
+  while (client_ssl->GetState() != SS_OPEN ||
+         server_ssl->GetState() != SS_OPEN) {
+    if (client_ssl->GetState() == SS_CLOSED ||
+        server_ssl->GetState() == SS_CLOSED || TimeMillis() > deadline_ms) {
+      return false;
+    }
+    const bool client_notified = client_stream_ptr->NotifyIfReadable();
+    const bool server_notified = server_stream_ptr->NotifyIfReadable();
+    if (!client_notified && !server_notified) {
+      thread.ProcessMessages(0);
+    }
+  }
+  resumed = client_ssl->IsSessionResumed() && server_ssl->IsSessionResumed();
+  return true;
+}
+
+// Runs DTLS handshakes between the same two peers, with session resumption
+// if `state.range(0)` is 1. Both sides run on the benchmark thread, so the
+// rate is the number of handshakes per second on one core. A first
+// handshake, which is not measured, lets the client cache the session.
+void BM_DtlsHandshake(benchmark::State& state) {
+  const bool enable_session_resumption = state.range(0) != 0;
+  AutoThread thread;
+  const Peer client;
+  const Peer server;
+  bool resumed = false;
+  if (!Handshake(thread, client, server, enable_session_resumption, resumed)) {
+    state.SkipWithError("Failed to connect");
+    return;
+  }
+  for (auto _ : state) {
+    if (!Handshake(thread, client, server, enable_session_resumption,
+                   resumed)) {
+      state.SkipWithError("Failed to connect");
+      break;
+    }
+    if (resumed != enable_session_resumption) {
+      state.SkipWithError("Unexpected session resumption");
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// 1 for session resumption.
+BENCHMARK(BM_DtlsHandshake)->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace webrtc
@@ -1422,6 +1422,140 @@ TEST_F(SSLStreamAdapterTestDTLS, TestDTLSSrtpExporter) {
   EXPECT_EQ(client_out, server_out);
 }
 
+// Test that reconnecting with the same identities resumes the session, which
+// still authenticates both peers and exports matching keying material.
+TEST_F(SSLStreamAdapterTestDTLS, TestDTLSSessionResumption) {
+  const std::vector<int> crypto_suites = {kSrtpAes128CmSha1_80};
+  std::unique_ptr<SSLIdentity> saved_client_identity =
+      client_identity()->Clone();
+  std::unique_ptr<SSLIdentity> saved_server_identity =
+      server_identity()->Clone();
+  client_ssl_->SetSessionResumptionEnabled(true);
+  server_ssl_->SetSessionResumptionEnabled(true);
+  SetDtlsSrtpCryptoSuites(crypto_suites, true);
+  SetDtlsSrtpCryptoSuites(crypto_suites, false);
+  TestHandshake();
+  EXPECT_FALSE(client_ssl_->IsSessionResumed());
+  EXPECT_FALSE(server_ssl_->IsSessionResumed());
+
+  // Connect new adapters with the same identities.
+  InitializeClientAndServerStreams();
+  client_ssl_->SetIdentity(saved_client_identity->Clone());
+  server_ssl_->SetIdentity(saved_server_identity->Clone());
+  client_ssl_->SetSessionResumptionEnabled(true);
+  server_ssl_->SetSessionResumptionEnabled(true);
+  SetDtlsSrtpCryptoSuites(crypto_suites, true);
+  SetDtlsSrtpCryptoSuites(crypto_suites, false);
+  SetPeerIdentitiesByDigest(true, true);
+  TestHandshake();
+  EXPECT_TRUE(client_ssl_->IsSessionResumed());
+  EXPECT_TRUE(server_ssl_->IsSessionResumed());
+
+  std::unique_ptr<SSLCertificate> server_cert =
+      GetPeerCertificate(/*client=*/true);
+  ASSERT_THAT(server_cert, NotNull());
+  EXPECT_EQ(server_cert->ToPEMString(),
+            saved_server_identity->certificate().ToPEMString());
+  std::unique_ptr<SSLCertificate> client_cert =
+      GetPeerCertificate(/*client=*/false);
+  ASSERT_THAT(client_cert, NotNull());
+  EXPECT_EQ(client_cert->ToPEMString(),
+            saved_client_identity->certificate().ToPEMString());
+
+  int selected_crypto_suite;
+  ASSERT_TRUE(GetDtlsSrtpCryptoSuite(/*client=*/true, &selected_crypto_suite));
+  int key_len;
+  int salt_len;
+  ASSERT_TRUE(
+      GetSrtpKeyAndSaltLengths(selected_crypto_suite, &key_len, &salt_len));
+  ZeroOnFreeBuffer<uint8_t> client_out(2 * (key_len + salt_len));
+  ZeroOnFreeBuffer<uint8_t> server_out(2 * (key_len + salt_len));
+  EXPECT_TRUE(client_ssl_->ExportSrtpKeyingMaterial(client_out));
+  EXPECT_TRUE(server_ssl_->ExportSrtpKeyingMaterial(server_out));
+  EXPECT_EQ(client_out, server_out);
+  TestTransfer(100);
+}
+
+// Test that a session isn't resumed with a peer that has a new identity.
+TEST_F(SSLStreamAdapterTestDTLS, TestDTLSSessionNotResumedWithNewIdentity) {
+  std::unique_ptr<SSLIdentity> saved_client_identity =
+      client_identity()->Clone();
+  client_ssl_->SetSessionResumptionEnabled(true);
+  server_ssl_->SetSessionResumptionEnabled(true);
+  TestHandshake();
+
+  InitializeClientAndServerStreams();
+  client_ssl_->SetIdentity(saved_client_identity->Clone());
+  server_ssl_->SetIdentity(
+      SSLIdentity::Create("server", KeyParams::ECDSA(EC_NIST_P256)));
+  client_ssl_->SetSessionResumptionEnabled(true);
+  server_ssl_->SetSessionResumptionEnabled(true);
+  SetPeerIdentitiesByDigest(true, true);
+  TestHandshake();
+  EXPECT_FALSE(client_ssl_->IsSessionResumed());
+  EXPECT_FALSE(server_ssl_->IsSessionResumed());
+}
+
+// Test that a resumed session whose peer certificate doesn't match the
+// signaled digest fails the handshake of the server.
+TEST_F(SSLStreamAdapterTestDTLS, TestDTLSResumedSessionWithWrongDigest) {
+  std::unique_ptr<SSLIdentity> saved_client_identity =
+      client_identity()->Clone();
+  std::unique_ptr<SSLIdentity> saved_server_identity =
+      server_identity()->Clone();
+  client_ssl_->SetSessionResumptionEnabled(true);
+  server_ssl_->SetSessionResumptionEnabled(true);
+  TestHandshake();
+
+  // The server expects the certificate of another client.
+  InitializeClientAndServerStreams();
+  client_ssl_->SetIdentity(saved_client_identity->Clone());
+  server_ssl_->SetIdentity(saved_server_identity->Clone());
+  client_ssl_->SetSessionResumptionEnabled(true);
+  server_ssl_->SetSessionResumptionEnabled(true);
+  std::unique_ptr<SSLIdentity> other_client_identity =
+      SSLIdentity::Create("other", KeyParams::ECDSA(EC_NIST_P256));
+  Buffer server_digest(0, EVP_MAX_MD_SIZE);
+  Buffer other_client_digest(0, EVP_MAX_MD_SIZE);
+  ASSERT_TRUE(saved_server_identity->certificate().ComputeDigest(
+      digest_algorithm_, server_digest));
+  ASSERT_TRUE(other_client_identity->certificate().ComputeDigest(
+      digest_algorithm_, other_client_digest));
+  EXPECT_EQ(
+      client_ssl_->SetPeerCertificateDigest(digest_algorithm_, server_digest),
+      SSLPeerCertificateDigestError::NONE);
+  EXPECT_EQ(server_ssl_->SetPeerCertificateDigest(digest_algorithm_,
+                                                  other_client_digest),
+            SSLPeerCertificateDigestError::NONE);
+  server_ssl_->SetServerRole();
+  ASSERT_EQ(server_ssl_->StartSSL(), 0);
+  ASSERT_EQ(client_ssl_->StartSSL(), 0);
+  EXPECT_THAT(WaitUntil([&] { return server_ssl_->GetState(); },
+                        ::testing::Eq(SS_CLOSED),
+                        {.timeout = handshake_wait_, .clock = &clock_}),
+              IsRtcOk());
+
+  // OpenSSL servers check the session ticket before resuming it, so the
+  // handshake of the client fails too, and it no longer offers the session.
+  // BoringSSL servers only fail after the resumed handshake.
+#ifndef OPENSSL_IS_BORINGSSL
+  EXPECT_THAT(WaitUntil([&] { return client_ssl_->GetState(); },
+                        ::testing::Eq(SS_CLOSED),
+                        {.timeout = handshake_wait_, .clock = &clock_}),
+              IsRtcOk());
+
+  InitializeClientAndServerStreams();
+  client_ssl_->SetIdentity(saved_client_identity->Clone());
+  server_ssl_->SetIdentity(saved_server_identity->Clone());
+  client_ssl_->SetSessionResumptionEnabled(true);
+  server_ssl_->SetSessionResumptionEnabled(true);
+  SetPeerIdentitiesByDigest(true, true);
+  TestHandshake();
+  EXPECT_FALSE(client_ssl_->IsSessionResumed());
+  EXPECT_FALSE(server_ssl_->IsSessionResumed());
+#endif
+}
+
 // Test not yet valid certificates are not rejected.
 TEST_F(SSLStreamAdapterTestDTLS, TestCertNotYetValid) {
   long one_day = 60 * 60 * 24;
@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/system/memory_mapped_file.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+#include "rtc_base/checks.h"
+
+#if defined(WEBRTC_POSIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace webrtc {
+
+// static
+std::unique_ptr<MemoryMappedFile> MemoryMappedFile::OpenReadOnly(
+    absl::string_view file_name_utf8) {
+  RTC_CHECK_EQ(file_name_utf8.find_first_of('\0'), absl::string_view::npos)
+      << "Invalid filename, containing NUL character";
+#if defined(WEBRTC_POSIX)
+  std::string file_name(file_name_utf8);
+  int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) ||
+      file_stat.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  const size_t size = static_cast<size_t>(file_stat.st_size);
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps a reference to the file, so the descriptor isn't needed
+  // anymore.
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return nullptr;
+  }
+  return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(
+      ArrayView<const uint8_t>(static_cast<const uint8_t*>(mapping), size)));
+#else
+  return nullptr;
+#endif
+}
+
+MemoryMappedFile::MemoryMappedFile(ArrayView<const uint8_t> data)
+    : data_(data) {}
+
+MemoryMappedFile::~MemoryMappedFile() {
+#if defined(WEBRTC_POSIX)
+  munmap(const_cast<uint8_t*>(data_.data()), data_.size());
+#endif
+}
+
+void MemoryMappedFile::AdviseSequential() const {
+#if defined(WEBRTC_POSIX)
+  madvise(const_cast<uint8_t*>(data_.data()), data_.size(), MADV_SEQUENTIAL);
+#endif
+}
+
+void MemoryMappedFile::WillNeed(size_t offset, size_t size) const {
+#if defined(WEBRTC_POSIX)
+  if (offset >= data_.size()) {
+    return;
+  }
+  size = std::min(size, data_.size() - offset);
+  // madvise requires a page aligned start address.
+  static const size_t kPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t aligned_offset = offset - offset % kPageSize;
+  madvise(const_cast<uint8_t*>(data_.data()) + aligned_offset,
+          size + (offset - aligned_offset), MADV_WILLNEED);
+#endif
+}
+
+}  // namespace webrtc
@@ -0,0 +1,63 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_SYSTEM_MEMORY_MAPPED_FILE_H_
+#define RTC_BASE_SYSTEM_MEMORY_MAPPED_FILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+
+namespace webrtc {
+
+// Read-only memory mapping of a whole file. Reading a large file through the
+// mapping avoids a system call and a copy per read, and lets the kernel do
+// read-ahead.
+//
+// Memory mapping is only supported on POSIX platforms. On other platforms, and
+// if the file can't be mapped (e.g. because it is empty or not a regular
+// file), OpenReadOnly returns nullptr and the caller is expected to fall back
+// to regular file reads, e.g. through FileWrapper.
+class MemoryMappedFile final {
+ public:
+  static std::unique_ptr<MemoryMappedFile> OpenReadOnly(
+      absl::string_view file_name_utf8);
+
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  // The content of the file. Valid for the lifetime of this object.
+  ArrayView<const uint8_t> data() const { return data_; }
+  size_t size() const { return data_.size(); }
+
+  // Hints that the file will be read mostly sequentially, so that the kernel
+  // may read ahead more aggressively.
+  void AdviseSequential() const;
+
+  // Hints that the bytes in [`offset`, `offset` + `size`) will be read soon,
+  // so that the kernel can start reading them in the background. `size` is
+  // clamped to the end of the file.
+  void WillNeed(size_t offset, size_t size) const;
+
+ private:
+  explicit MemoryMappedFile(ArrayView<const uint8_t> data);
+
+  const ArrayView<const uint8_t> data_;
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_SYSTEM_MEMORY_MAPPED_FILE_H_
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/system/memory_mapped_file.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "rtc_base/system/file_wrapper.h"
+#include "test/gtest.h"
+#include "test/testsupport/file_utils.h"
+
+namespace webrtc {
+
+#if defined(WEBRTC_POSIX)
+
+TEST(MemoryMappedFile, MapsFileContent) {
+  const std::string temp_filename =
+      test::TempFilename(test::OutputPath(), "memory_mapped_file");
+  {
+    FileWrapper file = FileWrapper::OpenWriteOnly(temp_filename);
+    ASSERT_TRUE(file.is_open());
+    EXPECT_TRUE(file.Write("foobar", 6));
+  }
+
+  std::unique_ptr<MemoryMappedFile> mapped_file =
+      MemoryMappedFile::OpenReadOnly(temp_filename);
+  ASSERT_TRUE(mapped_file);
+  ASSERT_EQ(mapped_file->size(), 6u);
+  EXPECT_EQ(memcmp(mapped_file->data().data(), "foobar", 6), 0);
+
+  // Hints are allowed for any range, including ranges past the end.
+  mapped_file->AdviseSequential();
+  mapped_file->WillNeed(3, 100);
+  mapped_file->WillNeed(100, 1);
+
+  // The mapping stays valid after the file is removed.
+  remove(temp_filename.c_str());
+  EXPECT_EQ(memcmp(mapped_file->data().data(), "foobar", 6), 0);
+}
+
+TEST(MemoryMappedFile, EmptyFileIsNotMapped) {
+  const std::string temp_filename =
+      test::TempFilename(test::OutputPath(), "memory_mapped_file");
+  { FileWrapper file = FileWrapper::OpenWriteOnly(temp_filename); }
+
+  EXPECT_FALSE(MemoryMappedFile::OpenReadOnly(temp_filename));
+  remove(temp_filename.c_str());
+}
+
+#endif  // defined(WEBRTC_POSIX)
+
+TEST(MemoryMappedFile, MissingFileIsNotMapped) {
+  EXPECT_FALSE(MemoryMappedFile::OpenReadOnly(
+      test::OutputPath() + "memory_mapped_file_does_not_exist"));
+}
+
+}  // namespace webrtc
@@ -0,0 +1,178 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_tools/bwe_replay/bwe_replay.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/field_trials.h"
+#include "api/transport/goog_cc_factory.h"
+#include "api/transport/network_control.h"
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "logging/rtc_event_log/rtc_event_log_parser.h"
+#include "modules/congestion_controller/pcc/pcc_factory.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/time_utils.h"
+#include "rtc_tools/rtc_event_log_visualizer/log_simulation.h"
+
+namespace webrtc {
+namespace {
+
+std::unique_ptr<NetworkControllerFactoryInterface> CreateFactory(
+    BweReplayController controller) {
+  switch (controller) {
+    case BweReplayController::kGoogCc:
+      return std::make_unique<GoogCcNetworkControllerFactory>();
+    case BweReplayController::kPcc:
+      return std::make_unique<PccNetworkControllerFactory>();
+  }
+  RTC_CHECK_NOTREACHED();
+}
+
+// The whole log is parsed up front rather than with ParseFileIncrementally,
+// since outgoing packets are matched with transport feedback that can be
+// logged much later, and the events of all types have to be replayed in time
+// order, which chunk boundaries don't respect.
+BweReplayResult ParseAndReplayEventLog(const std::string& log_file,
+                                       const BweReplayConfig& config) {
+  const int64_t start_time_us = TimeMicros();
+  BweReplayResult result;
+  std::unique_ptr<FieldTrials> field_trials =
+      FieldTrials::Create(config.field_trials);
+  if (field_trials == nullptr) {
+    result.error = "Invalid field trials: " + config.field_trials;
+  } else {
+    ParsedRtcEventLog parsed_log(
+        ParsedRtcEventLog::UnconfiguredHeaderExtensions::kDontParse,
+        /*allow_incomplete_log=*/true);
+    ParsedRtcEventLog::ParseStatus status = parsed_log.ParseFile(log_file);
+    if (status.ok()) {
+      const Environment env = CreateEnvironment(std::move(field_trials));
+      result = ReplayEventLog(env, config.controller, parsed_log);
+    } else {
+      result.error = status.message();
+    }
+  }
+  result.log_name = log_file;
+  result.wall_time = TimeDelta::Micros(TimeMicros() - start_time_us);
+  return result;
+}
+
+}  // namespace
+
+void BweReplayMetrics::OnUpdate(const NetworkControlUpdate& update,
+                                Timestamp at_time) {
+  if (!update.target_rate)
+    return;
+  const DataRate target_rate = update.target_rate->target_rate;
+  if (num_updates_ == 0) {
+    first_update_time_ = at_time;
+  } else {
+    integrated_target_rate_ +=
+        last_target_rate_ * (at_time - last_update_time_);
+  }
+  ++num_updates_;
+  last_update_time_ = at_time;
+  last_target_rate_ = target_rate;
+  min_target_rate_ = std::min(min_target_rate_, target_rate);
+  max_target_rate_ = std::max(max_target_rate_, target_rate);
+}
+
+void BweReplayMetrics::Finish(Timestamp end_time,
+                              BweReplayResult& result) const {
+  result.num_target_rate_updates = num_updates_;
+  if (num_updates_ == 0)
+    return;
+  result.min_target_rate = min_target_rate_;
+  result.max_target_rate = max_target_rate_;
+  result.final_target_rate = last_target_rate_;
+  end_time = std::max(end_time, last_update_time_);
+  const DataSize integrated_target_rate =
+      integrated_target_rate_ +
+      last_target_rate_ * (end_time - last_update_time_);
+  const TimeDelta duration = end_time - first_update_time_;
+  result.mean_target_rate = duration > TimeDelta::Zero()
+                                ? integrated_target_rate / duration
+                                : last_target_rate_;
+}
+
+BweReplayResult ReplayEventLog(const Environment& env,
+                               BweReplayController controller,
+                               const ParsedRtcEventLog& parsed_log) {
+  BweReplayResult result;
+  if (parsed_log.first_timestamp() > parsed_log.last_timestamp()) {
+    result.error = "Log contains no events";
+    return result;
+  }
+  result.log_duration =
+      parsed_log.last_timestamp() - parsed_log.first_timestamp();
+
+  BweReplayMetrics metrics;
+  LogBasedNetworkControllerSimulation simulation(
+      env, CreateFactory(controller),
+      [&](const NetworkControlUpdate& update, Timestamp at_time) {
+        metrics.OnUpdate(update, at_time);
+      });
+  simulation.ProcessEventsInLog(parsed_log);
+  metrics.Finish(parsed_log.last_timestamp(), result);
+  return result;
+}
+
+std::vector<BweReplayResult> ReplayEventLogFiles(
+    const std::vector<std::string>& log_files,
+    const BweReplayConfig& config) {
+  std::vector<BweReplayResult> results(log_files.size());
+
+  // Logs are handed out one at a time so that a few large logs do not end up
+  // on the same thread.
+  Mutex lock;
+  size_t next_log = 0;
+  auto replay_logs = [&] {
+    while (true) {
+      size_t i;
+      {
+        MutexLock scoped_lock(&lock);
+        if (next_log >= log_files.size())
+          return;
+        i = next_log++;
+      }
+      results[i] = ParseAndReplayEventLog(log_files[i], config);
+    }
+  };
+
+  std::vector<PlatformThread> workers;
+  const size_t num_threads =
+      std::min(static_cast<size_t>(std::max(config.num_threads, 1)),
+               log_files.size());
+  for (size_t i = 1; i < num_threads; ++i) {
+    workers.push_back(PlatformThread::SpawnJoinable(replay_logs, "bwe_replay"));
+  }
+  replay_logs();
+  // Destroying the threads joins them.
+  workers.clear();
+
+  return results;
+}
+
+}  // namespace webrtc
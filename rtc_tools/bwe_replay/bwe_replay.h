@@ -0,0 +1,89 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_TOOLS_BWE_REPLAY_BWE_REPLAY_H_
+#define RTC_TOOLS_BWE_REPLAY_BWE_REPLAY_H_
+
+#include <string>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "logging/rtc_event_log/rtc_event_log_parser.h"
+
+namespace webrtc {
+
+enum class BweReplayController { kGoogCc, kPcc };
+
+struct BweReplayConfig {
+  BweReplayController controller = BweReplayController::kGoogCc;
+  // Field trials applied to every replayed log. If they are invalid, every
+  // log fails to replay with an error.
+  std::string field_trials;
+  // Number of logs replayed concurrently. Each thread holds at most one
+  // parsed log in memory at a time.
+  int num_threads = 1;
+};
+
+// Summary of the target rates produced by a network controller when
+// replaying the send side of a single event log.
+struct BweReplayResult {
+  std::string log_name;
+  // Empty if the log was parsed and replayed successfully.
+  std::string error;
+  // Time between the first and the last event in the log.
+  TimeDelta log_duration = TimeDelta::Zero();
+  // Time spent parsing and replaying the log.
+  TimeDelta wall_time = TimeDelta::Zero();
+  int num_target_rate_updates = 0;
+  DataRate min_target_rate = DataRate::Zero();
+  DataRate max_target_rate = DataRate::Zero();
+  // Average of the target rate weighted by the time each value was in effect.
+  DataRate mean_target_rate = DataRate::Zero();
+  DataRate final_target_rate = DataRate::Zero();
+};
+
+// Accumulates the summary metrics from the stream of network control updates.
+class BweReplayMetrics {
+ public:
+  void OnUpdate(const NetworkControlUpdate& update, Timestamp at_time);
+  // Fills in the target rate metrics of `result`, treating the last target
+  // rate as being in effect until `end_time`.
+  void Finish(Timestamp end_time, BweReplayResult& result) const;
+
+ private:
+  int num_updates_ = 0;
+  Timestamp first_update_time_ = Timestamp::MinusInfinity();
+  Timestamp last_update_time_ = Timestamp::MinusInfinity();
+  DataRate last_target_rate_ = DataRate::Zero();
+  DataRate min_target_rate_ = DataRate::PlusInfinity();
+  DataRate max_target_rate_ = DataRate::Zero();
+  DataSize integrated_target_rate_ = DataSize::Zero();
+};
+
+// Replays the outgoing packets and incoming feedback of `parsed_log` through
+// a fresh network controller, as fast as possible.
+BweReplayResult ReplayEventLog(const Environment& env,
+                               BweReplayController controller,
+                               const ParsedRtcEventLog& parsed_log);
+
+// Parses and replays every file in `log_files`, using `config.num_threads`
+// threads. The results are returned in the same order as `log_files`.
+std::vector<BweReplayResult> ReplayEventLogFiles(
+    const std::vector<std::string>& log_files,
+    const BweReplayConfig& config);
+
+}  // namespace webrtc
+
+#endif  // RTC_TOOLS_BWE_REPLAY_BWE_REPLAY_H_
@@ -0,0 +1,131 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_tools/bwe_replay/bwe_replay.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "test/gtest.h"
+#include "test/testsupport/file_utils.h"
+
+namespace webrtc {
+namespace {
+
+NetworkControlUpdate TargetRateUpdate(DataRate target_rate) {
+  NetworkControlUpdate update;
+  update.target_rate = TargetTransferRate();
+  update.target_rate->target_rate = target_rate;
+  return update;
+}
+
+std::string TestLogPath() {
+  return test::ResourcePath("rtc_event_log/rtc_event_log_500kbps", "binarypb");
+}
+
+TEST(BweReplayMetricsTest, WeighsTargetRateByDuration) {
+  BweReplayMetrics metrics;
+  metrics.OnUpdate(TargetRateUpdate(DataRate::KilobitsPerSec(100)),
+                   Timestamp::Seconds(1));
+  // Updates without a target rate are ignored.
+  metrics.OnUpdate(NetworkControlUpdate(), Timestamp::Seconds(2));
+  metrics.OnUpdate(TargetRateUpdate(DataRate::KilobitsPerSec(400)),
+                   Timestamp::Seconds(4));
+
+  BweReplayResult result;
+  metrics.Finish(Timestamp::Seconds(5), result);
+  EXPECT_EQ(result.num_target_rate_updates, 2);
+  EXPECT_EQ(result.min_target_rate, DataRate::KilobitsPerSec(100));
+  EXPECT_EQ(result.max_target_rate, DataRate::KilobitsPerSec(400));
+  EXPECT_EQ(result.final_target_rate, DataRate::KilobitsPerSec(400));
+  // 3 seconds at 100 kbps and 1 second at 400 kbps.
+  EXPECT_EQ(result.mean_target_rate, DataRate::KilobitsPerSec(175));
+}
+
+TEST(BweReplayMetricsTest, NoUpdates) {
+  BweReplayMetrics metrics;
+  BweReplayResult result;
+  metrics.Finish(Timestamp::Seconds(5), result);
+  EXPECT_EQ(result.num_target_rate_updates, 0);
+  EXPECT_EQ(result.mean_target_rate, DataRate::Zero());
+}
+
+TEST(BweReplayTest, ReplaysLogWithGoogCc) {
+  BweReplayConfig config;
+  config.controller = BweReplayController::kGoogCc;
+  std::vector<BweReplayResult> results =
+      ReplayEventLogFiles({TestLogPath()}, config);
+  ASSERT_EQ(results.size(), 1u);
+  const BweReplayResult& result = results[0];
+  EXPECT_EQ(result.error, "");
+  EXPECT_GT(result.log_duration, TimeDelta::Zero());
+  EXPECT_GT(result.num_target_rate_updates, 0);
+  EXPECT_LE(result.min_target_rate, result.mean_target_rate);
+  EXPECT_LE(result.mean_target_rate, result.max_target_rate);
+}
+
+TEST(BweReplayTest, ReplaysLogWithPcc) {
+  BweReplayConfig config;
+  config.controller = BweReplayController::kPcc;
+  std::vector<BweReplayResult> results =
+      ReplayEventLogFiles({TestLogPath()}, config);
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results[0].error, "");
+  EXPECT_GT(results[0].num_target_rate_updates, 0);
+}
+
+TEST(BweReplayTest, ParallelReplayMatchesSerialReplay) {
+  const std::vector<std::string> log_files(6, TestLogPath());
+  BweReplayConfig config;
+  config.num_threads = 1;
+  std::vector<BweReplayResult> serial = ReplayEventLogFiles(log_files, config);
+  config.num_threads = 3;
+  std::vector<BweReplayResult> parallel =
+      ReplayEventLogFiles(log_files, config);
+
+  ASSERT_EQ(serial.size(), log_files.size());
+  ASSERT_EQ(parallel.size(), log_files.size());
+  for (size_t i = 0; i < log_files.size(); ++i) {
+    EXPECT_EQ(parallel[i].log_name, log_files[i]);
+    EXPECT_EQ(parallel[i].error, "");
+    EXPECT_EQ(parallel[i].num_target_rate_updates,
+              serial[i].num_target_rate_updates);
+    EXPECT_EQ(parallel[i].mean_target_rate, serial[i].mean_target_rate);
+    EXPECT_EQ(parallel[i].final_target_rate, serial[i].final_target_rate);
+  }
+}
+
+TEST(BweReplayTest, ReportsMissingLog) {
+  BweReplayConfig config;
+  config.num_threads = 2;
+  std::vector<BweReplayResult> results = ReplayEventLogFiles(
+      {test::OutputPath() + "no_such_event_log", TestLogPath()}, config);
+  ASSERT_EQ(results.size(), 2u);
+  EXPECT_NE(results[0].error, "");
+  EXPECT_EQ(results[1].error, "");
+}
+
+TEST(BweReplayTest, ReportsInvalidFieldTrials) {
+  BweReplayConfig config;
+  config.field_trials = "WebRTC-MissingSeparator/Enabled";
+  std::vector<BweReplayResult> results =
+      ReplayEventLogFiles({TestLogPath()}, config);
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results[0].log_name, TestLogPath());
+  EXPECT_NE(results[0].error, "");
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,139 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdio.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/flags/usage.h"
+#include "api/field_trials.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/cpu_info.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/time_utils.h"
+#include "rtc_tools/bwe_replay/bwe_replay.h"
+
+ABSL_FLAG(std::string,
+          controller,
+          "googcc",
+          "Network controller to replay the logs with, googcc or pcc.");
+ABSL_FLAG(std::string,
+          log_list,
+          "",
+          "File with one event log path per line, replayed in addition to the "
+          "logs given on the command line.");
+ABSL_FLAG(int32_t,
+          num_threads,
+          0,
+          "Number of logs to replay concurrently. 0 means one per core.");
+ABSL_FLAG(std::string,
+          force_fieldtrials,
+          "",
+          "Field trials control experimental feature code which can be forced. "
+          "E.g. running with --force_fieldtrials=WebRTC-FooFeature/Enable/"
+          " will assign the group Enable to field trial WebRTC-FooFeature.");
+
+int main(int argc, char* argv[]) {
+  absl::SetProgramUsageMessage(
+      "Replays the send side bandwidth estimation of RTC event logs as fast "
+      "as possible and prints summary metrics for each log as CSV.\n"
+      "Example usage:\n"
+      "./bwe_replay --controller=googcc --num_threads=8 logs/*.log\n");
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+
+  // Print RTC_LOG warnings and errors even in release builds.
+  if (webrtc::LogMessage::GetLogToDebug() > webrtc::LS_WARNING) {
+    webrtc::LogMessage::LogToDebug(webrtc::LS_WARNING);
+  }
+  webrtc::LogMessage::SetLogToStderr(true);
+
+  webrtc::BweReplayConfig config;
+  const std::string controller = absl::GetFlag(FLAGS_controller);
+  if (controller == "googcc") {
+    config.controller = webrtc::BweReplayController::kGoogCc;
+  } else if (controller == "pcc") {
+    config.controller = webrtc::BweReplayController::kPcc;
+  } else {
+    fprintf(stderr, "Unknown controller: %s\n", controller.c_str());
+    return 1;
+  }
+  config.field_trials = absl::GetFlag(FLAGS_force_fieldtrials);
+  if (webrtc::FieldTrials::Create(config.field_trials) == nullptr) {
+    fprintf(stderr, "Invalid --force_fieldtrials: %s\n",
+            config.field_trials.c_str());
+    return 1;
+  }
+  config.num_threads = absl::GetFlag(FLAGS_num_threads);
+  if (config.num_threads <= 0) {
+    config.num_threads = webrtc::cpu_info::DetectNumberOfCores();
+  }
+
+  std::vector<std::string> log_files(args.begin() + 1, args.end());
+  const std::string log_list = absl::GetFlag(FLAGS_log_list);
+  if (!log_list.empty()) {
+    std::ifstream list_file(log_list);
+    if (!list_file.is_open()) {
+      fprintf(stderr, "Failed to open %s\n", log_list.c_str());
+      return 1;
+    }
+    std::string line;
+    while (std::getline(list_file, line)) {
+      if (!line.empty())
+        log_files.push_back(line);
+    }
+  }
+  if (log_files.empty()) {
+    fprintf(stderr, "No event logs given.\n");
+    return 1;
+  }
+
+  const int64_t start_time_ms = webrtc::TimeMillis();
+  std::vector<webrtc::BweReplayResult> results =
+      webrtc::ReplayEventLogFiles(log_files, config);
+  const int64_t wall_time_ms = webrtc::TimeMillis() - start_time_ms;
+
+  printf(
+      "log,duration_s,wall_time_ms,target_rate_updates,min_target_kbps,"
+      "mean_target_kbps,max_target_kbps,final_target_kbps\n");
+  int num_failed = 0;
+  webrtc::TimeDelta total_log_duration = webrtc::TimeDelta::Zero();
+  for (const webrtc::BweReplayResult& result : results) {
+    if (!result.error.empty()) {
+      fprintf(stderr, "Failed to replay %s: %s\n", result.log_name.c_str(),
+              result.error.c_str());
+      ++num_failed;
+      continue;
+    }
+    total_log_duration += result.log_duration;
+    printf("%s,%.3f,%.1f,%d,%.1f,%.1f,%.1f,%.1f\n", result.log_name.c_str(),
+           result.log_duration.seconds<double>(), result.wall_time.ms<double>(),
+           result.num_target_rate_updates,
+           result.min_target_rate.kbps<double>(),
+           result.mean_target_rate.kbps<double>(),
+           result.max_target_rate.kbps<double>(),
+           result.final_target_rate.kbps<double>());
+  }
+
+  fprintf(stderr,
+          "Replayed %zu logs (%d failed) with %d threads in %.1f s, %.1f s of "
+          "logs per second.\n",
+          results.size(), num_failed, config.num_threads,
+          wall_time_ms / 1000.0,
+          wall_time_ms > 0
+              ? total_log_duration.seconds<double>() * 1000.0 / wall_time_ms
+              : 0.0);
+  return num_failed == 0 ? 0 : 1;
+}
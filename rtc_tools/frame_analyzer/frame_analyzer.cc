@@ -11,7 +11,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -23,7 +25,9 @@
 #include "api/test/metrics/global_metrics_logger_and_exporter.h"
 #include "api/test/metrics/metrics_exporter.h"
 #include "api/test/metrics/stdout_metrics_exporter.h"
+#include "rtc_base/cpu_info.h"
 #include "rtc_base/strings/string_builder.h"
+#include "rtc_base/time_utils.h"
 #include "rtc_tools/frame_analyzer/video_color_aligner.h"
 #include "rtc_tools/frame_analyzer/video_geometry_aligner.h"
 #include "rtc_tools/frame_analyzer/video_quality_analysis.h"
@@ -55,6 +59,11 @@ ABSL_FLAG(std::string,
           "",
           "Where to write aligned YUV ref+test output files, if not present, "
           "no files will be written");
+ABSL_FLAG(int32_t,
+          num_threads,
+          0,
+          "Number of threads to use for the alignment and the PSNR and SSIM "
+          "analysis, if not positive, one thread per CPU core is used");
 ABSL_FLAG(std::string,
           chartjson_result_file,
           "",
@@ -89,6 +98,7 @@ std::string JoinFilename(std::string directory, std::string filename) {
  * Usage:
  * frame_analyzer --label=<test_label> --reference_file=<name_of_file>
  * --test_file_ref=<name_of_file> --width=<frame_width> --height=<frame_height>
+ * [--num_threads=<number_of_threads>]
  */
 int main(int argc, char* argv[]) {
   absl::ParseCommandLine(argc, argv);
@@ -120,15 +130,27 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  int num_threads = absl::GetFlag(FLAGS_num_threads);
+  if (num_threads <= 0) {
+    num_threads = webrtc::cpu_info::DetectNumberOfCores();
+  }
+
+  const int64_t alignment_start_ms = webrtc::TimeMillis();
   const std::vector<size_t> matching_indices =
-      webrtc::test::FindMatchingFrameIndices(reference_video, test_video);
+      webrtc::test::FindMatchingFrameIndices(reference_video, test_video,
+                                             num_threads);
 
   // Align the reference video both temporally and geometrically. I.e. align the
   // frames to match up in order to the test video, and align a crop region of
   // the reference video to match up to the test video.
   const webrtc::scoped_refptr<webrtc::test::Video> aligned_reference_video =
       AdjustCropping(ReorderVideo(reference_video, matching_indices),
-                     test_video);
+                     test_video, num_threads);
+  const int64_t alignment_time_ms =
+      std::max<int64_t>(webrtc::TimeMillis() - alignment_start_ms, 1);
+  printf("Aligned %zu frames on %d threads in %.2f s (%.1f frames/s)\n",
+         matching_indices.size(), num_threads, alignment_time_ms / 1000.0,
+         matching_indices.size() * 1000.0 / alignment_time_ms);
 
   // Calculate if there is any systematic color difference between the reference
   // and test video.
@@ -150,8 +172,15 @@ int main(int argc, char* argv[]) {
   const webrtc::scoped_refptr<webrtc::test::Video> color_adjusted_test_video =
       AdjustColors(color_transformation, test_video);
 
+  const int64_t analysis_start_ms = webrtc::TimeMillis();
   results.frames = webrtc::test::RunAnalysis(
-      aligned_reference_video, color_adjusted_test_video, matching_indices);
+      aligned_reference_video, color_adjusted_test_video, matching_indices,
+      num_threads);
+  const int64_t analysis_time_ms =
+      std::max<int64_t>(webrtc::TimeMillis() - analysis_start_ms, 1);
+  printf("Analyzed %zu frames on %d threads in %.2f s (%.1f frames/s)\n",
+         results.frames.size(), num_threads, analysis_time_ms / 1000.0,
+         results.frames.size() * 1000.0 / analysis_time_ms);
 
   const std::vector<webrtc::test::Cluster> clusters =
       webrtc::test::CalculateFrameClusters(matching_indices);
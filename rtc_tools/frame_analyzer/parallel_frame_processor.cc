@@ -0,0 +1,87 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_tools/frame_analyzer/parallel_frame_processor.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "api/function_view.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+
+namespace webrtc {
+namespace test {
+
+ParallelFrameProcessor::ParallelFrameProcessor(int num_threads) {
+  RTC_CHECK_GE(num_threads, 1);
+  for (int i = 1; i < num_threads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+    Worker& worker = *workers_.back();
+    worker.thread = PlatformThread::SpawnJoinable(
+        [this, &worker] { RunWorker(worker); }, "frame_analyzer");
+  }
+}
+
+ParallelFrameProcessor::~ParallelFrameProcessor() {
+  stopping_ = true;
+  for (const std::unique_ptr<Worker>& worker : workers_) {
+    worker->start.Set();
+    // Finalizing the thread joins it.
+    worker->thread.Finalize();
+  }
+}
+
+void ParallelFrameProcessor::Process(
+    size_t number_of_frames,
+    FunctionView<void(size_t)> process_frame) {
+  number_of_frames_ = number_of_frames;
+  process_frame_ = &process_frame;
+  next_frame_ = 0;
+
+  // Only as many workers as there are frames to spare are started.
+  const size_t num_started_workers =
+      number_of_frames > 0 ? std::min(workers_.size(), number_of_frames - 1)
+                           : 0;
+  num_active_workers_ = num_started_workers;
+  for (size_t i = 0; i < num_started_workers; ++i) {
+    workers_[i]->start.Set();
+  }
+  ProcessFrames();
+  if (num_started_workers > 0) {
+    workers_done_.Wait(Event::kForever);
+  }
+  process_frame_ = nullptr;
+}
+
+void ParallelFrameProcessor::RunWorker(Worker& worker) {
+  while (true) {
+    worker.start.Wait(Event::kForever);
+    if (stopping_) {
+      return;
+    }
+    ProcessFrames();
+    if (--num_active_workers_ == 0) {
+      workers_done_.Set();
+    }
+  }
+}
+
+void ParallelFrameProcessor::ProcessFrames() {
+  for (size_t i = next_frame_++; i < number_of_frames_; i = next_frame_++) {
+    (*process_frame_)(i);
+  }
+}
+
+}  // namespace test
+}  // namespace webrtc
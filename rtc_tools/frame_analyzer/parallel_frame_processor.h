@@ -0,0 +1,71 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_TOOLS_FRAME_ANALYZER_PARALLEL_FRAME_PROCESSOR_H_
+#define RTC_TOOLS_FRAME_ANALYZER_PARALLEL_FRAME_PROCESSOR_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "api/function_view.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+
+namespace webrtc {
+namespace test {
+
+// Processes frames on a pool of threads, which are started once and reused
+// for every call to `Process`, so that the pool can be used for many small
+// batches of frames.
+class ParallelFrameProcessor {
+ public:
+  // Uses `num_threads` threads, including the thread calling `Process`.
+  explicit ParallelFrameProcessor(int num_threads);
+  ~ParallelFrameProcessor();
+
+  ParallelFrameProcessor(const ParallelFrameProcessor&) = delete;
+  ParallelFrameProcessor& operator=(const ParallelFrameProcessor&) = delete;
+
+  // Calls `process_frame` once for every index in [0, `number_of_frames`) and
+  // returns when all calls have returned. The indices are handed out in
+  // increasing order, and `process_frame` must be safe to call from several
+  // threads at once. Must not be called concurrently.
+  void Process(size_t number_of_frames,
+               FunctionView<void(size_t)> process_frame);
+
+ private:
+  struct Worker {
+    // Signaled when there is a batch of frames to process, or when stopping.
+    Event start;
+    PlatformThread thread;
+  };
+
+  void RunWorker(Worker& worker);
+  void ProcessFrames();
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // The current batch, which is set before the workers are started and is
+  // left unchanged until all of them are done.
+  size_t number_of_frames_ = 0;
+  FunctionView<void(size_t)>* process_frame_ = nullptr;
+  bool stopping_ = false;
+  std::atomic<size_t> next_frame_{0};
+  std::atomic<size_t> num_active_workers_{0};
+  // Signaled by the last worker to finish the current batch.
+  Event workers_done_;
+};
+
+}  // namespace test
+}  // namespace webrtc
+
+#endif  // RTC_TOOLS_FRAME_ANALYZER_PARALLEL_FRAME_PROCESSOR_H_
@@ -10,11 +10,16 @@
 
 #include "rtc_tools/frame_analyzer/video_geometry_aligner.h"
 
+#include <cstddef>
 #include <map>
+#include <utility>
+#include <vector>
 
 #include "api/make_ref_counted.h"
 #include "api/video/i420_buffer.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_tools/frame_analyzer/parallel_frame_processor.h"
 #include "rtc_tools/frame_analyzer/video_quality_analysis.h"
 #include "third_party/libyuv/include/libyuv/scale.h"
 
@@ -30,6 +35,50 @@ bool IsValidRegion(const CropRegion& region,
          region.top + region.bottom < frame->height();
 }
 
+// A reference video with every frame cropped and zoomed to match up to the
+// corresponding test frame. Crop regions that aren't in `crop_regions` are
+// calculated when the frame is first requested.
+class CroppedVideo : public Video {
+ public:
+  CroppedVideo(const scoped_refptr<Video>& reference_video,
+               const scoped_refptr<Video>& test_video,
+               std::map<size_t, CropRegion> crop_regions)
+      : reference_video_(reference_video),
+        test_video_(test_video),
+        crop_regions_(std::move(crop_regions)) {
+    RTC_CHECK_EQ(reference_video->number_of_frames(),
+                 test_video->number_of_frames());
+    RTC_CHECK_EQ(reference_video->width(), test_video->width());
+    RTC_CHECK_EQ(reference_video->height(), test_video->height());
+  }
+
+  int width() const override { return test_video_->width(); }
+  int height() const override { return test_video_->height(); }
+  size_t number_of_frames() const override {
+    return test_video_->number_of_frames();
+  }
+
+  scoped_refptr<I420BufferInterface> GetFrame(size_t index) const override {
+    const scoped_refptr<I420BufferInterface> reference_frame =
+        reference_video_->GetFrame(index);
+
+    // Only calculate cropping region once per frame since it's expensive.
+    if (!crop_regions_.count(index)) {
+      crop_regions_[index] =
+          CalculateCropRegion(reference_frame, test_video_->GetFrame(index));
+    }
+
+    return CropAndZoom(crop_regions_[index], reference_frame);
+  }
+
+ private:
+  const scoped_refptr<Video> reference_video_;
+  const scoped_refptr<Video> test_video_;
+  // Mutable since this is a cache that affects performance and not logical
+  // behavior.
+  mutable std::map<size_t, CropRegion> crop_regions_;
+};
+
 }  // namespace
 
 scoped_refptr<I420BufferInterface> CropAndZoom(
@@ -131,45 +180,37 @@ scoped_refptr<I420BufferInterface> AdjustCropping(
 
 scoped_refptr<Video> AdjustCropping(const scoped_refptr<Video>& reference_video,
                                     const scoped_refptr<Video>& test_video) {
-  class CroppedVideo : public Video {
-   public:
-    CroppedVideo(const scoped_refptr<Video>& reference_video,
-                 const scoped_refptr<Video>& test_video)
-        : reference_video_(reference_video), test_video_(test_video) {
-      RTC_CHECK_EQ(reference_video->number_of_frames(),
-                   test_video->number_of_frames());
-      RTC_CHECK_EQ(reference_video->width(), test_video->width());
-      RTC_CHECK_EQ(reference_video->height(), test_video->height());
-    }
-
-    int width() const override { return test_video_->width(); }
-    int height() const override { return test_video_->height(); }
-    size_t number_of_frames() const override {
-      return test_video_->number_of_frames();
-    }
-
-    scoped_refptr<I420BufferInterface> GetFrame(size_t index) const override {
-      const scoped_refptr<I420BufferInterface> reference_frame =
-          reference_video_->GetFrame(index);
-
-      // Only calculate cropping region once per frame since it's expensive.
-      if (!crop_regions_.count(index)) {
-        crop_regions_[index] =
-            CalculateCropRegion(reference_frame, test_video_->GetFrame(index));
-      }
+  return make_ref_counted<CroppedVideo>(reference_video, test_video,
+                                        std::map<size_t, CropRegion>());
+}
 
-      return CropAndZoom(crop_regions_[index], reference_frame);
+scoped_refptr<Video> AdjustCropping(const scoped_refptr<Video>& reference_video,
+                                    const scoped_refptr<Video>& test_video,
+                                    int num_threads) {
+  RTC_CHECK_EQ(reference_video->number_of_frames(),
+               test_video->number_of_frames());
+  const size_t number_of_frames = test_video->number_of_frames();
+  std::vector<CropRegion> crop_regions(number_of_frames);
+  // The videos are typically backed by files and are not thread safe, so the
+  // frames are read under `video_lock`.
+  Mutex video_lock;
+  ParallelFrameProcessor(num_threads).Process(number_of_frames, [&](size_t i) {
+    scoped_refptr<I420BufferInterface> reference_frame;
+    scoped_refptr<I420BufferInterface> test_frame;
+    {
+      MutexLock lock(&video_lock);
+      reference_frame = reference_video->GetFrame(i);
+      test_frame = test_video->GetFrame(i);
     }
+    crop_regions[i] = CalculateCropRegion(reference_frame, test_frame);
+  });
 
-   private:
-    const scoped_refptr<Video> reference_video_;
-    const scoped_refptr<Video> test_video_;
-    // Mutable since this is a cache that affects performance and not logical
-    // behavior.
-    mutable std::map<size_t, CropRegion> crop_regions_;
-  };
-
-  return make_ref_counted<CroppedVideo>(reference_video, test_video);
+  std::map<size_t, CropRegion> crop_region_map;
+  for (size_t i = 0; i < number_of_frames; ++i) {
+    crop_region_map.emplace_hint(crop_region_map.end(), i, crop_regions[i]);
+  }
+  return make_ref_counted<CroppedVideo>(reference_video, test_video,
+                                        std::move(crop_region_map));
 }
 
 }  // namespace test
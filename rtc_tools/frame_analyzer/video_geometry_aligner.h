@@ -50,6 +50,12 @@ scoped_refptr<I420BufferInterface> AdjustCropping(
 scoped_refptr<Video> AdjustCropping(const scoped_refptr<Video>& reference_video,
                                     const scoped_refptr<Video>& test_video);
 
+// Same as above, but the crop regions of all frames are calculated up front on
+// `num_threads` threads, instead of when each frame is first requested.
+scoped_refptr<Video> AdjustCropping(const scoped_refptr<Video>& reference_video,
+                                    const scoped_refptr<Video>& test_video,
+                                    int num_threads);
+
 }  // namespace test
 }  // namespace webrtc
 
@@ -14,6 +14,7 @@
 
 #include "api/video/i420_buffer.h"
 #include "rtc_tools/frame_analyzer/video_quality_analysis.h"
+#include "rtc_tools/frame_analyzer/video_temporal_aligner.h"
 #include "rtc_tools/video_file_reader.h"
 #include "test/gtest.h"
 #include "test/testsupport/file_utils.h"
@@ -149,5 +150,30 @@ TEST_F(VideoGeometryAlignerTest, CalculateCropRegionArbitrary) {
             CalculateCropRegion(frame, CropAndZoom(crop_region, frame)));
 }
 
+TEST_F(VideoGeometryAlignerTest, AdjustCroppingOnMultipleThreads) {
+  // Match every frame against the frame after it to get varying crop regions.
+  std::vector<size_t> reference_indices;
+  std::vector<size_t> test_indices;
+  for (size_t i = 0; i < 20; ++i) {
+    reference_indices.push_back(i);
+    test_indices.push_back(i + 1);
+  }
+  const scoped_refptr<Video> reference_video =
+      ReorderVideo(reference_video_, reference_indices);
+  const scoped_refptr<Video> test_video =
+      ReorderVideo(reference_video_, test_indices);
+
+  const scoped_refptr<Video> single_threaded_video =
+      AdjustCropping(reference_video, test_video);
+  const scoped_refptr<Video> multi_threaded_video =
+      AdjustCropping(reference_video, test_video, /*num_threads=*/4);
+
+  ASSERT_EQ(multi_threaded_video->number_of_frames(), test_indices.size());
+  for (size_t i = 0; i < test_indices.size(); ++i) {
+    EXPECT_EQ(1.0, Ssim(single_threaded_video->GetFrame(i),
+                        multi_threaded_video->GetFrame(i)));
+  }
+}
+
 }  // namespace test
 }  // namespace webrtc
@@ -13,11 +13,14 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <vector>
 
 #include "api/numerics/samples_stats_counter.h"
 #include "api/test/metrics/metric.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_tools/frame_analyzer/parallel_frame_processor.h"
 #include "third_party/libyuv/include/libyuv/compare.h"
 
 namespace webrtc {
@@ -58,20 +61,37 @@ std::vector<AnalysisResult> RunAnalysis(
     const scoped_refptr<test::Video>& reference_video,
     const scoped_refptr<test::Video>& test_video,
     const std::vector<size_t>& test_frame_indices) {
-  std::vector<AnalysisResult> results;
-  for (size_t i = 0; i < test_video->number_of_frames(); ++i) {
-    const scoped_refptr<I420BufferInterface>& test_frame =
-        test_video->GetFrame(i);
-    const scoped_refptr<I420BufferInterface>& reference_frame =
-        reference_video->GetFrame(i);
+  return RunAnalysis(reference_video, test_video, test_frame_indices,
+                     /*num_threads=*/1);
+}
+
+std::vector<AnalysisResult> RunAnalysis(
+    const scoped_refptr<test::Video>& reference_video,
+    const scoped_refptr<test::Video>& test_video,
+    const std::vector<size_t>& test_frame_indices,
+    int num_threads) {
+  const size_t number_of_frames = test_video->number_of_frames();
+  std::vector<AnalysisResult> results(number_of_frames);
+
+  // The videos are typically backed by files and are not thread safe, so the
+  // frames are read under `video_lock`. Only the metric calculations, which
+  // dominate the run time, are done in parallel.
+  Mutex video_lock;
+  ParallelFrameProcessor(num_threads).Process(number_of_frames, [&](size_t i) {
+    scoped_refptr<I420BufferInterface> test_frame;
+    scoped_refptr<I420BufferInterface> reference_frame;
+    {
+      MutexLock lock(&video_lock);
+      test_frame = test_video->GetFrame(i);
+      reference_frame = reference_video->GetFrame(i);
+    }
 
     // Fill in the result struct.
-    AnalysisResult result;
+    AnalysisResult& result = results[i];
     result.frame_number = test_frame_indices[i];
     result.psnr_value = Psnr(reference_frame, test_frame);
     result.ssim_value = Ssim(reference_frame, test_frame);
-    results.push_back(result);
-  }
+  });
 
   return results;
 }
@@ -57,6 +57,16 @@ std::vector<AnalysisResult> RunAnalysis(
     const scoped_refptr<webrtc::test::Video>& test_video,
     const std::vector<size_t>& test_frame_indices);
 
+// Same as above, but computes the metrics for different frames in parallel on
+// `num_threads` threads. Frames are still read from the videos one at a time,
+// so the videos don't need to be thread safe. The results are returned in
+// frame order.
+std::vector<AnalysisResult> RunAnalysis(
+    const scoped_refptr<webrtc::test::Video>& reference_video,
+    const scoped_refptr<webrtc::test::Video>& test_video,
+    const std::vector<size_t>& test_frame_indices,
+    int num_threads);
+
 // Compute PSNR for an I420 buffer (all planes). The max return value (in the
 // case where the test and reference frames are exactly the same) will be 48.
 double Psnr(const scoped_refptr<I420BufferInterface>& ref_buffer,
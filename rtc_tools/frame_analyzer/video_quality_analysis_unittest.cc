@@ -14,6 +14,8 @@
 
 #include "api/test/metrics/metric.h"
 #include "api/test/metrics/metrics_logger.h"
+#include "rtc_tools/frame_analyzer/video_temporal_aligner.h"
+#include "rtc_tools/video_file_reader.h"
 #include "system_wrappers/include/clock.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
@@ -186,6 +188,33 @@ TEST(VideoQualityAnalysisTest,
                .mean = 3}}));
 }
 
+TEST(VideoQualityAnalysisTest, RunAnalysisOnMultipleThreadsGivesSameResult) {
+  scoped_refptr<Video> reference_video =
+      OpenYuvFile(ResourcePath("foreman_128x96", "yuv"), 128, 96);
+  ASSERT_TRUE(reference_video);
+  // Compare every frame against the frame after it to get varying results.
+  std::vector<size_t> indices;
+  for (size_t i = 0; i + 1 < reference_video->number_of_frames(); ++i)
+    indices.push_back(i + 1);
+  scoped_refptr<Video> test_video = ReorderVideo(reference_video, indices);
+
+  const std::vector<AnalysisResult> single_threaded_results =
+      RunAnalysis(reference_video, test_video, indices);
+  const std::vector<AnalysisResult> multi_threaded_results =
+      RunAnalysis(reference_video, test_video, indices, /*num_threads=*/4);
+
+  ASSERT_EQ(single_threaded_results.size(), indices.size());
+  ASSERT_EQ(multi_threaded_results.size(), indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    EXPECT_EQ(multi_threaded_results[i].frame_number,
+              single_threaded_results[i].frame_number);
+    EXPECT_EQ(multi_threaded_results[i].psnr_value,
+              single_threaded_results[i].psnr_value);
+    EXPECT_EQ(multi_threaded_results[i].ssim_value,
+              single_threaded_results[i].ssim_value);
+  }
+}
+
 TEST(VideoQualityAnalysisTest, CalculateFrameClustersOneValue) {
   const std::vector<Cluster> result = CalculateFrameClusters({1});
   EXPECT_EQ(1u, result.size());
@@ -14,13 +14,13 @@
 #include <cmath>
 #include <cstddef>
 #include <deque>
-#include <iterator>
 #include <limits>
 #include <vector>
 
 #include "api/make_ref_counted.h"
 #include "api/video/i420_buffer.h"
 #include "api/video/video_frame_buffer.h"
+#include "rtc_tools/frame_analyzer/parallel_frame_processor.h"
 #include "rtc_tools/frame_analyzer/video_quality_analysis.h"
 
 namespace webrtc {
@@ -144,33 +144,84 @@ class CachedVideo : public Video {
   mutable std::deque<CachedFrame> cache_;
 };
 
+// Returns the SSIM between the test frame and each of the reference frames
+// with indices in [`begin`, `end`). The reference frames are read on the
+// calling thread, since videos are not thread safe, and the SSIM values are
+// calculated by `frame_processor`.
+std::vector<double> CalculateSsims(
+    const scoped_refptr<I420BufferInterface>& test_frame,
+    const Video& reference_video,
+    size_t begin,
+    size_t end,
+    ParallelFrameProcessor& frame_processor) {
+  std::vector<scoped_refptr<I420BufferInterface>> reference_frames;
+  for (size_t i = begin; i < end; ++i)
+    reference_frames.push_back(reference_video.GetFrame(i));
+  std::vector<double> ssims(reference_frames.size());
+  frame_processor.Process(reference_frames.size(), [&](size_t i) {
+    ssims[i] = Ssim(test_frame, reference_frames[i]);
+  });
+  return ssims;
+}
+
 // Try matching the test frame against all frames in the reference video and
 // return the index of the best matching frame.
 size_t FindBestMatch(const scoped_refptr<I420BufferInterface>& test_frame,
-                     const Video& reference_video) {
-  std::vector<double> ssim;
-  for (const auto& ref_frame : reference_video)
-    ssim.push_back(Ssim(test_frame, ref_frame));
-  return std::distance(ssim.begin(),
-                       std::max_element(ssim.begin(), ssim.end()));
+                     const Video& reference_video,
+                     ParallelFrameProcessor& frame_processor) {
+  // Only a limited number of reference frames are held in memory at a time.
+  const size_t kBatchSize = kNumberOfFramesLookAhead;
+  size_t best_index = 0;
+  double best_ssim = -std::numeric_limits<double>::infinity();
+  const size_t number_of_frames = reference_video.number_of_frames();
+  for (size_t begin = 0; begin < number_of_frames; begin += kBatchSize) {
+    const std::vector<double> ssims =
+        CalculateSsims(test_frame, reference_video, begin,
+                       std::min(begin + kBatchSize, number_of_frames),
+                       frame_processor);
+    for (size_t i = 0; i < ssims.size(); ++i) {
+      if (ssims[i] > best_ssim) {
+        best_ssim = ssims[i];
+        best_index = begin + i;
+      }
+    }
+  }
+  return best_index;
 }
 
 // Find and return the index of the frame matching the test frame. The search
 // starts at the starting index and continues until there is no better match
-// within the next kNumberOfFramesLookAhead frames.
+// within the next kNumberOfFramesLookAhead frames. The SSIM values for all
+// frames within the look ahead are calculated at once, so that it can be done
+// by `frame_processor`.
 size_t FindNextMatch(const scoped_refptr<I420BufferInterface>& test_frame,
                      const Video& reference_video,
-                     size_t start_index) {
-  const double start_ssim =
-      Ssim(test_frame, reference_video.GetFrame(start_index));
-  for (int i = 1; i < kNumberOfFramesLookAhead; ++i) {
-    const size_t next_index = start_index + i;
-    // If we find a better match, restart the search at that point.
-    if (start_ssim < Ssim(test_frame, reference_video.GetFrame(next_index)))
-      return FindNextMatch(test_frame, reference_video, next_index);
+                     size_t start_index,
+                     ParallelFrameProcessor& frame_processor) {
+  // SSIM values of the reference frames from `start_index` and on.
+  const size_t first_index = start_index;
+  std::vector<double> ssims;
+  while (true) {
+    const size_t end_index = start_index + kNumberOfFramesLookAhead;
+    const std::vector<double> new_ssims =
+        CalculateSsims(test_frame, reference_video, first_index + ssims.size(),
+                       end_index, frame_processor);
+    ssims.insert(ssims.end(), new_ssims.begin(), new_ssims.end());
+
+    const double start_ssim = ssims[start_index - first_index];
+    size_t next_index = start_index;
+    for (size_t index = start_index + 1; index < end_index; ++index) {
+      // If we find a better match, restart the search at that point.
+      if (start_ssim < ssims[index - first_index]) {
+        next_index = index;
+        break;
+      }
+    }
+    // The starting index was the best match.
+    if (next_index == start_index)
+      return start_index;
+    start_index = next_index;
   }
-  // The starting index was the best match.
-  return start_index;
 }
 
 }  // namespace
@@ -178,6 +229,14 @@ size_t FindNextMatch(const scoped_refptr<I420BufferInterface>& test_frame,
 std::vector<size_t> FindMatchingFrameIndices(
     const scoped_refptr<Video>& reference_video,
     const scoped_refptr<Video>& test_video) {
+  return FindMatchingFrameIndices(reference_video, test_video,
+                                  /*num_threads=*/1);
+}
+
+std::vector<size_t> FindMatchingFrameIndices(
+    const scoped_refptr<Video>& reference_video,
+    const scoped_refptr<Video>& test_video,
+    int num_threads) {
   // This is done to get a 10x speedup. We don't need the full resolution in
   // order to match frames, and we should limit file access and not read the
   // same memory tens of times.
@@ -193,16 +252,20 @@ std::vector<size_t> FindMatchingFrameIndices(
   const scoped_refptr<Video> looping_reference_video =
       make_ref_counted<LoopingVideo>(cached_downscaled_reference_video);
 
+  // The threads are reused for all test frames, as the SSIM values for a
+  // single test frame are calculated quickly compared to starting threads.
+  ParallelFrameProcessor frame_processor(num_threads);
   std::vector<size_t> match_indices;
   for (const scoped_refptr<I420BufferInterface>& test_frame :
        *downscaled_test_video) {
     if (match_indices.empty()) {
       // First frame.
-      match_indices.push_back(
-          FindBestMatch(test_frame, *cached_downscaled_reference_video));
+      match_indices.push_back(FindBestMatch(
+          test_frame, *cached_downscaled_reference_video, frame_processor));
     } else {
-      match_indices.push_back(FindNextMatch(
-          test_frame, *looping_reference_video, match_indices.back()));
+      match_indices.push_back(
+          FindNextMatch(test_frame, *looping_reference_video,
+                        match_indices.back(), frame_processor));
     }
   }
 
@@ -31,6 +31,13 @@ std::vector<size_t> FindMatchingFrameIndices(
     const scoped_refptr<Video>& reference_video,
     const scoped_refptr<Video>& test_video);
 
+// Same as above, but the SSIM values used to match frames are calculated on
+// `num_threads` threads. The returned indices are the same.
+std::vector<size_t> FindMatchingFrameIndices(
+    const scoped_refptr<Video>& reference_video,
+    const scoped_refptr<Video>& test_video,
+    int num_threads);
+
 // Generate a new video using the frames from the original video. The returned
 // video will have the same number of frames as the size of `indices`, and
 // frame nr i in the returned video will point to frame nr indices[i] in the
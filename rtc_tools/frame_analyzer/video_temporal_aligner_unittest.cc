@@ -11,6 +11,7 @@
 #include "rtc_tools/frame_analyzer/video_temporal_aligner.h"
 
 #include <cstddef>
+#include <vector>
 
 #include "rtc_tools/frame_analyzer/video_quality_analysis.h"
 #include "rtc_tools/video_file_reader.h"
@@ -101,6 +102,27 @@ TEST_F(VideoTemporalAlignerTest, FindMatchingFrameIndicesStressTest) {
   EXPECT_EQ(indices, matched_indices);
 }
 
+TEST_F(VideoTemporalAlignerTest, FindMatchingFrameIndicesOnMultipleThreads) {
+  // Arbitrary start index.
+  const size_t start_index = 12345;
+  std::vector<size_t> indices = {start_index %
+                                 reference_video->number_of_frames()};
+  // Skip and repeat frames, so that searches restart within the look ahead.
+  for (size_t step : {1, 1, 3, 5, 10, 0, 2, 10})
+    indices.push_back(indices.back() + step);
+
+  // Generate a test video based on this sequence.
+  scoped_refptr<Video> test_video = ReorderVideo(reference_video, indices);
+
+  const std::vector<size_t> matched_indices =
+      FindMatchingFrameIndices(reference_video, test_video,
+                               /*num_threads=*/4);
+
+  EXPECT_EQ(FindMatchingFrameIndices(reference_video, test_video),
+            matched_indices);
+  EXPECT_EQ(indices, matched_indices);
+}
+
 TEST_F(VideoTemporalAlignerTest, GenerateAlignedReferenceVideo) {
   // Arbitrary start index.
   const size_t start_index = 12345;
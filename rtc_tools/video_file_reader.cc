@@ -11,17 +11,21 @@
 #include "rtc_tools/video_file_reader.h"
 
 #include <cstdio>
+#include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/strings/match.h"
 #include "api/make_ref_counted.h"
 #include "api/video/i420_buffer.h"
+#include "common_video/include/video_frame_buffer.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/string_encode.h"
 #include "rtc_base/string_to_number.h"
+#include "rtc_base/system/memory_mapped_file.h"
 
 namespace webrtc {
 namespace test {
@@ -76,6 +80,82 @@ class VideoFile : public Video {
   FILE* const file_;
 };
 
+// Memory mapped .yuv or .y4m file. Frames are returned as zero-copy views into
+// the mapping instead of being read into newly allocated buffers. In contrast to
+// VideoFile, GetFrame() is thread safe.
+class MappedVideoFile : public Video {
+ public:
+  MappedVideoFile(int width,
+                  int height,
+                  const std::vector<size_t>& frame_offsets,
+                  std::unique_ptr<MemoryMappedFile> mapped_file)
+      : width_(width),
+        height_(height),
+        chroma_width_((width + 1) / 2),
+        chroma_height_((height + 1) / 2),
+        frame_size_(width * height + 2 * chroma_width_ * chroma_height_),
+        frame_offsets_(frame_offsets),
+        mapped_file_(std::move(mapped_file)) {
+    mapped_file_->AdviseSequential();
+  }
+
+  size_t number_of_frames() const override { return frame_offsets_.size(); }
+  int width() const override { return width_; }
+  int height() const override { return height_; }
+
+  scoped_refptr<I420BufferInterface> GetFrame(
+      size_t frame_index) const override {
+    RTC_CHECK_LT(frame_index, frame_offsets_.size());
+
+    const size_t offset = frame_offsets_[frame_index];
+    if (offset + frame_size_ > mapped_file_->size()) {
+      RTC_LOG(LS_ERROR) << "Could not read YUV data for frame " << frame_index;
+      return nullptr;
+    }
+    // Frames are typically accessed in order, so start reading in the next
+    // frame while this one is processed.
+    if (frame_index + 1 < frame_offsets_.size()) {
+      mapped_file_->WillNeed(frame_offsets_[frame_index + 1], frame_size_);
+    }
+
+    const uint8_t* data_y = mapped_file_->data().data() + offset;
+    const uint8_t* data_u = data_y + width_ * height_;
+    const uint8_t* data_v = data_u + chroma_width_ * chroma_height_;
+    // The returned frame keeps the mapping alive.
+    scoped_refptr<const Video> video(this);
+    return WrapI420Buffer(width_, height_, data_y, width_, data_u,
+                          chroma_width_, data_v, chroma_width_,
+                          [video] {});
+  }
+
+ private:
+  const int width_;
+  const int height_;
+  const int chroma_width_;
+  const int chroma_height_;
+  const size_t frame_size_;
+  const std::vector<size_t> frame_offsets_;
+  const std::unique_ptr<MemoryMappedFile> mapped_file_;
+};
+
+// Creates a memory mapped video if possible, otherwise falls back to reading
+// frames from `file`. Takes ownership of `file`.
+scoped_refptr<Video> CreateVideo(const std::string& file_name,
+                                 int width,
+                                 int height,
+                                 const std::vector<fpos_t>& frame_positions,
+                                 const std::vector<size_t>& frame_offsets,
+                                 FILE* file) {
+  std::unique_ptr<MemoryMappedFile> mapped_file =
+      MemoryMappedFile::OpenReadOnly(file_name);
+  if (mapped_file) {
+    fclose(file);
+    return make_ref_counted<MappedVideoFile>(width, height, frame_offsets,
+                                             std::move(mapped_file));
+  }
+  return make_ref_counted<VideoFile>(width, height, frame_positions, file);
+}
+
 }  // namespace
 
 Video::Iterator::Iterator(const scoped_refptr<const Video>& video, size_t index)
@@ -201,6 +281,7 @@ scoped_refptr<Video> OpenY4mFile(const std::string& file_name) {
 
   const int i420_frame_size = 3 * *width * *height / 2;
   std::vector<fpos_t> frame_positions;
+  std::vector<size_t> frame_offsets;
   while (true) {
     std::array<char, 6> read_buffer;
     if (fread(read_buffer.data(), 1, read_buffer.size(), file) <
@@ -214,6 +295,7 @@ scoped_refptr<Video> OpenY4mFile(const std::string& file_name) {
     fpos_t pos;
     fgetpos(file, &pos);
     frame_positions.push_back(pos);
+    frame_offsets.push_back(ftell(file));
     // Skip over YUV pixel data.
     fseek(file, i420_frame_size, SEEK_CUR);
   }
@@ -223,7 +305,8 @@ scoped_refptr<Video> OpenY4mFile(const std::string& file_name) {
   }
   RTC_LOG(LS_INFO) << "Video has " << frame_positions.size() << " frames";
 
-  return make_ref_counted<VideoFile>(*width, *height, frame_positions, file);
+  return CreateVideo(file_name, *width, *height, frame_positions, frame_offsets,
+                     file);
 }
 
 scoped_refptr<Video> OpenYuvFile(const std::string& file_name,
@@ -252,10 +335,12 @@ scoped_refptr<Video> OpenYuvFile(const std::string& file_name,
   const size_t number_of_frames = file_size / i420_frame_size;
 
   std::vector<fpos_t> frame_positions;
+  std::vector<size_t> frame_offsets;
   for (size_t i = 0; i < number_of_frames; ++i) {
     fpos_t pos;
     fgetpos(file, &pos);
     frame_positions.push_back(pos);
+    frame_offsets.push_back(i * i420_frame_size);
     fseek(file, i420_frame_size, SEEK_CUR);
   }
   if (frame_positions.empty()) {
@@ -264,7 +349,8 @@ scoped_refptr<Video> OpenYuvFile(const std::string& file_name,
   }
   RTC_LOG(LS_INFO) << "Video has " << frame_positions.size() << " frames";
 
-  return make_ref_counted<VideoFile>(width, height, frame_positions, file);
+  return CreateVideo(file_name, width, height, frame_positions, frame_offsets,
+                     file);
 }
 
 scoped_refptr<Video> OpenYuvOrY4mFile(const std::string& file_name,
@@ -73,6 +73,15 @@ TEST_F(Y4mFileReaderTest, TestPixelContent) {
   }
 }
 
+TEST_F(Y4mFileReaderTest, FrameOutlivesVideo) {
+  scoped_refptr<I420BufferInterface> frame = video->GetFrame(1);
+  ASSERT_TRUE(frame);
+  video = nullptr;
+  EXPECT_EQ(36, frame->DataY()[0]);
+  EXPECT_EQ(36 + 6 * 4, frame->DataU()[0]);
+  EXPECT_EQ(36 + 6 * 4 + 3 * 2, frame->DataV()[0]);
+}
+
 class YuvFileReaderTest : public ::testing::Test {
  public:
   void SetUp() override {
@@ -123,5 +132,26 @@ TEST_F(YuvFileReaderTest, TestPixelContent) {
   }
 }
 
+TEST_F(YuvFileReaderTest, FrameOutlivesVideo) {
+  scoped_refptr<I420BufferInterface> frame = video->GetFrame(1);
+  ASSERT_TRUE(frame);
+  video = nullptr;
+  EXPECT_EQ(36, frame->DataY()[0]);
+  EXPECT_EQ(36 + 6 * 4, frame->DataU()[0]);
+  EXPECT_EQ(36 + 6 * 4 + 3 * 2, frame->DataV()[0]);
+}
+
+// Frames of a memory mapped file are views into the mapping, so reading a frame
+// twice returns the same pixel data, while frames read from the file are copied
+// into new buffers.
+TEST_F(YuvFileReaderTest, FramesAreMemoryMapped) {
+  scoped_refptr<I420BufferInterface> frame = video->GetFrame(1);
+  scoped_refptr<I420BufferInterface> same_frame = video->GetFrame(1);
+  ASSERT_TRUE(frame);
+  ASSERT_TRUE(same_frame);
+  EXPECT_EQ(frame->DataY(), same_frame->DataY());
+  EXPECT_EQ(video->GetFrame(0)->DataY() + 6 * 4 * 3 / 2, frame->DataY());
+}
+
 }  // namespace test
 }  // namespace webrtc
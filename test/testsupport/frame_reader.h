@@ -19,6 +19,7 @@
 #include "api/scoped_refptr.h"
 #include "api/video/i420_buffer.h"
 #include "api/video/resolution.h"
+#include "rtc_base/system/memory_mapped_file.h"
 
 namespace webrtc {
 namespace test {
@@ -115,6 +116,8 @@ class YuvFrameReaderImpl : public FrameReader {
   int frame_size_bytes_;
   int header_size_bytes_;
   FILE* file_;
+  // If set, frames are read from the mapping instead of from `file_`.
+  std::unique_ptr<MemoryMappedFile> mapped_file_;
   RateScaler framerate_scaler_;
 };
 
@@ -20,6 +20,7 @@
 #include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/string_encode.h"
+#include "rtc_base/system/memory_mapped_file.h"
 #include "test/testsupport/file_utils.h"
 #include "test/testsupport/frame_reader.h"
 
@@ -94,6 +95,11 @@ void Y4mFrameReaderImpl::Init() {
                                  frame_size_bytes_);
   RTC_CHECK_GT(num_frames_, 0u) << "File " << filepath_ << " is too small";
   header_size_bytes_ += kFrameHeaderSize;
+
+  mapped_file_ = MemoryMappedFile::OpenReadOnly(filepath_);
+  if (mapped_file_) {
+    mapped_file_->AdviseSequential();
+  }
 }
 
 std::unique_ptr<FrameReader> CreateY4mFrameReader(std::string filepath) {
@@ -9,6 +9,8 @@
  */
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <memory>
 #include <string>
@@ -18,6 +20,7 @@
 #include "api/video/resolution.h"
 #include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/system/memory_mapped_file.h"
 #include "test/frame_utils.h"
 #include "test/testsupport/file_utils.h"
 #include "test/testsupport/frame_reader.h"
@@ -46,6 +49,24 @@ int WrapFrameNum(int frame_num, int num_frames, RepeatMode mode) {
   return wrapped_num;
 }
 
+scoped_refptr<I420Buffer> ReadI420Buffer(Resolution resolution,
+                                         const MemoryMappedFile& mapped_file,
+                                         size_t offset) {
+  const int chroma_width = (resolution.width + 1) / 2;
+  const int chroma_height = (resolution.height + 1) / 2;
+  const size_t y_size = resolution.width * resolution.height;
+  const size_t chroma_size = chroma_width * chroma_height;
+  if (offset + y_size + 2 * chroma_size > mapped_file.size()) {
+    return nullptr;
+  }
+  const uint8_t* data_y = mapped_file.data().data() + offset;
+  const uint8_t* data_u = data_y + y_size;
+  const uint8_t* data_v = data_u + chroma_size;
+  return I420Buffer::Copy(resolution.width, resolution.height, data_y,
+                          resolution.width, data_u, chroma_width, data_v,
+                          chroma_width);
+}
+
 scoped_refptr<I420Buffer> Scale(scoped_refptr<I420Buffer> buffer,
                                 Resolution resolution) {
   if (buffer->width() == resolution.width &&
@@ -103,6 +124,11 @@ void YuvFrameReaderImpl::Init() {
 
   num_frames_ = static_cast<int>(file_size_bytes / frame_size_bytes_);
   RTC_CHECK_GT(num_frames_, 0u) << "File " << filepath_ << " is too small";
+
+  mapped_file_ = MemoryMappedFile::OpenReadOnly(filepath_);
+  if (mapped_file_) {
+    mapped_file_->AdviseSequential();
+  }
 }
 
 scoped_refptr<I420Buffer> YuvFrameReaderImpl::PullFrame() {
@@ -135,8 +161,17 @@ scoped_refptr<I420Buffer> YuvFrameReaderImpl::ReadFrame(int frame_num,
     RTC_CHECK_EQ(RepeatMode::kSingle, repeat_mode_);
     return nullptr;
   }
-  fseek(file_, header_size_bytes_ + wrapped_num * frame_size_bytes_, SEEK_SET);
-  auto buffer = ReadI420Buffer(resolution_.width, resolution_.height, file_);
+  const size_t offset = header_size_bytes_ + wrapped_num * frame_size_bytes_;
+  scoped_refptr<I420Buffer> buffer;
+  if (mapped_file_) {
+    buffer = ReadI420Buffer(resolution_, *mapped_file_, offset);
+    // Frames are mostly read in order, so let the next frame be read in while
+    // this one is processed.
+    mapped_file_->WillNeed(offset + frame_size_bytes_, frame_size_bytes_);
+  } else {
+    fseek(file_, offset, SEEK_SET);
+    buffer = ReadI420Buffer(resolution_.width, resolution_.height, file_);
+  }
   RTC_CHECK(buffer != nullptr);
 
   return Scale(buffer, resolution);
@@ -97,23 +97,11 @@ void HaltonFrameSampler::SetCurrentIndex(int index) {
   coordinate_sampler_prng_.SetCurrentIndex(index);
 }
 
-// Apply Gaussian filtering to the data.
-double GetFilteredElement(int width,
-                          int height,
-                          int stride,
-                          const uint8_t* data,
-                          int row,
-                          int column,
-                          double std_dev) {
-  RTC_CHECK_GE(row, 0);
-  RTC_CHECK_LT(row, height);
-  RTC_CHECK_GE(column, 0);
-  RTC_CHECK_LT(column, width);
-  RTC_CHECK_GE(stride, width);
+GaussianFilterKernel::GaussianFilterKernel(double std_dev) {
   RTC_CHECK_GT(std_dev, 0.0)
       << "Standard deviation = 0 yields improper Gaussian weights.";
 
-  int max_distance =
+  max_distance_ =
       std::ceil(std::sqrt(-2.0 * std::log(kCutoff) * std::pow(std_dev, 2.0))) -
       1;
   // In order to counteract unexpected distortions (such as noise), a lower
@@ -122,26 +110,82 @@ double GetFilteredElement(int width,
   // False positives are decreased since for small `std_dev`s the quantization
   // is strong and would cut of many of the small continuous weights used for
   // robust comparision.
-  max_distance = std::max(kLowerBoundKernelSize, max_distance);
+  max_distance_ = std::max(kLowerBoundKernelSize, max_distance_);
+  kernel_size_ = 2 * max_distance_ + 1;
+
+  weights_.resize(kernel_size_ * kernel_size_);
+  total_weight_ = 0.0;
+  for (int dr = -max_distance_; dr <= max_distance_; ++dr) {
+    for (int dc = -max_distance_; dc <= max_distance_; ++dc) {
+      double weight = std::exp(-1.0 * (std::pow(dr, 2) + std::pow(dc, 2)) /
+                               (2.0 * std::pow(std_dev, 2)));
+      weights_[(dr + max_distance_) * kernel_size_ + dc + max_distance_] =
+          weight;
+      total_weight_ += weight;
+    }
+  }
+}
+
+double GaussianFilterKernel::FilterElement(int width,
+                                           int height,
+                                           int stride,
+                                           const uint8_t* data,
+                                           int row,
+                                           int column) const {
+  RTC_CHECK_GE(row, 0);
+  RTC_CHECK_LT(row, height);
+  RTC_CHECK_GE(column, 0);
+  RTC_CHECK_LT(column, width);
+  RTC_CHECK_GE(stride, width);
+
+  const int first_row = std::max(row - max_distance_, 0);
+  const int end_row = std::min(row + max_distance_ + 1, height);
+  const int first_column = std::max(column - max_distance_, 0);
+  const int end_column = std::min(column + max_distance_ + 1, width);
+  const int num_columns = end_column - first_column;
+  const bool clipped = first_row != row - max_distance_ ||
+                       end_row != row + max_distance_ + 1 ||
+                       num_columns != kernel_size_;
 
+  // The weights are visited in the same order as they were summed when
+  // creating the kernel, so `total_weight_` is bit exact for unclipped
+  // kernels.
   double element_sum = 0.0;
   double total_weight = 0.0;
-  for (int r = std::max(row - max_distance, 0);
-       r < std::min(row + max_distance + 1, height); ++r) {
-    for (int c = std::max(column - max_distance, 0);
-         c < std::min(column + max_distance + 1, width); ++c) {
-      double weight =
-          std::exp(-1.0 * (std::pow(row - r, 2) + std::pow(column - c, 2)) /
-                   (2.0 * std::pow(std_dev, 2)));
-      element_sum += data[r * stride + c] * weight;
-      total_weight += weight;
+  for (int r = first_row; r < end_row; ++r) {
+    const uint8_t* row_data = data + r * stride + first_column;
+    const double* row_weights =
+        weights_.data() + (r - row + max_distance_) * kernel_size_ +
+        (first_column - column + max_distance_);
+    for (int c = 0; c < num_columns; ++c) {
+      element_sum += row_data[c] * row_weights[c];
     }
+    if (clipped) {
+      for (int c = 0; c < num_columns; ++c) {
+        total_weight += row_weights[c];
+      }
+    }
+  }
+  if (!clipped) {
+    total_weight = total_weight_;
   }
 
   // Take the rounding errors into consideration.
   return SafeClamp(element_sum / total_weight, 0.0, 255.0);
 }
 
+// Apply Gaussian filtering to the data.
+double GetFilteredElement(int width,
+                          int height,
+                          int stride,
+                          const uint8_t* data,
+                          int row,
+                          int column,
+                          double std_dev) {
+  return GaussianFilterKernel(std_dev).FilterElement(width, height, stride,
+                                                     data, row, column);
+}
+
 std::vector<FilteredSample> GetSampleValuesForFrame(
     const scoped_refptr<I420BufferInterface> i420_frame_buffer,
     std::vector<HaltonFrameSampler::Coordinates> sample_coordinates,
@@ -189,9 +233,19 @@ std::vector<FilteredSample> GetSampleValuesForFrame(
   // Scale the frame to the desired resolution:
   // 1. Create a new buffer with the desired resolution.
   // 2. Scale the old buffer to the size of the new buffer.
-  scoped_refptr<I420Buffer> scaled_i420_buffer =
-      I420Buffer::Create(scaled_width, scaled_height);
-  scaled_i420_buffer->ScaleFrom(*i420_frame_buffer);
+  // No scaling (and hence no copy) is needed if the frame already has the
+  // desired resolution.
+  scoped_refptr<I420BufferInterface> scaled_i420_buffer = i420_frame_buffer;
+  if (scaled_width != i420_frame_buffer->width() ||
+      scaled_height != i420_frame_buffer->height()) {
+    scoped_refptr<I420Buffer> scaled_buffer =
+        I420Buffer::Create(scaled_width, scaled_height);
+    scaled_buffer->ScaleFrom(*i420_frame_buffer);
+    scaled_i420_buffer = scaled_buffer;
+  }
+
+  // The same kernel is used for all samples in the frame.
+  const GaussianFilterKernel kernel(std_dev_gaussian_blur);
 
   // Treat the planes as if they would have the following 2-dimensional layout:
   // +------+---+
@@ -220,29 +274,29 @@ std::vector<FilteredSample> GetSampleValuesForFrame(
     double value_for_coordinate;
     if (column < scaled_i420_buffer->width()) {
       // Y plane.
-      value_for_coordinate = GetFilteredElement(
+      value_for_coordinate = kernel.FilterElement(
           scaled_i420_buffer->width(), scaled_i420_buffer->height(),
           scaled_i420_buffer->StrideY(), scaled_i420_buffer->DataY(), row,
-          column, std_dev_gaussian_blur);
+          column);
       filtered_samples.push_back(
           {.value = value_for_coordinate, .plane = ImagePlane::kLuma});
     } else if (row < scaled_i420_buffer->ChromaHeight()) {
       // U plane.
       column -= scaled_i420_buffer->width();
-      value_for_coordinate = GetFilteredElement(
+      value_for_coordinate = kernel.FilterElement(
           scaled_i420_buffer->ChromaWidth(), scaled_i420_buffer->ChromaHeight(),
           scaled_i420_buffer->StrideU(), scaled_i420_buffer->DataU(), row,
-          column, std_dev_gaussian_blur);
+          column);
       filtered_samples.push_back(
           {.value = value_for_coordinate, .plane = ImagePlane::kChroma});
     } else {
       // V plane.
       column -= scaled_i420_buffer->width();
       row -= scaled_i420_buffer->ChromaHeight();
-      value_for_coordinate = GetFilteredElement(
+      value_for_coordinate = kernel.FilterElement(
           scaled_i420_buffer->ChromaWidth(), scaled_i420_buffer->ChromaHeight(),
           scaled_i420_buffer->StrideV(), scaled_i420_buffer->DataV(), row,
-          column, std_dev_gaussian_blur);
+          column);
       filtered_samples.push_back(
           {.value = value_for_coordinate, .plane = ImagePlane::kChroma});
     }
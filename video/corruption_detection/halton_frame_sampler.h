@@ -73,6 +73,36 @@ std::vector<FilteredSample> GetSampleValuesForFrame(
     int scaled_height,
     double std_dev_gaussian_blur);
 
+// Precomputed weights of the Gaussian filter used by `GetFilteredElement`.
+// Computing the weights is the dominating cost when filtering a single
+// element, so a kernel should be created once per frame and reused for all
+// samples in that frame.
+class GaussianFilterKernel {
+ public:
+  explicit GaussianFilterKernel(double std_dev);
+
+  int max_distance() const { return max_distance_; }
+
+  // Returns the blurred value at (`row`, `column`). Gives the same result as
+  // `GetFilteredElement` with the standard deviation given at construction.
+  double FilterElement(int width,
+                       int height,
+                       int stride,
+                       const uint8_t* data,
+                       int row,
+                       int column) const;
+
+ private:
+  int max_distance_;
+  int kernel_size_;
+  // Row-major weights of size `kernel_size_` x `kernel_size_`, centered on
+  // the filtered element.
+  std::vector<double> weights_;
+  // Sum of all `weights_`, used when the kernel is not clipped by the frame
+  // borders.
+  double total_weight_;
+};
+
 // Returns the blurred value. The minimum half-kernel size is 3 pixels.
 double GetFilteredElement(int width,
                           int height,
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2025 The WebRTC project authors. All rights reserved.
+ *
+ * Use of this source code is governed by a BSD-style license
+ * that can be found in the LICENSE file in the root of the source
+ * tree. An additional intellectual property rights grant can be found
+ * in the file PATENTS.  All contributing project authors may
+ * be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "benchmark/benchmark.h"
+#include "video/corruption_detection/halton_frame_sampler.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumSamples = 13;
+
+scoped_refptr<I420Buffer> MakeFrame(int width, int height) {
+  scoped_refptr<I420Buffer> buffer = I420Buffer::Create(width, height);
+  uint8_t value = 0;
+  for (int i = 0; i < buffer->StrideY() * height; ++i) {
+    buffer->MutableDataY()[i] = value;
+    value += 7;
+  }
+  for (int i = 0; i < buffer->StrideU() * buffer->ChromaHeight(); ++i) {
+    buffer->MutableDataU()[i] = value;
+    buffer->MutableDataV()[i] = value + 1;
+    value += 13;
+  }
+  return buffer;
+}
+
+// Samples a full resolution 720p frame, i.e. no scaling, as done by the
+// receiver when the frame is not downscaled by the encoder.
+void BM_GetSampleValuesForFrame(benchmark::State& state) {
+  const double std_dev = state.range(0) / 10.0;
+  scoped_refptr<I420Buffer> frame = MakeFrame(1280, 720);
+  HaltonFrameSampler sampler;
+  for (auto _ : state) {
+    std::vector<FilteredSample> samples = GetSampleValuesForFrame(
+        frame, sampler.GetSampleCoordinatesForFrame(kNumSamples),
+        frame->width(), frame->height(), std_dev);
+    benchmark::DoNotOptimize(samples);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumSamples);
+}
+
+void BM_GetFilteredElement(benchmark::State& state) {
+  const double std_dev = state.range(0) / 10.0;
+  scoped_refptr<I420Buffer> frame = MakeFrame(1280, 720);
+  for (auto _ : state) {
+    double value =
+        GetFilteredElement(frame->width(), frame->height(), frame->StrideY(),
+                           frame->DataY(), 360, 640, std_dev);
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+void BM_GaussianFilterKernelFilterElement(benchmark::State& state) {
+  const double std_dev = state.range(0) / 10.0;
+  scoped_refptr<I420Buffer> frame = MakeFrame(1280, 720);
+  const GaussianFilterKernel kernel(std_dev);
+  for (auto _ : state) {
+    double value = kernel.FilterElement(frame->width(), frame->height(),
+                                        frame->StrideY(), frame->DataY(), 360,
+                                        640);
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+// Standard deviations of 0.5, 1.5 and 5.0.
+BENCHMARK(BM_GetSampleValuesForFrame)->Arg(5)->Arg(15)->Arg(50);
+BENCHMARK(BM_GetFilteredElement)->Arg(5)->Arg(15)->Arg(50);
+BENCHMARK(BM_GaussianFilterKernelFilterElement)->Arg(5)->Arg(15)->Arg(50);
+
+}  // namespace
+}  // namespace webrtc
@@ -10,6 +10,8 @@
 
 #include "video/corruption_detection/halton_frame_sampler.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <vector>
 
@@ -97,6 +99,65 @@ TEST(GaussianFilteringTest, ShouldReturnFilteredValueWhenInputIsValid) {
               DoubleEq(126.45897447350468));
 }
 
+// Filters the element at (`row`, `column`) by computing the Gaussian weight of
+// each element within the kernel with `std::exp`.
+double ReferenceFilteredElement(int width,
+                                int height,
+                                int stride,
+                                const uint8_t* data,
+                                int row,
+                                int column,
+                                double std_dev) {
+  // Elements with weights below 0.2 are cut off, but at least those within a
+  // distance of 3 are used.
+  const int max_distance = std::max(
+      3, static_cast<int>(std::ceil(std::sqrt(-2.0 * std::log(0.2)) * std_dev) -
+                          1));
+  double element_sum = 0.0;
+  double total_weight = 0.0;
+  for (int r = std::max(row - max_distance, 0);
+       r <= std::min(row + max_distance, height - 1); ++r) {
+    for (int c = std::max(column - max_distance, 0);
+         c <= std::min(column + max_distance, width - 1); ++c) {
+      const double distance_squared =
+          (row - r) * (row - r) + (column - c) * (column - c);
+      const double weight =
+          std::exp(-distance_squared / (2.0 * std_dev * std_dev));
+      element_sum += data[r * stride + c] * weight;
+      total_weight += weight;
+    }
+  }
+  return element_sum / total_weight;
+}
+
+TEST(GaussianFilteringTest, KernelGivesSameValuesAsReferenceFilter) {
+  const int kWidth = 16;
+  const int kHeight = 12;
+  const int kStride = 20;
+  std::vector<uint8_t> data(kStride * kHeight);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>((i * 37 + 11) % 256);
+  }
+
+  for (double std_dev : {0.5, 1.12, 2.5, 6.0}) {
+    const GaussianFilterKernel kernel(std_dev);
+    // Covers both elements where the kernel is clipped by the frame borders
+    // and elements where the whole kernel is inside the frame.
+    for (int row = 0; row < kHeight; ++row) {
+      for (int column = 0; column < kWidth; ++column) {
+        const double expected = ReferenceFilteredElement(
+            kWidth, kHeight, kStride, data.data(), row, column, std_dev);
+        EXPECT_THAT(kernel.FilterElement(kWidth, kHeight, kStride,
+                                         data.data(), row, column),
+                    DoubleNear(expected, 1e-9));
+        EXPECT_THAT(GetFilteredElement(kWidth, kHeight, kStride, data.data(),
+                                       row, column, std_dev),
+                    DoubleNear(expected, 1e-9));
+      }
+    }
+  }
+}
+
 #if GTEST_HAS_DEATH_TEST
 TEST(GaussianFilteringTest, ShouldCrashWhenRowIsNegative) {
   EXPECT_DEATH(